@@ -14,6 +14,9 @@
 // Forward decelerations:
 struct osEnvironmentVariable;
 
+// C++:
+#include <atomic>
+
 // Infra:
 #include <amdt_base_tools/Include/gtString.h>
 #include <amdt_base_tools/Include/gtVector.h>
@@ -99,6 +102,9 @@ OS_API bool osIsProcessAttachable(osProcessId processId);
 
 OS_API bool osExecAndGrabOutput(const char* cmd, const bool& cancelSignal, gtString& cmdOutput);
 
+// Same as above, for a cancel flag that is set by another thread while the command executes.
+OS_API bool osExecAndGrabOutput(const char* cmd, const std::atomic<bool>& cancelSignal, gtString& cmdOutput);
+
 #ifdef _WIN32
 OS_API bool osExecAndGrabOutputAndError(const char* cmd, const bool& cancelSignal,
     const gtString& workingDir, gtString& cmdOutput, gtString& cmdErrOutput);
@@ -1265,21 +1265,14 @@ bool popen2(const char* pCmd, popen2_data_t& childInfo)
 }
 
 // ---------------------------------------------------------------------------
-// Name:        osExecAndGrabOutput
-// Description: Executes the in a different process and captures its output.
-//              This routine blocks, but, using the cancelSignal flag, it allows
-//              the caller to terminate the command's execution.
-// Arguments:   cmd - The command to be executed.
-//              cancelSignal - A reference to the cancel flag. Upon calling this
-//              routine, the cancelSignal flag should be set to false. In case that
-//              the caller wants to terminate the commands' execution, this flag
-//              should be set to true.
-//              cmdOutput - an output parameter to hold the command's output.
-// Return Val:  bool - Success / failure.
+// Name:        osExecAndGrabOutputImpl
+// Description: Implements the osExecAndGrabOutput overloads, for a cancel flag of
+//              type bool or std::atomic<bool>.
 // Author:      AMD Developer Tools Team
-// Date:        30/08/2015
+// Date:        18/10/2026
 // ---------------------------------------------------------------------------
-bool osExecAndGrabOutput(const char* cmd, const bool& cancelSignal, gtString& cmdOutput)
+template <typename CancelFlag>
+static bool osExecAndGrabOutputImpl(const char* cmd, const CancelFlag& cancelSignal, gtString& cmdOutput)
 {
     // The default buffer size.
     const size_t BUFF_SIZE = 65536;
@@ -1360,6 +1353,38 @@ bool osExecAndGrabOutput(const char* cmd, const bool& cancelSignal, gtString& cm
     return ret;
 }
 
+// ---------------------------------------------------------------------------
+// Name:        osExecAndGrabOutput
+// Description: Executes the in a different process and captures its output.
+//              This routine blocks, but, using the cancelSignal flag, it allows
+//              the caller to terminate the command's execution.
+// Arguments:   cmd - The command to be executed.
+//              cancelSignal - A reference to the cancel flag. Upon calling this
+//              routine, the cancelSignal flag should be set to false. In case that
+//              the caller wants to terminate the commands' execution, this flag
+//              should be set to true.
+//              cmdOutput - an output parameter to hold the command's output.
+// Return Val:  bool - Success / failure.
+// Author:      AMD Developer Tools Team
+// Date:        30/08/2015
+// ---------------------------------------------------------------------------
+bool osExecAndGrabOutput(const char* cmd, const bool& cancelSignal, gtString& cmdOutput)
+{
+    return osExecAndGrabOutputImpl(cmd, cancelSignal, cmdOutput);
+}
+
+// ---------------------------------------------------------------------------
+// Name:        osExecAndGrabOutput
+// Description: Same as above, for a cancel flag that is set by another thread
+//              while the command executes.
+// Author:      AMD Developer Tools Team
+// Date:        18/10/2026
+// ---------------------------------------------------------------------------
+bool osExecAndGrabOutput(const char* cmd, const std::atomic<bool>& cancelSignal, gtString& cmdOutput)
+{
+    return osExecAndGrabOutputImpl(cmd, cancelSignal, cmdOutput);
+}
+
 OS_API bool osIsParent(osProcessId parentProcessId, osProcessId processId)
 {
     osProcessId originalParentProcessId;
@@ -1589,21 +1589,14 @@ static bool ReadProcessPlatformWow64(HANDLE hProcess, osRuntimePlatform& platfor
 #endif // AMDT_ADDRESS_SPACE_TYPE != AMDT_64_BIT_ADDRESS_SPACE
 
 // ---------------------------------------------------------------------------
-// Name:        osExecAndGrabOutput
-// Description: Executes the given command in a different process and captures its output.
-//              This routine blocks, but, using the cancelSignal flag, it allows
-//              the caller to terminate the command's execution.
-// Arguments:   cmd - The command to be executed.
-//              cancelSignal - A reference to the cancel flag. Upon calling this
-//              routine, the cancelSignal flag should be set to false. In case that
-//              the caller wants to terminate the commands' execution, this flag
-//              should be set to true.
-//              cmdOutput - an output parameter to hold the command's output.
-// Return Val:  bool - Success / failure.
+// Name:        osExecAndGrabOutputImpl
+// Description: Implements the osExecAndGrabOutput overloads, for a cancel flag of
+//              type bool or std::atomic<bool>.
 // Author:      AMD Developer Tools Team
-// Date:        08/30/2015
+// Date:        10/18/2026
 // ---------------------------------------------------------------------------
-OS_API bool osExecAndGrabOutput(const char* cmd, const bool& cancelSignal, gtString& cmdOutput)
+template <typename CancelFlag>
+static bool osExecAndGrabOutputImpl(const char* cmd, const CancelFlag& cancelSignal, gtString& cmdOutput)
 {
     bool ret = false;
     SECURITY_ATTRIBUTES sa;
@@ -1715,6 +1708,38 @@ OS_API bool osExecAndGrabOutput(const char* cmd, const bool& cancelSignal, gtStr
     return ret;
 }
 
+// ---------------------------------------------------------------------------
+// Name:        osExecAndGrabOutput
+// Description: Executes the given command in a different process and captures its output.
+//              This routine blocks, but, using the cancelSignal flag, it allows
+//              the caller to terminate the command's execution.
+// Arguments:   cmd - The command to be executed.
+//              cancelSignal - A reference to the cancel flag. Upon calling this
+//              routine, the cancelSignal flag should be set to false. In case that
+//              the caller wants to terminate the commands' execution, this flag
+//              should be set to true.
+//              cmdOutput - an output parameter to hold the command's output.
+// Return Val:  bool - Success / failure.
+// Author:      AMD Developer Tools Team
+// Date:        08/30/2015
+// ---------------------------------------------------------------------------
+OS_API bool osExecAndGrabOutput(const char* cmd, const bool& cancelSignal, gtString& cmdOutput)
+{
+    return osExecAndGrabOutputImpl(cmd, cancelSignal, cmdOutput);
+}
+
+// ---------------------------------------------------------------------------
+// Name:        osExecAndGrabOutput
+// Description: Same as above, for a cancel flag that is set by another thread
+//              while the command executes.
+// Author:      AMD Developer Tools Team
+// Date:        10/18/2026
+// ---------------------------------------------------------------------------
+OS_API bool osExecAndGrabOutput(const char* cmd, const std::atomic<bool>& cancelSignal, gtString& cmdOutput)
+{
+    return osExecAndGrabOutputImpl(cmd, cancelSignal, cmdOutput);
+}
+
 // ---------------------------------------------------------------------------
 // Name:        osExecAndGrabOutputAndError
 // Description: Executes the given command in a different process and captures its output
@@ -8,12 +8,17 @@
 #pragma once
 
 // c++
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
 #include <ctime>
 #include <string>
 #include <sstream>
 #include <iostream>
 #include <thread>
 #include <mutex>
+#include <vector>
 #include <sys/stat.h>
 
 // Infra
@@ -49,19 +54,36 @@ static const std::string kStrDirectoryDelimiter = "/";
 //
 class StreamTable
 {
+public:
+    // Log file message waiting for the log writer thread.
+    //  time      -- the time when the message was logged.
+    //  text      -- the text of the message.
+    struct QueuedMessage
+    {
+        spdlog::log_clock::time_point  time;
+        std::string                    text;
+    };
+
+private:
     // Element of Stream Table.
     //  tid       -- thread ID.
     //  stream    -- stringstream corresponding to tid.
     //  is_used    -- indicates whether this slot is currently used by some thread.
     //  do_flush   -- indicates whether std::endl flushes stream to file/console.
+    //  queue      -- log file messages of the thread waiting for the log writer thread.
+    //  queue_size -- total size of the queued messages, in bytes.
+    //  queue_lock -- guards the queue. Only the log writer thread competes with the thread of the slot for it.
     struct StreamTableSlot
     {
         std::thread::id               tid;
         std::stringstream             stream;
         volatile std::atomic<bool>    is_used;
         volatile std::atomic<bool>    do_flush;
+        std::vector<QueuedMessage>    queue;
+        size_t                        queue_size;
+        std::mutex                    queue_lock;
 
-        StreamTableSlot() { is_used = false; do_flush = true; }
+        StreamTableSlot() { is_used = false; do_flush = true; queue_size = 0; }
     };
 
 public:
@@ -91,6 +113,36 @@ public:
         return ret;
     }
 
+    // Add a log file message to the queue of the thread with provided ID.
+    // Returns "true" if the message was queued, and the total size of the messages queued by the thread in "queue_size".
+    bool  Enqueue(std::thread::id tid, std::string&& text, size_t& queue_size)
+    {
+        bool  ret = false;
+        if (RgOptionalRef<StreamTableSlot>  slot = GetSlot(tid))
+        {
+            std::lock_guard<std::mutex>  lock(slot->queue_lock);
+            slot->queue_size += text.size();
+            slot->queue.push_back({spdlog::log_clock::now(), std::move(text)});
+            queue_size = slot->queue_size;
+            ret = true;
+        }
+        return ret;
+    }
+
+    // Move the queued log file messages of all threads to "messages".
+    // The messages of every thread are in the order in which they were logged.
+    void  Dequeue(std::vector<QueuedMessage>& messages)
+    {
+        for (uint32_t i = 0, size = std::atomic_load(&table_size_); i < size && i < kMsStreamTableSize; i++)
+        {
+            auto&  slot = streams_[i];
+            std::lock_guard<std::mutex>  lock(slot.queue_lock);
+            std::move(slot.queue.begin(), slot.queue.end(), std::back_inserter(messages));
+            slot.queue.clear();
+            slot.queue_size = 0;
+        }
+    }
+
     // Mark the slot for the thread with provided ID as "not used" so that new threads can use it.
     bool  ClearSlot(std::thread::id tid)
     {
@@ -254,6 +306,7 @@ public:
             std::string  procID = kStrProcIdPrefix + std::to_string(GetProcessID());
             ms_data.logger = spdlog::basic_logger_mt(procID, filePath);
             spdlog::set_level(spdlog::level::trace);
+            StartWriter();
             ret = true;
         }
         catch (std::exception& e)
@@ -289,11 +342,13 @@ public:
     }
 
     // Close the log file.
+    // Stops the log writer thread and writes the messages that it did not write yet. Messages logged after that are written synchronously.
     static void  Close()
     {
+        StopWriter();
         if (ms_data.logger != nullptr)
         {
-            ms_data.logger->flush();
+            WriteQueuedMessages();
         }
     }
 
@@ -417,6 +472,7 @@ private:
         {
             ms_data.logger = logger;
             spdlog::set_level(spdlog::level::trace);
+            StartWriter();
             ret = true;
         }
         return ret;
@@ -494,6 +550,78 @@ private:
         return (lvl <= std::get<DST>(ms_data.levels));
     }
 
+    // Start the log writer thread, which writes the queued log file messages of all threads in batches.
+    // The log is closed at exit, so that the messages queued when the process exits are written.
+    static void  StartWriter()
+    {
+        std::lock_guard<std::mutex>  lock(ms_data.writer_lock);
+        if (!ms_data.writer.joinable())
+        {
+            static std::once_flag  closeAtExit;
+            std::call_once(closeAtExit, []() { std::atexit(Close); });
+
+            ms_data.isWriterStopping = false;
+            ms_data.writer = std::thread(WriterLoop);
+            std::atomic_store(&ms_data.isWriterRunning, true);
+        }
+    }
+
+    // Stop the log writer thread, if it is running.
+    static void  StopWriter()
+    {
+        std::thread  writer;
+        {
+            std::lock_guard<std::mutex>  lock(ms_data.writer_lock);
+            std::atomic_store(&ms_data.isWriterRunning, false);
+            ms_data.isWriterStopping = true;
+            writer = std::move(ms_data.writer);
+        }
+        ms_data.writer_wakeup.notify_all();
+        if (writer.joinable())
+        {
+            writer.join();
+        }
+    }
+
+    // The log writer thread: write the queued messages every ms_WRITE_INTERVAL_MS milliseconds, until the writer is stopped.
+    static void  WriterLoop()
+    {
+        std::unique_lock<std::mutex>  lock(ms_data.writer_lock);
+        while (!ms_data.isWriterStopping)
+        {
+            ms_data.writer_wakeup.wait_for(lock, std::chrono::milliseconds(ms_WRITE_INTERVAL_MS));
+            lock.unlock();
+            WriteQueuedMessages();
+            lock.lock();
+        }
+    }
+
+    // Write the queued log file messages of all threads to the log file in the order in which they were logged, and flush the file.
+    static void  WriteQueuedMessages()
+    {
+        std::lock_guard<std::mutex>  lock(ms_data.write_lock);
+        std::vector<StreamTable::QueuedMessage>  messages;
+        ms_data.streamTable.Dequeue(messages);
+        std::stable_sort(messages.begin(), messages.end(),
+                         [](const StreamTable::QueuedMessage& m1, const StreamTable::QueuedMessage& m2) { return m1.time < m2.time; });
+        try
+        {
+            for (const StreamTable::QueuedMessage& message : messages)
+            {
+                ms_data.logger->log(message.time, spdlog::source_loc{}, spdlog::level::info, message.text);
+            }
+            if (!messages.empty())
+            {
+                ms_data.logger->flush();
+            }
+        }
+        catch (std::exception& e)
+        {
+            std::cerr << e.what() << std::endl;
+        }
+        catch (...) {}
+    }
+
     // Push the content of the stream for the thread with provided thread ID to the log file or to console.
     // Clear the content of the stream after pushing it to the log file.
     template<LogDst DST>
@@ -507,6 +635,7 @@ private:
         {
             if (ms_data.logger != nullptr)
             {
+                WriteQueuedMessages();
                 ms_data.logger->error(msg);
                 ms_data.logger->flush();
             }
@@ -537,11 +666,28 @@ private:
         std::tuple<LogLvl, LogLvl, LogLvl>  levels  = std::make_tuple(LogLvl::k_info_, LogLvl::k_info_, LogLvl::k_info_);
         std::mutex                          console_lock;
         StreamTable                         streamTable;
+
+        // The log writer thread, and the lock and condition that control it.
+        std::thread                         writer;
+        std::mutex                          writer_lock;
+        std::condition_variable             writer_wakeup;
+        bool                                isWriterStopping = false;
+        std::atomic<bool>                   isWriterRunning{false};
+
+        // Serializes the writing of queued messages to the log file.
+        std::mutex                          write_lock;
     };
 
     // Maximum number of log files with the same data/time.
     static const int  ms_MAX_SAME_DATE_LOG_FILES_NUM = 64;
 
+    // Interval between the batches written by the log writer thread, in milliseconds.
+    static constexpr int  ms_WRITE_INTERVAL_MS = 200;
+
+    // Maximum size of the log file messages queued by a thread, in bytes.
+    // A thread that exceeds it writes the queued messages itself, so the queues use at most this size per thread slot.
+    static constexpr size_t  ms_MAX_QUEUE_SIZE = 256 * 1024;
+
     // LOG data
     static LogData    ms_data;
 };
@@ -565,7 +711,8 @@ inline void  RgLog::Push<RgLog::LogDst::k_std_err_>(std::stringstream& stream)
         std::cerr.flush();
     }
 
-    // Copy the message to the log file.
+    // Copy the message to the log file, after the messages queued before it.
+    RgLog::WriteQueuedMessages();
     try
     {
         ms_data.logger->info(stream.str());
@@ -583,16 +730,29 @@ inline void  RgLog::Push<RgLog::LogDst::k_std_err_>(std::stringstream& stream)
 template<>
 inline void  RgLog::Push<RgLog::LogDst::k_log_file_>(std::stringstream& stream)
 {
-    try
+    // Queue the message for the log writer thread if it is running, and write it synchronously otherwise.
+    size_t  queue_size = 0;
+    if (std::atomic_load(&ms_data.isWriterRunning) && ms_data.streamTable.Enqueue(std::this_thread::get_id(), stream.str(), queue_size))
     {
-        ms_data.logger->info(stream.str());
-        ms_data.logger->flush();
+        // Write the queued messages if the writer thread falls behind, or if it stopped before it could see the message.
+        if (queue_size > ms_MAX_QUEUE_SIZE || !std::atomic_load(&ms_data.isWriterRunning))
+        {
+            WriteQueuedMessages();
+        }
     }
-    catch (std::exception& e)
+    else
     {
-        std::cerr << e.what() << std::endl;
+        try
+        {
+            ms_data.logger->info(stream.str());
+            ms_data.logger->flush();
+        }
+        catch (std::exception& e)
+        {
+            std::cerr << e.what() << std::endl;
+        }
+        catch (...) {}
     }
-    catch (...) {}
 
     stream.str("");
 }
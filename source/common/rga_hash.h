@@ -0,0 +1,56 @@
+//=============================================================================
+/// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Header for the FNV-1a hash that is shared by the RGA components.
+//=============================================================================
+
+#pragma once
+
+// C++.
+#include <cstdint>
+#include <string_view>
+
+// FNV-1a hash of byte sequences, in 32-bit and 64-bit variants. The hash is not cryptographic:
+// it identifies content (cache keys, file signatures) and indexes hash tables.
+// All functions are constexpr, so that the hash can also be computed at compile time.
+class RgaFnv1a
+{
+public:
+    // The initial hash values.
+    static constexpr uint32_t kOffsetBasis32 = 2166136261u;
+    static constexpr uint64_t kOffsetBasis64 = 14695981039346656037ULL;
+
+    // Add the given bytes to a hash, and return the updated hash.
+    static constexpr uint32_t Update32(uint32_t hash, std::string_view data)
+    {
+        for (char c : data)
+        {
+            hash = (hash ^ static_cast<uint8_t>(c)) * kPrime32;
+        }
+        return hash;
+    }
+
+    static constexpr uint64_t Update64(uint64_t hash, std::string_view data)
+    {
+        for (char c : data)
+        {
+            hash = (hash ^ static_cast<uint8_t>(c)) * kPrime64;
+        }
+        return hash;
+    }
+
+    // Returns the hash of the given bytes.
+    static constexpr uint32_t Hash32(std::string_view data) { return Update32(kOffsetBasis32, data); }
+
+    static constexpr uint64_t Hash64(std::string_view data) { return Update64(kOffsetBasis64, data); }
+
+private:
+    // The FNV primes.
+    static constexpr uint32_t kPrime32 = 16777619u;
+    static constexpr uint64_t kPrime64 = 1099511628211ULL;
+
+    // This is a static class (no instances).
+    RgaFnv1a()  = delete;
+    ~RgaFnv1a() = delete;
+};
@@ -0,0 +1,260 @@
+//=============================================================================
+/// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Header for the binary session metadata format.
+//=============================================================================
+
+#pragma once
+
+// C++.
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Local.
+#include "common/rga_hash.h"
+
+// The CLI writes a binary copy of the session metadata next to the session metadata XML file,
+// so that the GUI can read the build outputs without parsing the XML file.
+// The XML file remains the reference: the binary file records the size and a hash of the content of the XML file
+// that it matches, and readers use the XML file when the binary file is missing or does not match it.
+//
+// File layout, in host byte order:
+//   header   -- magic, format version, kind of metadata, size and content hash of the matching XML file.
+//   records  -- one for every block of metadata appended to the XML file: the payload size, then the payload.
+//
+// Payload of an OpenCL (and binary analysis) record:
+//   u8 has_binary, [string binary_path]
+//   u32 input_file_count, for each input file:
+//     string path, u32 entry_count, for each entry:
+//       string name, string type, u8 has_extremely_long_name, [string extremely_long_name]
+//       u32 output_count, for each output: output files.
+//
+// Payload of a pipeline (Vulkan) record:
+//   u32 pipeline_count, for each pipeline:
+//     u8 is_compute, u32 stage_count, for each stage: string type, string input_file_path, output files.
+//
+// Output files: string target, u32 file_count, for each file: u8 file type, string path.
+// Strings are a u32 length followed by the characters.
+
+// Suffix added to the session metadata XML file path to get the binary session metadata file path.
+static const char* kStrSessionMetadataBinaryFileSuffix = ".bin";
+
+// Magic number at the start of binary session metadata files.
+static const char kSessionMetadataBinaryMagic[8] = {'R', 'G', 'A', 'S', 'M', 'E', 'T', 'A'};
+
+// Binary session metadata format version. Files with another version are ignored.
+static const uint32_t kSessionMetadataBinaryVersion = 2;
+
+class RgaSessionMetadataBinary
+{
+public:
+    // Kind of the metadata held by a file.
+    enum class Kind : uint32_t
+    {
+        kOpencl   = 1,
+        kPipeline = 2
+    };
+
+    // Types of the output files, in the order in which the XML file lists them.
+    enum class FileType : uint8_t
+    {
+        kIsa,
+        kCsvIsa,
+        kResUsage,
+        kLivereg,
+        kLiveregSgpr,
+        kCfg
+    };
+
+    // The file header.
+    struct Header
+    {
+        char     magic[8];
+        uint32_t version;
+        uint32_t kind;
+        uint64_t xml_file_size;
+        uint64_t xml_file_hash;
+    };
+
+    // Identifies the content of a session metadata XML file: its size and the 64-bit FNV-1a hash of its content.
+    struct XmlSignature
+    {
+        uint64_t size = 0;
+        uint64_t hash = 0;
+    };
+
+    // Appends the fields of a record payload to a buffer.
+    class Encoder
+    {
+    public:
+        void AppendUint8(uint8_t value)
+        {
+            buffer_.push_back(static_cast<char>(value));
+        }
+
+        void AppendUint32(uint32_t value)
+        {
+            buffer_.append(reinterpret_cast<const char*>(&value), sizeof(value));
+        }
+
+        void AppendString(const std::string& value)
+        {
+            AppendUint32(static_cast<uint32_t>(value.size()));
+            buffer_.append(value);
+        }
+
+        const std::string& GetBuffer() const
+        {
+            return buffer_;
+        }
+
+    private:
+        std::string buffer_;
+    };
+
+    // Reads the fields of a record payload. Reading past the end of the payload fails, and so do all the reads that follow.
+    class Decoder
+    {
+    public:
+        Decoder(const char* data, size_t size) : pos_(data), end_(data + size) {}
+
+        bool ReadUint8(uint8_t& value)
+        {
+            return Read(&value, sizeof(value));
+        }
+
+        bool ReadUint32(uint32_t& value)
+        {
+            return Read(&value, sizeof(value));
+        }
+
+        bool ReadString(std::string& value)
+        {
+            uint32_t size = 0;
+            bool     ret  = ReadUint32(size) && size <= static_cast<size_t>(end_ - pos_);
+            if (ret)
+            {
+                value.assign(pos_, size);
+                pos_ += size;
+            }
+            else
+            {
+                pos_ = end_;
+                is_valid_ = false;
+            }
+            return ret;
+        }
+
+        // True if all the reads succeeded.
+        bool IsValid() const
+        {
+            return is_valid_;
+        }
+
+        // True if all the reads succeeded and the whole payload was read.
+        bool IsComplete() const
+        {
+            return is_valid_ && pos_ == end_;
+        }
+
+    private:
+        bool Read(void* value, size_t size)
+        {
+            is_valid_ = is_valid_ && size <= static_cast<size_t>(end_ - pos_);
+            if (is_valid_)
+            {
+                std::memcpy(value, pos_, size);
+                pos_ += size;
+            }
+            return is_valid_;
+        }
+
+        const char* pos_;
+        const char* end_;
+        bool        is_valid_ = true;
+    };
+
+    // A record payload inside the content of a file.
+    typedef std::pair<const char*, size_t> Record;
+
+    // Get the path of the binary session metadata file for the given session metadata XML file.
+    static std::string GetFilePath(const std::string& xml_file_path)
+    {
+        return xml_file_path + kStrSessionMetadataBinaryFileSuffix;
+    }
+
+    // Get the signature of the session metadata XML file at the given path.
+    // Returns false if the file cannot be read.
+    static bool GetXmlFileSignature(const std::string& xml_file_path, XmlSignature& signature)
+    {
+        std::ifstream     file(xml_file_path, std::ios::binary);
+        const std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        bool              ret = file.is_open() && !file.bad();
+        if (ret)
+        {
+            signature.size = content.size();
+            signature.hash = RgaFnv1a::Hash64(content);
+        }
+        return ret;
+    }
+
+    // Create the header of a file that matches an XML file with the given signature.
+    static Header CreateHeader(Kind kind, const XmlSignature& xml_signature)
+    {
+        Header header = {};
+        std::memcpy(header.magic, kSessionMetadataBinaryMagic, sizeof(header.magic));
+        header.version       = kSessionMetadataBinaryVersion;
+        header.kind          = static_cast<uint32_t>(kind);
+        header.xml_file_size = xml_signature.size;
+        header.xml_file_hash = xml_signature.hash;
+        return header;
+    }
+
+    // Check the header of the given file content.
+    // Returns true if it is a file of the given kind that matches an XML file with the given signature.
+    static bool IsHeaderValid(const char* data, size_t size, Kind kind, const XmlSignature& xml_signature)
+    {
+        Header header = {};
+        bool   ret    = (data != nullptr && size >= sizeof(header));
+        if (ret)
+        {
+            std::memcpy(&header, data, sizeof(header));
+            ret = std::memcmp(header.magic, kSessionMetadataBinaryMagic, sizeof(header.magic)) == 0 && header.version == kSessionMetadataBinaryVersion &&
+                  header.kind == static_cast<uint32_t>(kind) && header.xml_file_size == xml_signature.size &&
+                  header.xml_file_hash == xml_signature.hash;
+        }
+        return ret;
+    }
+
+    // Get the record payloads of the given file content, which must have a valid header.
+    // Returns false if the records are truncated.
+    static bool GetRecords(const char* data, size_t size, std::vector<Record>& records)
+    {
+        Decoder decoder(data + sizeof(Header), size - sizeof(Header));
+        size_t  offset = sizeof(Header);
+        bool    ret    = true;
+        while (ret && offset < size)
+        {
+            uint32_t record_size = 0;
+            ret                  = decoder.ReadUint32(record_size) && record_size <= size - offset - sizeof(record_size);
+            if (ret)
+            {
+                offset += sizeof(record_size);
+                records.push_back(Record(data + offset, record_size));
+                offset += record_size;
+                decoder = Decoder(data + offset, size - offset);
+            }
+        }
+        return ret;
+    }
+
+private:
+    RgaSessionMetadataBinary() = delete;
+    ~RgaSessionMetadataBinary() = delete;
+};
@@ -171,6 +171,7 @@ enum beStatus
     kBeStatusDxcCannotAutoGeneratePixelShader,
     kBeStatusDxcCannotAutoGenerateGpso,
     kBeStatusDxcCheckHrFailed,
+    kBeStatusStaticIsaAnalysisFailed,
     kBeStatusGeneralFailed
 };
 
@@ -268,6 +269,14 @@ public:
     }
 };
 
+// Static estimate of the number of cycles that a wavefront spends executing a kernel/function.
+struct CycleEstimate
+{
+    uint64_t min_cycles     = 0;    // Cheapest direction of the branches, lowest cost of the instructions whose cost varies.
+    uint64_t typical_cycles = 0;    // Average of the directions of the branches, typical cost of the instructions.
+    uint64_t max_cycles     = 0;    // All blocks (divergent wavefront), highest cost of the instructions whose cost varies.
+};
+
 } // namespace beKA
 
 #endif // RGA_RADEONGPUANALYZERBACKEND_SRC_BE_INCLUDE_H_
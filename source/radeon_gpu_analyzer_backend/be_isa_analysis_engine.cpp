@@ -0,0 +1,834 @@
+//=============================================================================
+/// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Implementation for the in-process ISA static analysis engine (control flow graph and live registers).
+//=============================================================================
+
+// C++.
+#include <algorithm>
+#include <bitset>
+#include <cctype>
+#include <charconv>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+
+// Shared.
+#include "common/rga_shared_utils.h"
+
+// Local.
+#include "radeon_gpu_analyzer_backend/be_isa_analysis_engine.h"
+#include "emulator/parser/be_isa_parser.h"
+
+using namespace beKA;
+
+// Opcode of the padding at the end of the code, which is not part of the program.
+static const std::string_view kCodeEndPadding = "s_code_end";
+
+// Registers with a higher index are ignored (no register file is that large).
+static const int kMaxRegisterCount = 1024;
+
+// Number of registers in a wave's register file, as reported in the analysis file.
+static const int kVgprsTotal     = 256;
+static const int kSgprsTotalGfx9 = 102;
+static const int kSgprsTotal     = 106;
+
+// SGPR allocation granularity on GFX9 targets (other targets do not round the SGPR allocation).
+static const int kSgprGranularityGfx9 = 16;
+
+// Prefix of the generated names of blocks that do not start with a label.
+static const char* kStrCfgBlockNamePrefix = "basic_block_";
+
+// Prefix of the labels in the disassembly. Labels are reported without it.
+static const std::string_view kLabelPrefix = "label_";
+
+// Encoding suffixes that are not reported as part of the opcode.
+static const std::string_view kEncodingSuffixes[] = {"_e32", "_e64"};
+
+// Opcode prefixes of instructions that only read their operands.
+static const std::string_view kNoDefinitionPrefixes[] = {
+    "s_cmp", "s_bitcmp", "s_setpc", "s_setreg", "s_store", "s_buffer_store", "s_scratch_store", "s_cbranch", "s_branch",
+    "s_sendmsg", "s_waitcnt", "s_set_gpr_idx_on", "s_ttracedata", "s_dcache_discard", "s_atc_probe", "exp",
+    "buffer_store", "tbuffer_store", "global_store", "flat_store", "scratch_store", "image_store", "global_load_lds"};
+
+// Opcode prefixes of LDS/GDS instructions that return a value (in addition to the "_rtn" variants).
+static const std::string_view kDsReturnPrefixes[] = {
+    "ds_read", "ds_load", "ds_swizzle", "ds_permute", "ds_bpermute", "ds_append", "ds_consume", "ds_ordered_count"};
+
+// Opcode prefixes of vector instructions that may write a carry-out or condition SGPR after the destination VGPR.
+static const std::string_view kCarryOutPrefixes[] = {
+    "v_add_co_", "v_sub_co_", "v_subrev_co_", "v_addc_", "v_subb_", "v_subbrev_", "v_div_scale_", "v_mad_u64_u32",
+    "v_mad_i64_i32", "v_mad_co_u64_u32", "v_mad_co_i64_i32", "v_add_u32", "v_sub_u32", "v_subrev_u32", "v_add_i32",
+    "v_sub_i32", "v_subrev_i32"};
+
+// Opcode prefixes of instructions that read their destination before writing it.
+static const std::string_view kDestinationReadPrefixes[] = {
+    "v_mac_", "v_fmac_", "v_pk_fmac_", "v_dot2c_", "v_dot4c_", "v_dot8c_", "v_writelane_", "v_interp_p2_", "v_permlane",
+    "v_swap", "s_cmov_", "s_cmovk_", "s_addk_", "s_mulk_", "s_bitset0_", "s_bitset1_"};
+
+// The registers of one register file that an instruction reads and writes.
+struct RegisterAccess
+{
+    std::vector<int> defs;
+    std::vector<int> uses;
+};
+
+// A set of registers of one register file.
+class RegisterSet
+{
+public:
+    explicit RegisterSet(size_t register_count = 0) : words_((register_count + 63) / 64, 0) {}
+
+    void Insert(int reg) { words_[reg / 64] |= (uint64_t(1) << (reg % 64)); }
+
+    void Erase(int reg) { words_[reg / 64] &= ~(uint64_t(1) << (reg % 64)); }
+
+    bool Contains(int reg) const { return (words_[reg / 64] & (uint64_t(1) << (reg % 64))) != 0; }
+
+    // Add the registers of the other set. Returns true if the set changed.
+    bool InsertAll(const RegisterSet& other)
+    {
+        bool is_changed = false;
+        for (size_t i = 0; i < words_.size(); i++)
+        {
+            const uint64_t merged = words_[i] | other.words_[i];
+            is_changed |= (merged != words_[i]);
+            words_[i] = merged;
+        }
+        return is_changed;
+    }
+
+    // Remove the registers of the other set.
+    void EraseAll(const RegisterSet& other)
+    {
+        for (size_t i = 0; i < words_.size(); i++)
+        {
+            words_[i] &= ~other.words_[i];
+        }
+    }
+
+    int Count() const
+    {
+        size_t count = 0;
+        for (uint64_t word : words_)
+        {
+            count += std::bitset<64>(word).count();
+        }
+        return static_cast<int>(count);
+    }
+
+private:
+    std::vector<uint64_t> words_;
+};
+
+static bool StartsWith(std::string_view text, std::string_view prefix)
+{
+    return text.substr(0, prefix.size()) == prefix;
+}
+
+template <size_t N>
+static bool StartsWithAny(std::string_view text, const std::string_view (&prefixes)[N])
+{
+    return std::any_of(prefixes, prefixes + N, [&](std::string_view prefix) { return StartsWith(text, prefix); });
+}
+
+static bool IsWordChar(char c)
+{
+    return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+}
+
+static std::string_view Trim(std::string_view text)
+{
+    const size_t first = text.find_first_not_of(" \t\r\n");
+    const size_t last  = text.find_last_not_of(" \t\r\n");
+    return (first == std::string_view::npos ? std::string_view() : text.substr(first, last - first + 1));
+}
+
+// Returns true if the text contains the given word (not as a part of a longer word).
+static bool ContainsWord(std::string_view text, std::string_view word)
+{
+    bool   ret = false;
+    size_t pos = text.find(word);
+    while (!ret && pos != std::string_view::npos)
+    {
+        const size_t end = pos + word.size();
+        ret = (pos == 0 || !IsWordChar(text[pos - 1])) && (end == text.size() || !IsWordChar(text[end]));
+        pos = text.find(word, pos + 1);
+    }
+    return ret;
+}
+
+// Returns true if the ISA has to be parsed as if it was enclosed by the HSAIL disassembly tokens,
+// which is the case for disassembly that does not carry any of the section tokens that the parser looks for.
+static bool IsHsailTokensImplied(std::string_view isa)
+{
+    return isa.find("Disassembly --------------------") == std::string_view::npos &&
+           isa.find(kStrHsailDisassemblyTokenStart) == std::string_view::npos && !StartsWith(isa, "shader ") &&
+           isa.find("\nshader ") == std::string_view::npos;
+}
+
+BeIsaProgram::BeIsaProgram() = default;
+
+BeIsaProgram::~BeIsaProgram() = default;
+
+// Add the parsed instructions to the program, with each label attached to the instruction that follows it.
+// A label that is not followed by an instruction is carried over to the next call.
+static void AddInstructions(const std::vector<Instruction*>&      parsed_instructions,
+                            std::string_view&                     label,
+                            std::vector<BeIsaProgramInstruction>& instructions)
+{
+    for (const Instruction* instruction : parsed_instructions)
+    {
+        std::string_view pointing_label = Trim(instruction->GetPointingLabelString());
+        if (!pointing_label.empty())
+        {
+            // A label line: attach the label to the next instruction.
+            if (pointing_label.back() == ':')
+            {
+                pointing_label.remove_suffix(1);
+            }
+            if (StartsWith(pointing_label, kLabelPrefix))
+            {
+                pointing_label.remove_prefix(kLabelPrefix.size());
+            }
+            label = pointing_label;
+        }
+        else if (!instruction->GetInstructionOpCode().empty() &&
+                 instruction->GetInstructionOpCode().find(kCodeEndPadding) == std::string_view::npos)
+        {
+            std::string_view opcode = instruction->GetInstructionOpCode();
+            for (std::string_view suffix : kEncodingSuffixes)
+            {
+                if (opcode.size() > suffix.size() && opcode.substr(opcode.size() - suffix.size()) == suffix)
+                {
+                    opcode.remove_suffix(suffix.size());
+                }
+            }
+            instructions.push_back({label, opcode, Trim(instruction->GetInstructionParameters())});
+            label = std::string_view();
+        }
+    }
+}
+
+bool BeIsaProgram::Parse(std::string_view isa)
+{
+    isa_    = isa;
+    parser_ = std::make_unique<ParserIsa>();
+    instructions_.clear();
+    blocks_.clear();
+
+    bool ret = parser_->Parse(isa, IsHsailTokensImplied(isa));
+    if (ret)
+    {
+        // Take the instructions of every block of the program graph. The graph blocks that are left without
+        // instructions (a label that is followed by another label, or the padding at the end of the code) are dropped.
+        const std::vector<IsaCodeBlock>& graph_blocks = parser_->GetProgramGraph().GetBlocks();
+        std::vector<int>                 program_blocks(graph_blocks.size(), kNoBlock);
+        std::vector<size_t>              block_graph_blocks;
+        std::string_view                 label;
+        for (size_t i = 0; i < graph_blocks.size(); i++)
+        {
+            const size_t first = instructions_.size();
+            AddInstructions(graph_blocks[i].GetIsaCodeBlockInstructions(), label, instructions_);
+            if (instructions_.size() > first)
+            {
+                program_blocks[i] = static_cast<int>(blocks_.size());
+                block_graph_blocks.push_back(i);
+                BeIsaProgramBlock block;
+                block.first = first;
+                block.end   = instructions_.size();
+                blocks_.push_back(block);
+            }
+        }
+
+        // The program block that the given graph block leads to. A dropped block falls through to the next graph block.
+        auto get_program_block = [&](int graph_block) {
+            while (graph_block != kNoBlock && program_blocks[graph_block] == kNoBlock)
+            {
+                graph_block = graph_blocks[graph_block].GetNext();
+            }
+            return (graph_block != kNoBlock ? program_blocks[graph_block] : kNoBlock);
+        };
+
+        // Link the blocks: the branch target first, then the fall-through block.
+        for (size_t i = 0; i < blocks_.size(); i++)
+        {
+            const IsaCodeBlock& graph_block = graph_blocks[block_graph_blocks[i]];
+            const int           next        = get_program_block(graph_block.GetNext());
+            const int           target      = get_program_block(graph_block.GetTrue());
+            const int           fall        = get_program_block(graph_block.GetFalse());
+            for (int successor : {target, fall, next})
+            {
+                std::vector<size_t>& successors = blocks_[i].successors;
+                if (successor != kNoBlock && std::find(successors.begin(), successors.end(), successor) == successors.end())
+                {
+                    successors.push_back(successor);
+                }
+            }
+
+            // The program ends after the block if it does not continue, or if one side of its conditional branch leaves the program.
+            blocks_[i].is_exit = (next == kNoBlock && (target == kNoBlock || fall == kNoBlock));
+        }
+        ret = !instructions_.empty();
+    }
+
+    return ret;
+}
+
+static size_t ParseRegisterIndex(std::string_view text, size_t pos, int& index)
+{
+    index = -1;
+    auto result = std::from_chars(text.data() + pos, text.data() + text.size(), index);
+    if (result.ec != std::errc())
+    {
+        index = -1;
+    }
+    return static_cast<size_t>(result.ptr - text.data());
+}
+
+// Append the registers of the register file with the given prefix ('v' or 's') that the operand references,
+// for example "v7", "s[4:7]" or "-|v[2:3]|".
+static void ExtractRegisters(std::string_view operand, char prefix, std::vector<int>& registers)
+{
+    for (size_t i = 0; i + 1 < operand.size(); i++)
+    {
+        if (operand[i] == prefix && (i == 0 || !IsWordChar(operand[i - 1])))
+        {
+            int    first = -1;
+            int    last  = -1;
+            size_t pos   = i + 1;
+            if (std::isdigit(static_cast<unsigned char>(operand[pos])))
+            {
+                pos  = ParseRegisterIndex(operand, pos, first);
+                last = first;
+            }
+            else if (operand[pos] == '[')
+            {
+                pos  = ParseRegisterIndex(operand, pos + 1, first);
+                last = first;
+                if (pos < operand.size() && operand[pos] == ':')
+                {
+                    pos = ParseRegisterIndex(operand, pos + 1, last);
+                }
+                if (pos < operand.size() && operand[pos] == ']')
+                {
+                    pos++;
+                }
+                else
+                {
+                    first = -1;
+                }
+            }
+
+            if (first >= 0 && last >= first && last < kMaxRegisterCount && (pos == operand.size() || !IsWordChar(operand[pos])))
+            {
+                for (int reg = first; reg <= last; reg++)
+                {
+                    registers.push_back(reg);
+                }
+            }
+        }
+    }
+}
+
+// Split the operand list at the commas that are not enclosed by brackets or parentheses.
+static void SplitOperands(std::string_view operands, std::vector<std::string_view>& split_operands)
+{
+    int    depth = 0;
+    size_t start = 0;
+    for (size_t i = 0; i < operands.size(); i++)
+    {
+        const char c = operands[i];
+        if (c == '[' || c == '(')
+        {
+            depth++;
+        }
+        else if ((c == ']' || c == ')') && depth > 0)
+        {
+            depth--;
+        }
+        else if (c == ',' && depth == 0)
+        {
+            split_operands.push_back(operands.substr(start, i - start));
+            start = i + 1;
+        }
+    }
+    if (!Trim(operands).empty())
+    {
+        split_operands.push_back(operands.substr(start));
+    }
+}
+
+// Returns the number of leading operands that the instruction writes.
+static size_t GetDefinedOperandCount(std::string_view opcode, std::string_view operands, size_t operand_count)
+{
+    size_t ret = 1;
+    if (operand_count == 0 || StartsWithAny(opcode, kNoDefinitionPrefixes))
+    {
+        ret = 0;
+    }
+    else if (opcode.find("_atomic") != std::string_view::npos)
+    {
+        // Atomics return the original value only if requested.
+        const bool is_returning = opcode.find("_rtn") != std::string_view::npos || ContainsWord(operands, "glc") ||
+                                  ContainsWord(operands, "sc0") || operands.find("TH_ATOMIC_RETURN") != std::string_view::npos;
+        ret = (is_returning ? 1 : 0);
+    }
+    else if (StartsWith(opcode, "ds_"))
+    {
+        const bool is_returning = opcode.find("_rtn") != std::string_view::npos || StartsWithAny(opcode, kDsReturnPrefixes);
+        ret = (is_returning ? 1 : 0);
+    }
+    else if (StartsWith(opcode, "v_cmpx_"))
+    {
+        // Before GFX10, v_cmpx also writes an SGPR destination. Later, it only writes EXEC.
+        ret = (operand_count >= 3 ? 1 : 0);
+    }
+    else if ((StartsWithAny(opcode, kCarryOutPrefixes) && operand_count >= 4) || StartsWith(opcode, "v_swap"))
+    {
+        ret = 2;
+    }
+    return ret;
+}
+
+// Collect the registers of the register file with the given prefix that the instruction reads and writes.
+static void GetRegisterAccess(std::string_view opcode, std::string_view operands, char prefix, RegisterAccess& access)
+{
+    const size_t dual_separator = operands.find("::");
+    if (StartsWith(opcode, "v_dual_") && dual_separator != std::string_view::npos)
+    {
+        // A dual-issue instruction: "v_dual_<op> <operands> :: v_dual_<op> <operands>".
+        GetRegisterAccess(opcode, operands.substr(0, dual_separator), prefix, access);
+        std::string_view second           = Trim(operands.substr(dual_separator + 2));
+        const size_t     opcode_end       = std::min(second.find_first_of(" \t"), second.size());
+        GetRegisterAccess(second.substr(0, opcode_end), second.substr(opcode_end), prefix, access);
+    }
+    else
+    {
+        std::vector<std::string_view> split_operands;
+        SplitOperands(operands, split_operands);
+
+        const size_t def_count        = GetDefinedOperandCount(opcode, operands, split_operands.size());
+        const bool   is_dest_read     = StartsWithAny(opcode, kDestinationReadPrefixes);
+        const bool   is_partial_write = opcode.find("_d16") != std::string_view::npos;
+        for (size_t i = 0; i < split_operands.size(); i++)
+        {
+            if (i < def_count)
+            {
+                ExtractRegisters(split_operands[i], prefix, access.defs);
+            }
+            if (i >= def_count || is_dest_read || is_partial_write)
+            {
+                ExtractRegisters(split_operands[i], prefix, access.uses);
+            }
+        }
+    }
+}
+
+// Deduce the wave size from the names of the special registers in the disassembly.
+static beWaveSize DetectWaveSize(std::string_view isa)
+{
+    beWaveSize ret = kWave32;
+    if (isa.find("exec_lo") == std::string_view::npos && isa.find("vcc_lo") == std::string_view::npos &&
+        (ContainsWord(isa, "exec") || ContainsWord(isa, "vcc")))
+    {
+        ret = kWave64;
+    }
+    return ret;
+}
+
+// Fill the register file properties of the given target.
+static void SetRegisterFileInfo(const std::string& target, BeLiveRegAnalysis& analysis)
+{
+    if (analysis.is_reg_type_sgpr)
+    {
+        const bool is_gfx9 = RgaSharedUtils::IsVegaTarget(target);
+        analysis.registers_total        = (is_gfx9 ? kSgprsTotalGfx9 : kSgprsTotal);
+        analysis.allocation_granularity = (is_gfx9 ? kSgprGranularityGfx9 : 0);
+    }
+    else
+    {
+        int granularity = 4;
+        if (RgaSharedUtils::IsNaviTarget(target))
+        {
+            granularity = 8;
+            if (RgaSharedUtils::IsNavi21AndBeyond(target))
+            {
+                // Targets with the larger register file allocate VGPRs in larger blocks.
+                const bool is_large_register_file = (target == "gfx1100" || target == "gfx1101" || target == "gfx1151" ||
+                                                     target == "gfx1200" || target == "gfx1201");
+                granularity = (is_large_register_file ? 24 : 16);
+            }
+            if (analysis.wave_size == kWave64)
+            {
+                granularity /= 2;
+            }
+        }
+        else if (RgaSharedUtils::IsMi200Target(target) || RgaSharedUtils::IsMi300Target(target))
+        {
+            granularity = 8;
+        }
+        analysis.registers_total        = kVgprsTotal;
+        analysis.allocation_granularity = granularity;
+    }
+
+    analysis.registers_allocated = analysis.registers_requested;
+    if (analysis.allocation_granularity > 0)
+    {
+        analysis.registers_allocated = (analysis.registers_requested + analysis.allocation_granularity - 1) /
+                                       analysis.allocation_granularity * analysis.allocation_granularity;
+    }
+}
+
+// Escape the text so that it can be used in a quoted GraphViz string.
+static std::string EscapeDotText(std::string_view text)
+{
+    std::string ret;
+    ret.reserve(text.size());
+    for (char c : text)
+    {
+        if (c == '"' || c == '\\')
+        {
+            ret.push_back('\\');
+        }
+        ret.push_back(c);
+    }
+    return ret;
+}
+
+static std::string GetInstructionText(std::string_view opcode, std::string_view operands)
+{
+    std::string ret(opcode);
+    if (!operands.empty())
+    {
+        ret.append(" ").append(operands);
+    }
+    return ret;
+}
+
+// The operands as shae reports them in the live register analysis: without the modifiers that follow the last operand.
+static std::string_view GetReportedOperands(std::string_view opcode, std::string_view operands)
+{
+    std::string_view ret = operands;
+    if (!StartsWith(opcode, "v_dual_"))
+    {
+        const size_t last_separator = ret.rfind(',');
+        const size_t last_start     = ret.find_first_not_of(" \t", (last_separator == std::string_view::npos ? 0 : last_separator + 1));
+        const size_t last_end       = (last_start == std::string_view::npos ? last_start : ret.find_first_of(" \t", last_start));
+        if (last_end != std::string_view::npos)
+        {
+            ret = ret.substr(0, last_end);
+        }
+    }
+    return ret;
+}
+
+beStatus BeIsaAnalysisEngine::BuildControlFlowGraph(const BeIsaProgram& isa_program, BeControlFlowGraph& cfg)
+{
+    beStatus                                    ret     = kBeStatusStaticIsaAnalysisFailed;
+    const std::vector<BeIsaProgramInstruction>& program = isa_program.GetInstructions();
+    const std::vector<BeIsaProgramBlock>&       blocks  = isa_program.GetBlocks();
+    cfg.blocks.clear();
+
+    if (!program.empty())
+    {
+        cfg.blocks.resize(blocks.size());
+        for (size_t i = 0; i < blocks.size(); i++)
+        {
+            const BeIsaProgramBlock& block     = blocks[i];
+            BeCfgBlock&              cfg_block = cfg.blocks[i];
+            const auto&              label     = program[block.first].label;
+
+            cfg_block.name = (label.empty() ? kStrCfgBlockNamePrefix + std::to_string(i + 1) : std::string(label));
+            for (size_t j = block.first; j < block.end; j++)
+            {
+                cfg_block.instructions.push_back(GetInstructionText(program[j].opcode, program[j].operands));
+            }
+            cfg_block.successors = block.successors;
+            cfg_block.is_exit    = block.is_exit;
+        }
+        ret = kBeStatusSuccess;
+    }
+
+    return ret;
+}
+
+beStatus BeIsaAnalysisEngine::AnalyzeLiveRegisters(const BeIsaProgram& isa_program,
+                                                   const std::string&  target,
+                                                   beWaveSize          wave_size,
+                                                   bool                is_reg_type_sgpr,
+                                                   BeLiveRegAnalysis&  analysis)
+{
+    beStatus                                    ret     = kBeStatusStaticIsaAnalysisFailed;
+    const std::vector<BeIsaProgramInstruction>& program = isa_program.GetInstructions();
+    analysis = BeLiveRegAnalysis();
+
+    if (!program.empty())
+    {
+        // Wave32 is only supported on RDNA targets.
+        analysis.is_reg_type_sgpr = is_reg_type_sgpr;
+        analysis.wave_size        = wave_size;
+        if (!RgaSharedUtils::IsNaviTarget(target))
+        {
+            analysis.wave_size = kWave64;
+        }
+        else if (analysis.wave_size == kUnknown)
+        {
+            analysis.wave_size = DetectWaveSize(isa_program.GetIsa());
+        }
+
+        // Collect the registers that each instruction accesses.
+        const char                  register_prefix = (is_reg_type_sgpr ? 's' : 'v');
+        std::vector<RegisterAccess> accesses(program.size());
+        int                         register_count = 0;
+        for (size_t i = 0; i < program.size(); i++)
+        {
+            GetRegisterAccess(program[i].opcode, program[i].operands, register_prefix, accesses[i]);
+            for (int reg : accesses[i].defs)
+            {
+                register_count = std::max(register_count, reg + 1);
+            }
+            for (int reg : accesses[i].uses)
+            {
+                register_count = std::max(register_count, reg + 1);
+            }
+        }
+
+        // Registers that each block reads before writing them, and registers that each block writes.
+        const std::vector<BeIsaProgramBlock>& blocks = isa_program.GetBlocks();
+        std::vector<RegisterSet>              block_uses(blocks.size(), RegisterSet(register_count));
+        std::vector<RegisterSet>              block_defs(blocks.size(), RegisterSet(register_count));
+        for (size_t i = 0; i < blocks.size(); i++)
+        {
+            for (size_t j = blocks[i].end; j-- > blocks[i].first;)
+            {
+                for (int reg : accesses[j].defs)
+                {
+                    block_uses[i].Erase(reg);
+                    block_defs[i].Insert(reg);
+                }
+                for (int reg : accesses[j].uses)
+                {
+                    block_uses[i].Insert(reg);
+                }
+            }
+        }
+
+        // Iterate the backward data flow equations until the live-in sets are stable.
+        std::vector<RegisterSet> live_in(block_uses);
+        std::vector<RegisterSet> live_out(blocks.size(), RegisterSet(register_count));
+        bool                     is_changed = true;
+        while (is_changed)
+        {
+            is_changed = false;
+            for (size_t i = blocks.size(); i-- > 0;)
+            {
+                for (size_t successor : blocks[i].successors)
+                {
+                    live_out[i].InsertAll(live_in[successor]);
+                }
+                RegisterSet block_live_in(live_out[i]);
+                block_live_in.EraseAll(block_defs[i]);
+                block_live_in.InsertAll(block_uses[i]);
+                is_changed |= live_in[i].InsertAll(block_live_in);
+            }
+        }
+
+        // Walk each block backwards to compute the liveness of every instruction.
+        analysis.instructions.resize(program.size());
+        for (size_t i = 0; i < blocks.size(); i++)
+        {
+            RegisterSet live(live_out[i]);
+            for (size_t j = blocks[i].end; j-- > blocks[i].first;)
+            {
+                RegisterSet defs(register_count);
+                RegisterSet uses(register_count);
+                for (int reg : accesses[j].defs)
+                {
+                    defs.Insert(reg);
+                }
+                for (int reg : accesses[j].uses)
+                {
+                    uses.Insert(reg);
+                }
+
+                // The registers that are live while the instruction executes: live before it or after it.
+                // Like shae, a register that the instruction writes but that is never read is not counted.
+                RegisterSet instruction_live_in(live);
+                instruction_live_in.EraseAll(defs);
+                instruction_live_in.InsertAll(uses);
+                RegisterSet occupied(instruction_live_in);
+                occupied.InsertAll(live);
+
+                BeLiveRegInstruction& result = analysis.instructions[j];
+                result.label                 = program[j].label;
+                result.opcode                = program[j].opcode;
+                result.operands              = program[j].operands;
+                result.live_register_count   = occupied.Count();
+                result.register_usage.assign(register_count, ' ');
+                for (int reg = 0; reg < register_count; reg++)
+                {
+                    const bool is_def = defs.Contains(reg);
+                    const bool is_use = uses.Contains(reg);
+                    if (is_def && is_use)
+                    {
+                        result.register_usage[reg] = 'x';
+                    }
+                    else if (is_def)
+                    {
+                        result.register_usage[reg] = '^';
+                    }
+                    else if (is_use)
+                    {
+                        result.register_usage[reg] = 'v';
+                    }
+                    else if (live.Contains(reg) || instruction_live_in.Contains(reg))
+                    {
+                        result.register_usage[reg] = ':';
+                    }
+                }
+                analysis.max_live_registers = std::max(analysis.max_live_registers, result.live_register_count);
+                live                        = instruction_live_in;
+            }
+        }
+
+        analysis.registers_requested = register_count;
+        SetRegisterFileInfo(target, analysis);
+        ret = kBeStatusSuccess;
+    }
+
+    return ret;
+}
+
+beStatus BeIsaAnalysisEngine::WriteLiveRegisterAnalysis(const BeLiveRegAnalysis& analysis, const std::string& output_filename)
+{
+    beStatus      ret = kBeStatusWriteToFileFailed;
+    std::ofstream output(output_filename);
+    if (output.good())
+    {
+        const char*       reg_type = (analysis.is_reg_type_sgpr ? "SGPR" : "VGPR");
+        const std::string blank_usage(analysis.registers_requested, ' ');
+
+        output << "Legend:\n"
+               << "  ':' means that the register is kept alive, while it is not actively being used by the current instruction\n"
+               << "  '^' means that the current instruction writes to the register\n"
+               << "  'v' means that the current instruction reads from the register\n"
+               << "  'x' means that the current instruction both reads from the register and writes to it\n"
+               << " 'Rn': Number of live registers\n\n";
+        output << "  Line | Rn  | " << blank_usage << " | Instruction\n" << std::string(80, '-') << '\n';
+
+        int line_number = 1;
+        for (const BeLiveRegInstruction& instruction : analysis.instructions)
+        {
+            output << std::setw(6) << line_number++ << " | " << std::setw(3) << instruction.live_register_count << " | "
+                   << instruction.register_usage << " | ";
+            if (!instruction.label.empty())
+            {
+                output << kLabelPrefix << instruction.label << ": ";
+            }
+            output << GetInstructionText(instruction.opcode, GetReportedOperands(instruction.opcode, instruction.operands)) << '\n';
+        }
+
+        output << '\n';
+        if (analysis.max_live_registers == 0)
+        {
+            output << "No " << reg_type << "s used\n\n";
+        }
+        else if (analysis.allocation_granularity > 0)
+        {
+            output << "Maximum # " << reg_type << " used " << std::setw(3) << analysis.max_live_registers << ", " << reg_type
+                   << "s allocated by HW: " << std::setw(3) << analysis.registers_allocated << " (" << analysis.registers_requested
+                   << " requested)\n";
+        }
+        else
+        {
+            output << "Maximum # " << reg_type << " used " << std::setw(3) << analysis.max_live_registers << ", " << reg_type
+                   << "s allocated : " << std::setw(3) << analysis.registers_allocated << '\n';
+        }
+
+        output << "\nArchitecture info:\n  " << reg_type << "s total: " << analysis.registers_total << '\n';
+        if (analysis.allocation_granularity > 0)
+        {
+            output << "  " << reg_type << " allocation granularity: " << analysis.allocation_granularity << '\n';
+        }
+
+        output.close();
+        if (!output.fail())
+        {
+            ret = kBeStatusSuccess;
+        }
+    }
+    return ret;
+}
+
+beStatus BeIsaAnalysisEngine::WriteControlFlowGraph(const BeControlFlowGraph& cfg, bool is_per_instruction, const std::string& output_filename)
+{
+    beStatus      ret = kBeStatusWriteToFileFailed;
+    std::ofstream output(output_filename);
+    if (output.good())
+    {
+        // Node name of the given instruction of the given block (the block's node in the per-block graph).
+        auto node_name = [&](size_t block, size_t instruction) {
+            std::string name = "\"n_" + EscapeDotText(cfg.blocks[block].name);
+            if (is_per_instruction)
+            {
+                name.append("_").append(std::to_string(instruction));
+            }
+            return name + "\"";
+        };
+
+        output << "digraph {\nnode [shape=box]\n\"n_entry\" [ label= \"entry\n\" style=rounded]\n";
+        for (size_t i = 0; i < cfg.blocks.size(); i++)
+        {
+            const BeCfgBlock& block = cfg.blocks[i];
+            if (is_per_instruction)
+            {
+                for (size_t j = 0; j < block.instructions.size(); j++)
+                {
+                    output << node_name(i, j) << " [label=\"" << EscapeDotText(block.instructions[j]) << "\"]\n";
+                    if (j > 0)
+                    {
+                        output << node_name(i, j - 1) << ":s -> " << node_name(i, j) << ";\n";
+                    }
+                }
+            }
+            else
+            {
+                output << node_name(i, 0) << " [ label= \"" << EscapeDotText(block.name) << '\n';
+                for (const std::string& instruction : block.instructions)
+                {
+                    output << EscapeDotText(instruction) << "\\l";
+                }
+                output << "\" ]\n";
+            }
+        }
+        output << "\"n_exit\" [ label= \"exit\n\" style=rounded]\n";
+
+        // Edges between blocks leave the last instruction of a block and enter the first instruction of its successor.
+        if (!cfg.blocks.empty())
+        {
+            output << "\"n_entry\":s -> " << node_name(0, 0) << ";\n";
+        }
+        for (size_t i = 0; i < cfg.blocks.size(); i++)
+        {
+            const size_t last = (cfg.blocks[i].instructions.empty() ? 0 : cfg.blocks[i].instructions.size() - 1);
+            for (size_t successor : cfg.blocks[i].successors)
+            {
+                output << node_name(i, last) << ":s -> " << node_name(successor, 0) << ";\n";
+            }
+            if (cfg.blocks[i].is_exit)
+            {
+                output << node_name(i, last) << ":s -> \"n_exit\";\n";
+            }
+        }
+        output << "}\n";
+
+        output.close();
+        if (!output.fail())
+        {
+            ret = kBeStatusSuccess;
+        }
+    }
+    return ret;
+}
@@ -0,0 +1,181 @@
+//=============================================================================
+/// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Header for the in-process ISA static analysis engine (control flow graph and live registers).
+//=============================================================================
+
+#ifndef RGA_RADEONGPUANALYZERBACKEND_SRC_BE_ISA_ANALYSIS_ENGINE_H_
+#define RGA_RADEONGPUANALYZERBACKEND_SRC_BE_ISA_ANALYSIS_ENGINE_H_
+
+// C++.
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Local.
+#include "radeon_gpu_analyzer_backend/be_data_types.h"
+#include "radeon_gpu_analyzer_backend/be_include.h"
+
+class ParserIsa;
+
+namespace beKA
+{
+    // An instruction of a parsed ISA program. The text refers to the storage of the program.
+    struct BeIsaProgramInstruction
+    {
+        // The label that precedes the instruction (empty if there is none).
+        std::string_view label;
+
+        // The instruction's opcode.
+        std::string_view opcode;
+
+        // The instruction's operands.
+        std::string_view operands;
+    };
+
+    // A basic block of a parsed ISA program.
+    struct BeIsaProgramBlock
+    {
+        // Index of the first instruction of the block.
+        size_t first = 0;
+
+        // Index of the instruction that follows the last instruction of the block.
+        size_t end = 0;
+
+        // Indices of the successor blocks. A branch target precedes the fall-through block.
+        std::vector<size_t> successors;
+
+        // True if the program may end after this block.
+        bool is_exit = false;
+    };
+
+    // ISA disassembly parsed for analysis. A file is parsed once, and all of its analyses run on the parsed program.
+    class BeIsaProgram
+    {
+    public:
+        BeIsaProgram();
+        ~BeIsaProgram();
+
+        // Parse the given ISA disassembly, which must outlive the program, and take its blocks from the program graph of the parser.
+        // Returns false if the parser cannot build the program graph of the disassembly, or if it has no instructions.
+        bool Parse(std::string_view isa);
+
+        // The parsed ISA disassembly.
+        std::string_view GetIsa() const { return isa_; }
+
+        // The program's instructions, in program order.
+        const std::vector<BeIsaProgramInstruction>& GetInstructions() const { return instructions_; }
+
+        // The program's basic blocks. The first block is the entry block.
+        const std::vector<BeIsaProgramBlock>& GetBlocks() const { return blocks_; }
+
+    private:
+        std::string_view                     isa_;
+        std::unique_ptr<ParserIsa>           parser_;
+        std::vector<BeIsaProgramInstruction> instructions_;
+        std::vector<BeIsaProgramBlock>       blocks_;
+    };
+
+    // Live register information of a single instruction.
+    struct BeLiveRegInstruction
+    {
+        // The label that precedes the instruction (empty if there is none).
+        std::string label;
+
+        // The instruction's opcode.
+        std::string opcode;
+
+        // The instruction's operands.
+        std::string operands;
+
+        // Number of registers that are live while the instruction executes.
+        int live_register_count = 0;
+
+        // The usage of each register by the instruction, one character per register:
+        // ' ' - dead, ':' - live but not accessed, '^' - written, 'v' - read, 'x' - read and written.
+        std::string register_usage;
+    };
+
+    // Results of a live register analysis.
+    struct BeLiveRegAnalysis
+    {
+        // True for SGPR analysis, false for VGPR analysis.
+        bool is_reg_type_sgpr = false;
+
+        // The wave size that the analysis assumed.
+        beWaveSize wave_size = kUnknown;
+
+        // Per-instruction liveness, in program order.
+        std::vector<BeLiveRegInstruction> instructions;
+
+        // The maximum number of registers that are live at any instruction.
+        int max_live_registers = 0;
+
+        // The number of registers that the program references (highest referenced register + 1).
+        int registers_requested = 0;
+
+        // The number of registers that the hardware allocates for the program.
+        int registers_allocated = 0;
+
+        // The total number of registers that are available to a wave.
+        int registers_total = 0;
+
+        // The register allocation granularity (0 if the allocation is not rounded to blocks).
+        int allocation_granularity = 0;
+    };
+
+    // A basic block of a control flow graph.
+    struct BeCfgBlock
+    {
+        // The label of the block, or a generated name if the block does not start with a label.
+        std::string name;
+
+        // The text of the block's instructions.
+        std::vector<std::string> instructions;
+
+        // Indices of the successor blocks. A branch target precedes the fall-through block.
+        std::vector<size_t> successors;
+
+        // True if the program may end after this block.
+        bool is_exit = false;
+    };
+
+    // A control flow graph. The first block is the entry block.
+    struct BeControlFlowGraph
+    {
+        std::vector<BeCfgBlock> blocks;
+    };
+
+    // Static analysis of ISA disassembly that runs in-process on the instructions and the program graph built by ParserIsa,
+    // without launching an external analyzer. The results are returned as structured data, and can be
+    // serialized to the same files that the external analyzer produces.
+    class BeIsaAnalysisEngine
+    {
+    public:
+        // Build the control flow graph of the given parsed program.
+        static beStatus BuildControlFlowGraph(const BeIsaProgram& program, BeControlFlowGraph& cfg);
+
+        // Perform live register analysis on the given parsed program for the given target.
+        // If wave_size is kUnknown, the wave size is deduced from the disassembly.
+        static beStatus AnalyzeLiveRegisters(const BeIsaProgram& program,
+                                             const std::string&  target,
+                                             beWaveSize          wave_size,
+                                             bool                is_reg_type_sgpr,
+                                             BeLiveRegAnalysis&  analysis);
+
+        // Write the live register analysis to a text file.
+        static beStatus WriteLiveRegisterAnalysis(const BeLiveRegAnalysis& analysis, const std::string& output_filename);
+
+        // Write the control flow graph to a file in GraphViz (dot) format, with a node per block or a node per instruction.
+        static beStatus WriteControlFlowGraph(const BeControlFlowGraph& cfg, bool is_per_instruction, const std::string& output_filename);
+
+    private:
+        // No instances.
+        BeIsaAnalysisEngine()  = delete;
+        ~BeIsaAnalysisEngine() = delete;
+    };
+}
+
+#endif // RGA_RADEONGPUANALYZERBACKEND_SRC_BE_ISA_ANALYSIS_ENGINE_H_
@@ -0,0 +1,112 @@
+//=============================================================================
+/// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Implementation for a read-only memory-mapped file.
+//=============================================================================
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Local.
+#include "radeon_gpu_analyzer_backend/be_mapped_file.h"
+
+BeMappedFile::~BeMappedFile()
+{
+    Close();
+}
+
+bool BeMappedFile::Open(const std::string& filename)
+{
+    bool ret = false;
+    Close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file != INVALID_HANDLE_VALUE)
+    {
+        LARGE_INTEGER file_size;
+        if (GetFileSizeEx(file, &file_size))
+        {
+            if (file_size.QuadPart == 0)
+            {
+                // Empty files cannot be mapped.
+                ret = true;
+            }
+            else
+            {
+                HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                if (mapping != nullptr)
+                {
+                    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                    if (view != nullptr)
+                    {
+                        data_           = static_cast<const char*>(view);
+                        size_           = static_cast<size_t>(file_size.QuadPart);
+                        mapping_handle_ = mapping;
+                        ret             = true;
+                    }
+                    else
+                    {
+                        CloseHandle(mapping);
+                    }
+                }
+            }
+        }
+
+        // The mapping keeps its own reference to the file.
+        CloseHandle(file);
+    }
+#else
+    int file = open(filename.c_str(), O_RDONLY);
+    if (file != -1)
+    {
+        struct stat file_stat;
+        if (fstat(file, &file_stat) == 0)
+        {
+            if (file_stat.st_size == 0)
+            {
+                // Empty files cannot be mapped.
+                ret = true;
+            }
+            else
+            {
+                void* view = mmap(nullptr, static_cast<size_t>(file_stat.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+                if (view != MAP_FAILED)
+                {
+                    data_ = static_cast<const char*>(view);
+                    size_ = static_cast<size_t>(file_stat.st_size);
+                    ret   = true;
+                }
+            }
+        }
+
+        // The mapping keeps its own reference to the file.
+        close(file);
+    }
+#endif
+
+    return ret;
+}
+
+void BeMappedFile::Close()
+{
+    if (data_ != nullptr)
+    {
+#ifdef _WIN32
+        UnmapViewOfFile(data_);
+        CloseHandle(mapping_handle_);
+        mapping_handle_ = nullptr;
+#else
+        munmap(const_cast<char*>(data_), size_);
+#endif
+    }
+    data_ = nullptr;
+    size_ = 0;
+}
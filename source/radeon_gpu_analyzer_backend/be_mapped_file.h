@@ -0,0 +1,47 @@
+//=============================================================================
+/// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Header for a read-only memory-mapped file.
+//=============================================================================
+
+#ifndef RGA_RADEONGPUANALYZERBACKEND_SRC_BE_MAPPED_FILE_H_
+#define RGA_RADEONGPUANALYZERBACKEND_SRC_BE_MAPPED_FILE_H_
+
+// C++.
+#include <string>
+#include <string_view>
+
+// A file that is mapped to memory for reading. The mapping is released when the object is destroyed.
+class BeMappedFile
+{
+public:
+    BeMappedFile() = default;
+    ~BeMappedFile();
+
+    BeMappedFile(const BeMappedFile&) = delete;
+    BeMappedFile& operator=(const BeMappedFile&) = delete;
+
+    // Map the given file to memory. Returns true on success (an empty file is mapped as empty text).
+    bool Open(const std::string& filename);
+
+    // Release the mapping.
+    void Close();
+
+    // The content of the mapped file.
+    std::string_view GetText() const { return std::string_view(data_, size_); }
+
+private:
+    // The mapped content.
+    const char* data_ = nullptr;
+
+    // The size of the mapped content in bytes.
+    size_t size_ = 0;
+
+#ifdef _WIN32
+    // Handle of the file mapping object.
+    void* mapping_handle_ = nullptr;
+#endif
+};
+
+#endif // RGA_RADEONGPUANALYZERBACKEND_SRC_BE_MAPPED_FILE_H_
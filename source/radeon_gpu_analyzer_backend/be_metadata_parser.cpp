@@ -6,6 +6,10 @@
 //=============================================================================
 
 // C++.
+#include <charconv>
+#include <istream>
+#include <iterator>
+#include <streambuf>
 #include <unordered_map>
 #include <regex>
 
@@ -16,6 +20,7 @@
 #pragma warning(disable : 4127)
 #endif
 #include "yaml-cpp/yaml.h"
+#include "yaml-cpp/eventhandler.h"
 #ifdef _WIN32
 #pragma warning(pop)
 #endif
@@ -284,7 +289,767 @@ uint64_t GetHardwareStageProperty(const YAML::Node& node, const std::string& key
     return ret;
 }
 
+// Read-only stream buffer over a metadata section of the amdgpu-dis output.
+// Lets the YAML parser read the section in place rather than from a copy.
+class BeMetadataSectionBuffer : public std::streambuf
+{
+public:
+    BeMetadataSectionBuffer(const char* begin, const char* end)
+    {
+        char* data = const_cast<char*>(begin);
+        setg(data, data, data + (end - begin));
+    }
+};
+
+// YAML event handler that fills the pipeline metadata while the parser walks a metadata section,
+// without building a YAML node tree.
+// Only the layout that amdgpu-dis emits is accepted: keys that are read must be unique plain scalars,
+// values that are read must have the expected kind, and every value that the YAML DOM reader would
+// fail on is rejected. Any other input throws std::runtime_error, in which case the caller falls back
+// to the YAML DOM reader.
+class BeAmdPalMetadataEventHandler : public YAML::EventHandler
+{
+public:
+    // True if the section holds HSA (compute) code object metadata.
+    bool IsComputeMetadata() const
+    {
+        return is_compute_metadata_;
+    }
+
+    // True if a complete metadata map was read.
+    bool IsComplete() const
+    {
+        return is_complete_;
+    }
+
+    // The pipelines read from the section.
+    std::vector<BeAmdPalMetaData::PipelineMetaData>& GetPipelines()
+    {
+        return pipelines_;
+    }
+
+    // The status of the last pipeline read from the section.
+    beKA::beStatus GetStatus() const
+    {
+        return status_;
+    }
+
+    void OnDocumentStart(const YAML::Mark&) override
+    {
+    }
+
+    void OnDocumentEnd() override
+    {
+    }
+
+    void OnNull(const YAML::Mark&, YAML::anchor_t) override
+    {
+        OnLeaf(nullptr);
+    }
+
+    void OnAlias(const YAML::Mark&, YAML::anchor_t) override
+    {
+        OnLeaf(nullptr);
+    }
+
+    void OnScalar(const YAML::Mark&, const std::string&, YAML::anchor_t, const std::string& value) override
+    {
+        OnLeaf(&value);
+    }
+
+    void OnSequenceStart(const YAML::Mark&, const std::string&, YAML::anchor_t, YAML::EmitterStyle::value) override
+    {
+        OnCollectionStart(false);
+    }
+
+    void OnSequenceEnd() override
+    {
+        OnCollectionEnd();
+    }
+
+    void OnMapStart(const YAML::Mark&, const std::string&, YAML::anchor_t, YAML::EmitterStyle::value) override
+    {
+        OnCollectionStart(true);
+    }
+
+    void OnMapEnd() override
+    {
+        OnCollectionEnd();
+    }
+
+private:
+    // The nodes of the metadata that are read.
+    enum class NodeRole
+    {
+        kIgnored,
+        kRoot,
+        kPipelines,
+        kPipeline,
+        kHardwareStages,
+        kHardwareStage,
+        kShaderFunctions,
+        kShaderFunction,
+        kShaders,
+        kShader,
+        kHardwareMapping
+    };
+
+    // The map keys that are read.
+    enum class MetadataKey
+    {
+        kIgnored,
+        kKernels,
+        kPipelines,
+        kApi,
+        kHardwareStages,
+        kShaderFunctions,
+        kShaders,
+        kLdsSize,
+        kScratchMemorySize,
+        kSgprCount,
+        kSgprLimit,
+        kVgprCount,
+        kVgprLimit,
+        kWavefrontSize,
+        kShaderSubtype,
+        kHardwareMapping,
+        kEntry
+    };
+
+    // A map or sequence that is being read.
+    struct Frame
+    {
+        NodeRole    role            = NodeRole::kIgnored;
+        bool        is_map          = false;
+        bool        is_key_expected = false;
+        MetadataKey key             = MetadataKey::kIgnored;
+        uint32_t    seen_keys       = 0;
+        size_t      element_count   = 0;
+    };
+
+    [[noreturn]] static void ThrowUnsupported()
+    {
+        throw std::runtime_error("Unsupported code object metadata layout.");
+    }
+
+    static uint32_t GetKeyBit(MetadataKey key)
+    {
+        return 1u << static_cast<uint32_t>(key);
+    }
+
+    // Returns the statistics field that the given key refers to, or null if the key is not a statistic.
+    static uint64_t* GetStatsField(beKA::AnalysisData& stats, MetadataKey key)
+    {
+        uint64_t* ret = nullptr;
+        switch (key)
+        {
+        case MetadataKey::kLdsSize:
+            ret = &stats.lds_size_used;
+            break;
+        case MetadataKey::kScratchMemorySize:
+            ret = &stats.scratch_memory_used;
+            break;
+        case MetadataKey::kSgprCount:
+            ret = &stats.num_sgprs_used;
+            break;
+        case MetadataKey::kSgprLimit:
+            ret = &stats.num_sgprs_available;
+            break;
+        case MetadataKey::kVgprCount:
+            ret = &stats.num_vgprs_used;
+            break;
+        case MetadataKey::kVgprLimit:
+            ret = &stats.num_vgprs_available;
+            break;
+        case MetadataKey::kWavefrontSize:
+            ret = &stats.wavefront_size;
+            break;
+        default:
+            break;
+        }
+        return ret;
+    }
+
+    // Statistics that are not present in the metadata are reported as -1.
+    static void ResetStats(beKA::AnalysisData& stats)
+    {
+        stats                     = beKA::AnalysisData();
+        stats.lds_size_used       = static_cast<uint64_t>(-1);
+        stats.scratch_memory_used = static_cast<uint64_t>(-1);
+        stats.num_sgprs_used      = static_cast<uint64_t>(-1);
+        stats.num_sgprs_available = static_cast<uint64_t>(-1);
+        stats.num_vgprs_used      = static_cast<uint64_t>(-1);
+        stats.num_vgprs_available = static_cast<uint64_t>(-1);
+        stats.wavefront_size      = static_cast<uint64_t>(-1);
+    }
+
+    // Parse a statistic: a decimal number without leading zeros, or a hexadecimal number with a 0x prefix.
+    static uint64_t ParseStatsValue(const std::string& value)
+    {
+        const char* begin = value.data();
+        const char* end   = begin + value.size();
+        int         base  = 10;
+        if (value.size() > 2 && value[0] == '0' && (value[1] == 'x' || value[1] == 'X'))
+        {
+            begin += 2;
+            base = 16;
+        }
+        else if (value.size() > 1 && value[0] == '0')
+        {
+            ThrowUnsupported();
+        }
+
+        uint64_t                     ret    = 0;
+        const std::from_chars_result result = std::from_chars(begin, end, ret, base);
+        if (result.ec != std::errc() || result.ptr != end || begin == end)
+        {
+            ThrowUnsupported();
+        }
+        return ret;
+    }
+
+    // Returns the key of a map with the given role.
+    MetadataKey GetKey(NodeRole role, const std::string& key)
+    {
+        MetadataKey ret = MetadataKey::kIgnored;
+        switch (role)
+        {
+        case NodeRole::kRoot:
+            if (key == kStrCodeObjectMetadataKeyKernels)
+            {
+                ret = MetadataKey::kKernels;
+            }
+            else if (key == kStrCodeObjectMetadataKeyPipelines)
+            {
+                ret = MetadataKey::kPipelines;
+            }
+            break;
+        case NodeRole::kPipeline:
+            if (key == kAmdgpuDisDotApiToken)
+            {
+                ret = MetadataKey::kApi;
+            }
+            else if (key == kAmdgpuDisDotHardwareStagesToken)
+            {
+                ret = MetadataKey::kHardwareStages;
+            }
+            else if (key == kAmdgpuDisDotShaderFunctionsToken)
+            {
+                ret = MetadataKey::kShaderFunctions;
+            }
+            else if (key == kAmdgpuDisDotShadersToken)
+            {
+                ret = MetadataKey::kShaders;
+            }
+            break;
+        case NodeRole::kShaderFunction:
+            if (key == kAmdgpuDisDotShaderSubtypeToken)
+            {
+                ret = MetadataKey::kShaderSubtype;
+                break;
+            }
+            // Shader functions have the statistics of hardware stages.
+            [[fallthrough]];
+        case NodeRole::kHardwareStage:
+            if (key == kAmdgpuDisDotLdsSizeToken)
+            {
+                ret = MetadataKey::kLdsSize;
+            }
+            else if (key == kAmdgpuDisDotScratchMemorySizeToken)
+            {
+                ret = MetadataKey::kScratchMemorySize;
+            }
+            else if (key == kAmdgpuDisDotSgprCountToken)
+            {
+                ret = MetadataKey::kSgprCount;
+            }
+            else if (key == kAmdgpuDisDotSgprLimitToken)
+            {
+                ret = MetadataKey::kSgprLimit;
+            }
+            else if (key == kAmdgpuDisDotVgprCountToken)
+            {
+                ret = MetadataKey::kVgprCount;
+            }
+            else if (key == kAmdgpuDisDotVgprLimitToken)
+            {
+                ret = MetadataKey::kVgprLimit;
+            }
+            else if (key == kAmdgpuDisDotWavefrontSizeToken)
+            {
+                ret = MetadataKey::kWavefrontSize;
+            }
+            break;
+        case NodeRole::kShader:
+            if (key == kAmdgpuDisDotHardwareMappingToken)
+            {
+                ret = MetadataKey::kHardwareMapping;
+            }
+            else if (key == kAmdgpuDisDotShaderSubtypeToken)
+            {
+                ret = MetadataKey::kShaderSubtype;
+            }
+            break;
+        case NodeRole::kHardwareStages:
+            stage_.stage_type = BeAmdPalMetaData::GetStageType(key);
+            ret               = MetadataKey::kEntry;
+            break;
+        case NodeRole::kShaderFunctions:
+            // Functions that follow the stand-alone compute shader are not read.
+            if (!is_traditional_compute_shader_)
+            {
+                function_.name = BeMangledKernelUtils::DemangleShaderName(key);
+                if (function_.name == kAmdgpuDisRaytracingStandAloneComputeShader)
+                {
+                    is_traditional_compute_shader_ = true;
+                }
+                else
+                {
+                    ret = MetadataKey::kEntry;
+                }
+            }
+            break;
+        case NodeRole::kShaders:
+            shader_.shader_type = BeAmdPalMetaData::GetShaderType(key);
+            ret                 = MetadataKey::kEntry;
+            break;
+        default:
+            break;
+        }
+        return ret;
+    }
+
+    // Returns the role of a map or sequence that is the current value of the given frame.
+    NodeRole GetCollectionRole(const Frame& parent, bool is_map)
+    {
+        NodeRole ret         = NodeRole::kIgnored;
+        bool     is_expected = true;
+        switch (parent.role)
+        {
+        case NodeRole::kRoot:
+            if (parent.key == MetadataKey::kPipelines)
+            {
+                ret         = NodeRole::kPipelines;
+                is_expected = !is_map;
+            }
+            else if (parent.key == MetadataKey::kKernels)
+            {
+                is_compute_metadata_ = true;
+            }
+            break;
+        case NodeRole::kPipelines:
+            ret         = NodeRole::kPipeline;
+            is_expected = is_map;
+            break;
+        case NodeRole::kPipeline:
+            if (parent.key == MetadataKey::kHardwareStages)
+            {
+                ret = NodeRole::kHardwareStages;
+            }
+            else if (parent.key == MetadataKey::kShaderFunctions)
+            {
+                ret = NodeRole::kShaderFunctions;
+            }
+            else if (parent.key == MetadataKey::kShaders)
+            {
+                ret = NodeRole::kShaders;
+            }
+            is_expected = (parent.key == MetadataKey::kIgnored || is_map) && parent.key != MetadataKey::kApi;
+            break;
+        case NodeRole::kHardwareStages:
+            ret         = NodeRole::kHardwareStage;
+            is_expected = is_map;
+            break;
+        case NodeRole::kShaderFunctions:
+            if (parent.key == MetadataKey::kEntry)
+            {
+                ret         = NodeRole::kShaderFunction;
+                is_expected = is_map;
+            }
+            break;
+        case NodeRole::kShaders:
+            ret         = NodeRole::kShader;
+            is_expected = is_map;
+            break;
+        case NodeRole::kShader:
+            if (parent.key == MetadataKey::kHardwareMapping)
+            {
+                ret         = NodeRole::kHardwareMapping;
+                is_expected = !is_map;
+            }
+            else
+            {
+                is_expected = (parent.key == MetadataKey::kIgnored);
+            }
+            break;
+        case NodeRole::kHardwareStage:
+        case NodeRole::kShaderFunction:
+            is_expected = (parent.key == MetadataKey::kIgnored);
+            break;
+        case NodeRole::kHardwareMapping:
+            is_expected = (parent.element_count > 0);
+            break;
+        default:
+            break;
+        }
+
+        if (!is_expected)
+        {
+            ThrowUnsupported();
+        }
+        return ret;
+    }
+
+    // Handle a scalar, null or alias. The value is null for nulls and aliases.
+    void OnLeaf(const std::string* value)
+    {
+        if (ignored_depth_ == 0)
+        {
+            if (frames_.empty())
+            {
+                // The metadata is not a map.
+                ThrowUnsupported();
+            }
+
+            Frame& frame = frames_.back();
+            if (frame.is_map && frame.is_key_expected)
+            {
+                if (value == nullptr)
+                {
+                    ThrowUnsupported();
+                }
+                frame.key = GetKey(frame.role, *value);
+                if (frame.key != MetadataKey::kIgnored && frame.key != MetadataKey::kEntry)
+                {
+                    if ((frame.seen_keys & GetKeyBit(frame.key)) != 0)
+                    {
+                        ThrowUnsupported();
+                    }
+                    frame.seen_keys |= GetKeyBit(frame.key);
+                }
+            }
+            else
+            {
+                OnLeafValue(frame, value);
+            }
+            Advance(frame);
+        }
+    }
+
+    // Handle a scalar, null or alias value of the given frame.
+    void OnLeafValue(const Frame& frame, const std::string* value)
+    {
+        bool is_expected = true;
+        switch (frame.role)
+        {
+        case NodeRole::kRoot:
+            is_compute_metadata_ = is_compute_metadata_ || frame.key == MetadataKey::kKernels;
+            is_expected          = (frame.key != MetadataKey::kPipelines);
+            break;
+        case NodeRole::kPipeline:
+            if (frame.key == MetadataKey::kApi && value != nullptr)
+            {
+                pipeline_.api = *value;
+            }
+            else
+            {
+                is_expected = (frame.key == MetadataKey::kIgnored);
+            }
+            break;
+        case NodeRole::kHardwareStage:
+        case NodeRole::kShaderFunction:
+        {
+            beKA::AnalysisData& stats = (frame.role == NodeRole::kHardwareStage ? stage_.stats : function_.stats);
+            uint64_t*           field = GetStatsField(stats, frame.key);
+            if (field != nullptr && value != nullptr)
+            {
+                *field = ParseStatsValue(*value);
+            }
+            else if (frame.key == MetadataKey::kShaderSubtype && value != nullptr)
+            {
+                function_.shader_subtype = BeAmdPalMetaData::GetShaderSubtype(*value);
+            }
+            else
+            {
+                is_expected = (frame.key == MetadataKey::kIgnored);
+            }
+            break;
+        }
+        case NodeRole::kShader:
+            if (frame.key == MetadataKey::kShaderSubtype && value != nullptr)
+            {
+                shader_.shader_subtype = BeAmdPalMetaData::GetShaderSubtype(*value);
+            }
+            else
+            {
+                is_expected = (frame.key == MetadataKey::kIgnored);
+            }
+            break;
+        case NodeRole::kShaderFunctions:
+            is_expected = (frame.key == MetadataKey::kIgnored);
+            break;
+        case NodeRole::kHardwareMapping:
+            // Only the first hardware stage of the mapping is read.
+            if (frame.element_count == 0)
+            {
+                if (value == nullptr)
+                {
+                    ThrowUnsupported();
+                }
+                shader_.hardware_mapping = BeAmdPalMetaData::GetStageType(*value);
+            }
+            break;
+        default:
+            is_expected = false;
+            break;
+        }
+
+        if (!is_expected)
+        {
+            ThrowUnsupported();
+        }
+    }
+
+    void OnCollectionStart(bool is_map)
+    {
+        if (ignored_depth_ > 0)
+        {
+            ignored_depth_++;
+        }
+        else if (frames_.empty())
+        {
+            if (!is_map)
+            {
+                ThrowUnsupported();
+            }
+            Frame root;
+            root.role            = NodeRole::kRoot;
+            root.is_map          = true;
+            root.is_key_expected = true;
+            frames_.push_back(root);
+        }
+        else
+        {
+            const Frame& parent = frames_.back();
+            if (parent.is_map && parent.is_key_expected)
+            {
+                // Complex keys are not used by the metadata.
+                ThrowUnsupported();
+            }
+
+            Frame frame;
+            frame.role            = GetCollectionRole(parent, is_map);
+            frame.is_map          = is_map;
+            frame.is_key_expected = is_map;
+            if (frame.role == NodeRole::kIgnored)
+            {
+                ignored_depth_ = 1;
+            }
+            else
+            {
+                OnNodeStart(frame.role);
+                frames_.push_back(frame);
+            }
+        }
+    }
+
+    void OnCollectionEnd()
+    {
+        if (ignored_depth_ > 0)
+        {
+            ignored_depth_--;
+            if (ignored_depth_ == 0)
+            {
+                Advance(frames_.back());
+            }
+        }
+        else
+        {
+            const Frame frame = frames_.back();
+            frames_.pop_back();
+            OnNodeEnd(frame);
+            if (!frames_.empty())
+            {
+                Advance(frames_.back());
+            }
+        }
+    }
+
+    // Move on to the next key, value or element of the given frame.
+    static void Advance(Frame& frame)
+    {
+        if (frame.is_map)
+        {
+            frame.is_key_expected = !frame.is_key_expected;
+        }
+        else
+        {
+            frame.element_count++;
+        }
+    }
+
+    void OnNodeStart(NodeRole role)
+    {
+        switch (role)
+        {
+        case NodeRole::kPipeline:
+            pipeline_                      = BeAmdPalMetaData::PipelineMetaData();
+            is_traditional_compute_shader_ = false;
+            is_raytracing_shader_          = false;
+            break;
+        case NodeRole::kHardwareStage:
+            ResetStats(stage_.stats);
+            break;
+        case NodeRole::kShaderFunction:
+            function_.shader_subtype = BeAmdPalMetaData::ShaderSubtype::kUnknown;
+            ResetStats(function_.stats);
+            break;
+        case NodeRole::kShader:
+            shader_.shader_subtype = BeAmdPalMetaData::ShaderSubtype::kUnknown;
+            break;
+        default:
+            break;
+        }
+    }
+
+    void OnNodeEnd(const Frame& frame)
+    {
+        switch (frame.role)
+        {
+        case NodeRole::kRoot:
+            is_complete_ = true;
+            break;
+        case NodeRole::kPipeline:
+            if ((frame.seen_keys & GetKeyBit(MetadataKey::kApi)) == 0)
+            {
+                ThrowUnsupported();
+            }
+            status_ = beKA::beStatus::kBeStatusGraphicsCodeObjMetaDataSuccess;
+            if ((frame.seen_keys & GetKeyBit(MetadataKey::kShaderFunctions)) != 0 && !is_traditional_compute_shader_)
+            {
+                status_ = beKA::beStatus::kBeStatusRayTracingCodeObjMetaDataSuccess;
+            }
+            if (is_raytracing_shader_)
+            {
+                status_ = beKA::beStatus::kBeStatusRayTracingCodeObjMetaDataSuccess;
+            }
+            pipelines_.push_back(std::move(pipeline_));
+            break;
+        case NodeRole::kHardwareStage:
+            pipeline_.hardware_stages.push_back(stage_);
+            break;
+        case NodeRole::kShaderFunction:
+            if ((frame.seen_keys & GetKeyBit(MetadataKey::kShaderSubtype)) == 0)
+            {
+                ThrowUnsupported();
+            }
+            pipeline_.shader_functions.push_back(function_);
+            break;
+        case NodeRole::kShader:
+            if (!is_hardware_mapping_read_)
+            {
+                ThrowUnsupported();
+            }
+            is_hardware_mapping_read_ = false;
+            is_raytracing_shader_     = is_raytracing_shader_ || shader_.shader_subtype != BeAmdPalMetaData::ShaderSubtype::kUnknown;
+            pipeline_.shaders.push_back(shader_);
+            break;
+        case NodeRole::kHardwareMapping:
+            is_hardware_mapping_read_ = (frame.element_count > 0);
+            break;
+        default:
+            break;
+        }
+    }
+
+    std::vector<Frame>                              frames_;
+    size_t                                          ignored_depth_                 = 0;
+    bool                                            is_compute_metadata_           = false;
+    bool                                            is_complete_                   = false;
+    bool                                            is_traditional_compute_shader_ = false;
+    bool                                            is_raytracing_shader_          = false;
+    bool                                            is_hardware_mapping_read_      = false;
+    beKA::beStatus                                  status_                        = beKA::beStatus::kBeStatusSuccess;
+    BeAmdPalMetaData::PipelineMetaData              pipeline_;
+    BeAmdPalMetaData::HardwareStageMetaData         stage_;
+    BeAmdPalMetaData::ShaderFunctionMetaData        function_;
+    BeAmdPalMetaData::ShaderMetaData                shader_;
+    std::vector<BeAmdPalMetaData::PipelineMetaData> pipelines_;
+};
+
+beKA::beStatus BeAmdPalMetaData::ParseAmdgpudisMetadataStreaming(const std::string& amdgpu_dis_output, BeAmdPalMetaData::PipelineMetaData& pipeline_md)
+{
+    beKA::beStatus status       = beKA::beStatus::kBeStatusSuccess;
+    size_t         start_offset = amdgpu_dis_output.find(kStrLcCodeObjectMetadataTokenStart);
+    size_t         end_offset;
+
+    std::vector<BeAmdPalMetaData::PipelineMetaData> pipelines;
+    while ((end_offset = amdgpu_dis_output.find(kStrLcCodeObjectMetadataTokenEnd, start_offset)) != std::string::npos)
+    {
+        // For each metadata section, read in place by the event handler.
+        try
+        {
+            const char*             section_begin = amdgpu_dis_output.data() + start_offset;
+            const char*             section_end   = amdgpu_dis_output.data() + end_offset + kStrLcCodeObjectMetadataTokenEnd.size();
+            BeMetadataSectionBuffer section_buffer(section_begin, section_end);
+            std::istream            section_stream(&section_buffer);
+            YAML::Parser            parser(section_stream);
+
+            BeAmdPalMetadataEventHandler handler;
+            if (!parser.HandleNextDocument(handler) || !handler.IsComplete())
+            {
+                status = beKA::beStatus::kBeStatusCodeObjMdParsingFailed;
+                break;
+            }
+
+            if (handler.IsComputeMetadata())
+            {
+                status = beKA::beStatus::kBeStatusComputeCodeObjMetaDataSuccess;
+                break;
+            }
+
+            std::vector<BeAmdPalMetaData::PipelineMetaData>& section_pipelines = handler.GetPipelines();
+            if (!section_pipelines.empty())
+            {
+                status = handler.GetStatus();
+                std::move(section_pipelines.begin(), section_pipelines.end(), std::back_inserter(pipelines));
+            }
+        }
+        catch (const std::runtime_error&)
+        {
+            // Parser errors and unsupported layouts.
+            status = beKA::beStatus::kBeStatusCodeObjMdParsingFailed;
+            break;
+        }
+
+        start_offset = amdgpu_dis_output.find(kStrLcCodeObjectMetadataTokenStart, end_offset);
+        if (start_offset == std::string::npos)
+        {
+            break;
+        }
+    }
+
+    if (status != beKA::beStatus::kBeStatusCodeObjMdParsingFailed && pipelines.size() > 0)
+    {
+        pipeline_md = std::move(pipelines[0]);
+    }
+
+    return status;
+}
+
 beKA::beStatus BeAmdPalMetaData::ParseAmdgpudisMetadata(const std::string& amdgpu_dis_output, BeAmdPalMetaData::PipelineMetaData& pipeline_md)
+{
+    // The streaming reader handles the layout emitted by amdgpu-dis. Anything it does not handle,
+    // including malformed metadata, is left to the YAML DOM reader which decides the final status.
+    beKA::beStatus status = ParseAmdgpudisMetadataStreaming(amdgpu_dis_output, pipeline_md);
+    if (status == beKA::beStatus::kBeStatusCodeObjMdParsingFailed)
+    {
+        status = ParseAmdgpudisMetadataDom(amdgpu_dis_output, pipeline_md);
+    }
+    return status;
+}
+
+beKA::beStatus BeAmdPalMetaData::ParseAmdgpudisMetadataDom(const std::string& amdgpu_dis_output, BeAmdPalMetaData::PipelineMetaData& pipeline_md)
 {
     beKA::beStatus status       = beKA::beStatus::kBeStatusSuccess;
     size_t         start_offset = amdgpu_dis_output.find(kStrLcCodeObjectMetadataTokenStart);
@@ -135,8 +135,16 @@ public:
     static std::string GetShaderSubtypeName(ShaderSubtype subtype);
 
     // Parses amdgpu-dis output and extracts code object metadata.
+    // Uses the streaming reader, and falls back to the YAML DOM reader if the streaming reader fails.
     static beKA::beStatus ParseAmdgpudisMetadata(const std::string& amdgpu_dis_output, BeAmdPalMetaData::PipelineMetaData& pipeline);
 
+    // Parses amdgpu-dis output with YAML parser events, reading the metadata sections in place without building a YAML node tree.
+    // Returns kBeStatusCodeObjMdParsingFailed for metadata that is malformed or not laid out the way amdgpu-dis emits it.
+    static beKA::beStatus ParseAmdgpudisMetadataStreaming(const std::string& amdgpu_dis_output, BeAmdPalMetaData::PipelineMetaData& pipeline);
+
+    // Parses amdgpu-dis output by loading each metadata section into a YAML node tree.
+    static beKA::beStatus ParseAmdgpudisMetadataDom(const std::string& amdgpu_dis_output, BeAmdPalMetaData::PipelineMetaData& pipeline);
+
 };
 
 #endif // RGA_RADEONGPUANALYZERBACKEND_SRC_BE_METADATA_PARSER_H_
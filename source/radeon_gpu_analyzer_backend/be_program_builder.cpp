@@ -5,8 +5,12 @@
 /// @brief Implementation for rga backend progam builder class.
 //=============================================================================
 
+// C++.
+#include <fstream>
+
 // Local.
 #include "radeon_gpu_analyzer_backend/be_program_builder.h"
+#include "radeon_gpu_analyzer_backend/be_mapped_file.h"
 #include "emulator/parser/be_isa_parser.h"
 
 bool BeProgramBuilder::LogCallback(const std::string& str)
@@ -20,45 +24,96 @@ bool BeProgramBuilder::LogCallback(const std::string& str)
     return ret;
 }
 
+// Padding instruction to be ignored when converting ISA to CSV.
+static const char* kCodeEndPadding = "s_code_end";
+
+// Size of the CSV output buffer: rows are flushed to the output file whenever the buffer grows beyond this size.
+static const size_t kCsvOutputBufferSize = 64 * 1024;
+
 beKA::beStatus BeProgramBuilder::ParseIsaToCsv(const std::string& isa_text, const std::string& device,
     std::string& parsed_isa_text, bool add_line_numbers, bool is_header_required)
 {
     beKA::beStatus     status = beKA::kBeStatusParseIsaToCsvFailed;
-    std::stringstream  parsed_isa;
     ParserIsa          parser;
-    std::string        input_isa;
-
-    if (is_header_required)
-    {
-        // Add ISA starting and ending tokens so that Parser can recognize it.
-        std::stringstream  input_isa_stream;
-        input_isa_stream << kStrHsailDisassemblyTokenStart << isa_text << kStrHsailDisassemblyTokenEnd << std::endl;
-        input_isa = input_isa_stream.str();
-    }
-    else
-    {
-        input_isa = isa_text;
-    }
 
-    if (parser.Parse(input_isa))
+    // The parser adds the ISA starting and ending tokens, if required, so that the ISA text does not have to be copied.
+    if (parser.Parse(isa_text, is_header_required))
     {
-        // Padding instruction to be ignored.
-        const char* kCodeEndPadding = "s_code_end";
+        parsed_isa_text.clear();
         for (const Instruction* instruction : parser.GetInstructions())
         {
-            std::string instruction_str;
-            instruction->GetCsvString(device, add_line_numbers, instruction_str);
             if (instruction->GetInstructionOpCode().find(kCodeEndPadding) == std::string::npos)
             {
-                parsed_isa << instruction_str;
+                instruction->AppendCsvString(device, add_line_numbers, parsed_isa_text);
             }
         }
-        parsed_isa_text = parsed_isa.str();
         status = beKA::kBeStatusSuccess;
     }
     return status;
 }
 
+beKA::beStatus BeProgramBuilder::ParseIsaFileToCsv(const std::string& isa_filename, const std::string& csv_filename, const std::string& device,
+    const std::string& csv_header, bool add_line_numbers, bool is_header_required)
+{
+    beKA::beStatus status = beKA::kBeStatusParseIsaToCsvFailed;
+    BeMappedFile   isa_file;
+    ParserIsa      parser;
+
+    if (isa_file.Open(isa_filename) && parser.Parse(isa_file.GetText(), is_header_required))
+    {
+        std::ofstream csv_file(csv_filename);
+        status = (csv_file.good() ? beKA::kBeStatusSuccess : beKA::kBeStatusWriteParsedIsaFileFailed);
+        if (status == beKA::kBeStatusSuccess)
+        {
+            // Rows are gathered in a reusable buffer which is flushed to the file in chunks.
+            std::string csv_buffer;
+            csv_buffer.reserve(kCsvOutputBufferSize + csv_header.size());
+            csv_buffer.append(csv_header);
+            for (const Instruction* instruction : parser.GetInstructions())
+            {
+                if (instruction->GetInstructionOpCode().find(kCodeEndPadding) == std::string::npos)
+                {
+                    instruction->AppendCsvString(device, add_line_numbers, csv_buffer);
+                    if (csv_buffer.size() >= kCsvOutputBufferSize)
+                    {
+                        csv_file.write(csv_buffer.data(), static_cast<std::streamsize>(csv_buffer.size()));
+                        csv_buffer.clear();
+                    }
+                }
+            }
+
+            // End the file with a line break, as KcUtils::WriteTextFile does.
+            csv_buffer.append("\n");
+            csv_file.write(csv_buffer.data(), static_cast<std::streamsize>(csv_buffer.size()));
+            csv_file.close();
+
+            if (csv_file.fail())
+            {
+                status = beKA::kBeStatusWriteParsedIsaFileFailed;
+            }
+        }
+    }
+    return status;
+}
+
+beKA::beStatus BeProgramBuilder::EstimateIsaFileCycles(const std::string& isa_filename, beKA::CycleEstimate& estimate, bool is_header_required)
+{
+    beKA::beStatus status = beKA::kBeStatusGeneralFailed;
+    BeMappedFile   isa_file;
+    ParserIsa      parser;
+
+    if (isa_file.Open(isa_filename) && parser.Parse(isa_file.GetText(), is_header_required))
+    {
+        ISAProgramGraph::CycleEstimate graph_estimate;
+        parser.GetCycleEstimate(graph_estimate);
+        estimate.min_cycles     = graph_estimate.min_cycles;
+        estimate.typical_cycles = graph_estimate.typical_cycles;
+        estimate.max_cycles     = graph_estimate.max_cycles;
+        status                  = beKA::kBeStatusSuccess;
+    }
+    return status;
+}
+
 void BeProgramBuilder::SetLog(LoggingCallBackFuncP callback)
 {
     log_callback_ = callback;
@@ -44,6 +44,15 @@ public:
     static beKA::beStatus ParseIsaToCsv(const std::string& isa_text, const std::string& device,
                                         std::string& parsed_isa_text, bool should_add_line_numbers = false, bool is_header_required = false);
 
+    // Streaming version of ParseIsaToCsv: parse the ISA file (mapped to memory) and write the CSV rows to "csv_filename",
+    // starting with "csv_header". The rows are written through a fixed-size buffer, so the CSV text is never held in memory as a whole.
+    static beKA::beStatus ParseIsaFileToCsv(const std::string& isa_filename, const std::string& csv_filename, const std::string& device,
+                                            const std::string& csv_header, bool should_add_line_numbers = false, bool is_header_required = false);
+
+    // Estimate the number of cycles per wavefront of the ISA in the given file out of its program graph.
+    // if "is_header_required" is true, the ISA is parsed as if it had the standard disassembly header.
+    static beKA::beStatus EstimateIsaFileCycles(const std::string& isa_filename, beKA::CycleEstimate& estimate, bool is_header_required = false);
+
     // Set callback function for diagnostic output.
     void SetLog(LoggingCallBackFuncP callback);
 
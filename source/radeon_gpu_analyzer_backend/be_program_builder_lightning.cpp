@@ -23,6 +23,9 @@
 #pragma warning(pop)
 #endif
 
+// ELF.
+#include "CElf.h"
+
 // Local
 #include "source/radeon_gpu_analyzer_cli/kc_utils.h"
 #include "radeon_gpu_analyzer_backend/be_utils.h"
@@ -655,91 +658,140 @@ int BeProgramBuilderLightning::GetIsaSize(const std::string & isa_text)
 int BeProgramBuilderLightning::GetKernelCodeSize(const std::string & user_bin_dir, const std::string & bin_file,
                                                  const std::string & kernel_name, bool should_print_cmd)
 {
-    beKA::beStatus status = beKA::beStatus::kBeStatusLightningGetKernelCodeSizeFailed;
-    std::string symbols, options, error_text;
-    int ret = -1, symSize;
-    size_t offset, name_offset, size_offset;
-    std::size_t    name_end_offset = std::string::npos;
+    int ret = -1;
+    KernelCodeSizeMap code_sizes;
+    if (ExtractKernelCodeSizes(user_bin_dir, bin_file, should_print_cmd, code_sizes) == beKA::beStatus::kBeStatusSuccess)
+    {
+        auto kernel_code_size = code_sizes.find(kernel_name);
+        if (kernel_code_size != code_sizes.end())
+        {
+            ret = kernel_code_size->second;
+        }
+    }
 
-    // Launch the LC ReadObj.
-    status = ConstructObjDumpOptions(ObjDumpOp::kGetKernelCodeSize, user_bin_dir, bin_file, "", should_print_cmd, options);
+    return ret;
+}
 
-    if (status == beKA::beStatus::kBeStatusSuccess)
+// Read the sizes of all named symbols from the ELF symbol table of the binary without launching external tools.
+static bool ReadElfSymbolSizes(const std::string& bin_file, KernelCodeSizeMap& code_sizes)
+{
+    bool ret = false;
+    CElf elf(bin_file);
+    const CElfSymbolTable* symbol_table = (elf.good() ? elf.GetSymbolTable() : nullptr);
+    if (symbol_table != nullptr)
     {
-        status = InvokeObjDump(ObjDumpOp::kGetKernelCodeSize, user_bin_dir, options, should_print_cmd, symbols, error_text);
+        for (auto symbol = symbol_table->SymbolsBegin(); symbol != symbol_table->SymbolsEnd(); ++symbol)
+        {
+            std::string   name;
+            unsigned char bind, type, other;
+            CElfSection*  section = nullptr;
+            Elf64_Addr    value;
+            Elf64_Xword   size;
+            if (symbol_table->GetInfo(symbol, &name, &bind, &type, &other, &section, &value, &size) && !name.empty())
+            {
+                // Keep the first symbol with a given name, like the readobj-based lookup does.
+                code_sizes.emplace(name, static_cast<int>(size));
+            }
+        }
+        ret = !code_sizes.empty();
     }
 
-    if (status == beKA::beStatus::kBeStatusSuccess)
-    {
-        // Parse the readobj output.
-        // readobj uses its own format, so we have to parse it manually.
-        //
-        //    File: gfx900_test.bin
-        //    Format: elf64-amdgpu
-        //    Arch: amdgcn
-        //    AddressSize : 64bit
-        //    LoadName : <Not found>
-
-        //    Symbols [
-        //      ...
-        //      Symbol {
-        //        Name: src_MyKernel (1)
-        //        Value : 0x1000
-        //        Size : 8
-        //        Binding : Global (0x1)
-        //        Type : Function (0x2)
-        //        Other[(0x3)
-        //          STV_PROTECTED (0x3)
-        //        ]
-        //        Section : .text (0x7)
-        //      }
-        //      ...
-        //    ]
+    return ret;
+}
 
-        if (status == beKA::beStatus::kBeStatusSuccess)
+// Parse the symbols section of the llvm-readobj output and collect the sizes of all symbols.
+static void ParseReadObjSymbolSizes(const std::string& symbols, KernelCodeSizeMap& code_sizes)
+{
+    // readobj uses its own format, so we have to parse it manually.
+    //
+    //    File: gfx900_test.bin
+    //    Format: elf64-amdgpu
+    //    Arch: amdgcn
+    //    AddressSize : 64bit
+    //    LoadName : <Not found>
+
+    //    Symbols [
+    //      ...
+    //      Symbol {
+    //        Name: src_MyKernel (1)
+    //        Value : 0x1000
+    //        Size : 8
+    //        Binding : Global (0x1)
+    //        Type : Function (0x2)
+    //        Other[(0x3)
+    //          STV_PROTECTED (0x3)
+    //        ]
+    //        Section : .text (0x7)
+    //      }
+    //      ...
+    //    ]
+    size_t offset = symbols.find(kStrReadObjKeySymbols);
+    if (offset != std::string::npos)
+    {
+        while ((offset = symbols.find(kStrReadObjKeySymbol, offset)) != std::string::npos)
         {
-            if ((offset = symbols.find(kStrReadObjKeySymbols)) != std::string::npos)
+            size_t name_offset = symbols.find(kStrReadObjKeyName, offset);
+            if (name_offset == std::string::npos)
             {
-                bool stop = false;
-                while (!stop && (offset = symbols.find(kStrReadObjKeySymbol, offset)) != std::string::npos)
-                {
-                    name_offset = symbols.find(kStrReadObjKeyName, offset);
-                    if (name_offset != std::string::npos)
-                    {
-                        size_offset = symbols.find(kStrReadObjKeySize, name_offset);
-                        if (size_offset != std::string::npos)
-                        {
-                            size_offset += kStrReadObjKeySize.size();
-                            name_end_offset = symbols.find(kStrReadObjKeyNameEnd, name_offset);
-                        }
-                        if (name_end_offset != std::string::npos)
-                        {
-                            name_offset += kStrReadObjKeyName.size();
-                            size_t kernel_name_end = symbols.find(kStrReadObjKeyNameEnd, name_offset);
-                            if (symbols.substr(name_offset, kernel_name_end - name_offset) == kernel_name)
-                            {
-                                size_t size_end_offset = symbols.find("\n    Bind", size_offset);
-                                if (size_end_offset != std::string::npos)
-                                {
-                                    std::string size_as_string = symbols.substr(size_offset, size_end_offset - size_offset);
-                                    symSize = std::atoi(size_as_string.c_str());
-                                    ret = symSize;
-                                    stop = true;
-                                }
-                                else
-                                {
-                                    ret = 0;
-                                }
-                            }
-                            offset = size_offset;
-                        }
-                    }
-                }
+                break;
             }
+
+            size_t size_offset = symbols.find(kStrReadObjKeySize, name_offset);
+            size_t name_end_offset = symbols.find(kStrReadObjKeyNameEnd, name_offset);
+            if (size_offset == std::string::npos || name_end_offset == std::string::npos)
+            {
+                break;
+            }
+
+            name_offset += kStrReadObjKeyName.size();
+            size_offset += kStrReadObjKeySize.size();
+            std::string symbol_name = symbols.substr(name_offset, name_end_offset - name_offset);
+
+            int    symbol_size     = 0;
+            size_t size_end_offset = symbols.find("\n    Bind", size_offset);
+            if (size_end_offset != std::string::npos)
+            {
+                symbol_size = std::atoi(symbols.substr(size_offset, size_end_offset - size_offset).c_str());
+            }
+            code_sizes.emplace(symbol_name, symbol_size);
+
+            offset = size_offset;
         }
     }
+}
 
-    return ret;
+beKA::beStatus BeProgramBuilderLightning::ExtractKernelCodeSizes(const std::string& user_bin_dir,
+                                                                 const std::string& bin_file,
+                                                                 bool               should_print_cmd,
+                                                                 KernelCodeSizeMap& code_sizes)
+{
+    beKA::beStatus status = beKA::beStatus::kBeStatusSuccess;
+    code_sizes.clear();
+
+    if (!ReadElfSymbolSizes(bin_file, code_sizes))
+    {
+        // Fall back to a single llvm-readobj invocation for the whole binary.
+        std::string symbols, options, error_text;
+        code_sizes.clear();
+        status = ConstructObjDumpOptions(ObjDumpOp::kGetKernelCodeSize, user_bin_dir, bin_file, "", should_print_cmd, options);
+
+        if (status == beKA::beStatus::kBeStatusSuccess)
+        {
+            status = InvokeObjDump(ObjDumpOp::kGetKernelCodeSize, user_bin_dir, options, should_print_cmd, symbols, error_text);
+        }
+
+        if (status == beKA::beStatus::kBeStatusSuccess)
+        {
+            ParseReadObjSymbolSizes(symbols, code_sizes);
+        }
+    }
+
+    if (status == beKA::beStatus::kBeStatusSuccess && code_sizes.empty())
+    {
+        status = beKA::beStatus::kBeStatusLightningGetKernelCodeSizeFailed;
+    }
+
+    return status;
 }
 
 beKA::beStatus BeProgramBuilderLightning::ConstructObjDumpOptions(ObjDumpOp op,
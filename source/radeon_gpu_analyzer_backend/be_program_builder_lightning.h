@@ -45,6 +45,9 @@ struct KernelCodeProperties
 // Maps  kernel_name --> KernelCodeProperties.
 typedef  std::map<std::string, KernelCodeProperties> CodePropsMap;
 
+// Maps  symbol_name --> size of the symbol's code in bytes.
+typedef  std::map<std::string, int> KernelCodeSizeMap;
+
 class BeProgramBuilderLightning : public BeProgramBuilder
 {
 public:
@@ -122,9 +125,18 @@ public:
     static int  GetIsaSize(const std::string& isa_disassembly);
 
     // Extract the size of binary section for the provided kernel.
+    // To query several kernels of the same binary, use ExtractKernelCodeSizes() instead.
     static int  GetKernelCodeSize(const std::string& user_bin_dir, const std::string& bin_file,
                                   const std::string& kernel_name, bool should_print_cmd);
 
+    // Extract the code sizes of all symbols (including all kernels) found in the binary's symbol table.
+    // The symbol table is read in-process. If the binary cannot be loaded as ELF,
+    // llvm-readobj is launched once for the whole binary.
+    static beKA::beStatus ExtractKernelCodeSizes(const std::string& user_bin_dir,
+                                                 const std::string& bin_file,
+                                                 bool               should_print_cmd,
+                                                 KernelCodeSizeMap& code_sizes);
+
 protected:
     // Adds standard options required to compile source language with LC compiler to the "options" string.
     static beKA::beStatus AddCompilerStandardOptions(beKA::RgaMode mode, const CmpilerPaths& compiler_paths, std::string& options);
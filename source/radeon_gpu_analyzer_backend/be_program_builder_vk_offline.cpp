@@ -17,6 +17,9 @@
 #include "radeon_gpu_analyzer_backend/be_program_builder_vk_offline.h"
 #include "radeon_gpu_analyzer_backend/be_utils.h"
 
+// CLI.
+#include "source/radeon_gpu_analyzer_cli/kc_utils.h"
+
 // Device info.
 #include "DeviceInfoUtils.h"
 
@@ -255,9 +258,8 @@ beKA::beStatus BeProgramBuilderVkOffline::CompileWithAmdllpc(const VkOfflineOpti
     bool is_device_valid = GetAmdllpcGfxIpForVulkan(vulkan_options, device_gfx_ip);
     if (is_device_valid && !device_gfx_ip.empty())
     {
-        // Build the command for invoking amdspv.
+        // Build the command line arguments for invoking amdllpc.
         std::stringstream cmd;
-        cmd << amdllpc_path;
 
         // amdllpc.exe -v --gfxip=11 C:\vkoffline\bloom\bloom1_vert.spv --log-file-outs=log.txt -o out.bin 
         cmd << " -v";
@@ -294,10 +296,12 @@ beKA::beStatus BeProgramBuilderVkOffline::CompileWithAmdllpc(const VkOfflineOpti
             }
 
             // Launch amdllpc.
+            std::string amdllpc_stdout, amdllpc_stderr;
+            long        exit_code = 0;
+            bool        is_launch_success = KcUtils::LaunchProcess(amdllpc_path, cmd.str(), "", kProcessWaitInfinite, should_print_cmd,
+                                                                   amdllpc_stdout, amdllpc_stderr, exit_code, &cancel_signal) == KcUtils::ProcessStatus::kSuccess;
             gtString amdllpc_output;
-            std::string cmdStr = cmd.str();
-            BeUtils::PrintCmdLine(cmdStr, should_print_cmd);
-            bool is_launch_success = osExecAndGrabOutput(cmd.str().c_str(), cancel_signal, amdllpc_output);
+            amdllpc_output.fromASCIIString((amdllpc_stdout + amdllpc_stderr).c_str());
             if (is_launch_success)
             {
                 // This is how amdspv signals success.
@@ -6,10 +6,12 @@
 //=============================================================================
 
 // C++.
+#include <algorithm>
 #include <cassert>
 #include <string>
 #include <sstream>
 #include <fstream>
+#include <unordered_map>
 
 // Infra.
 #include "external/amdt_os_wrappers/Include/osProcess.h"
@@ -23,6 +25,8 @@
 
 // Local.
 #include "radeon_gpu_analyzer_backend/be_static_isa_analyzer.h"
+#include "radeon_gpu_analyzer_backend/be_isa_analysis_engine.h"
+#include "radeon_gpu_analyzer_backend/be_mapped_file.h"
 #include "radeon_gpu_analyzer_backend/be_utils.h"
 
 // CLI.
@@ -39,6 +43,9 @@ static const std::string kShaeOptLiveregSgpr   = "--reg-type sgpr";
 static const std::string kShaeOptCfgPerBlock = "dump-bb-cfg";
 static const std::string kShaeOptCfgPerInstruciton = "dump-pi-cfg";
 
+// True to run the analyses with the in-process engine, and only launch the external analyzer when the engine cannot analyze the ISA.
+static bool is_in_process_engine_enabled = false;
+
 static bool GetLiveRegAnalyzerPath(std::string& analyzer_path)
 {
 #ifdef AMD_INTERNAL
@@ -170,17 +177,16 @@ static beKA::beStatus PerformAnalysis(const gtString& isa_filename, const gtStri
 
         if (isa_file_path.exists())
         {
-            // Construct the command.
-            std::stringstream cmd;
-            cmd << analyzer_path << " " << GetShaeIsaCmd(target) << " " << shae_cmd << " \"" << isa_filename.asASCIICharArray()
+            // Construct the command line arguments.
+            std::stringstream args;
+            args << GetShaeIsaCmd(target) << " " << shae_cmd << " \"" << isa_filename.asASCIICharArray()
                 << "\" \"" << output_filename.asASCIICharArray() << '"';
 
-            // Cancel signal. Not in use for now.
-            bool should_cancel = false;
-
-            gtString analyzer_output;
-            BeUtils::PrintCmdLine(cmd.str(), should_print_cmd);
-            is_ok = osExecAndGrabOutput(cmd.str().c_str(), should_cancel, analyzer_output);
+            // Launch the analyzer.
+            std::string analyzer_output, analyzer_errors;
+            long        exit_code = 0;
+            is_ok = KcUtils::LaunchProcess(analyzer_path, args.str(), "", kProcessWaitInfinite, should_print_cmd, analyzer_output,
+                                           analyzer_errors, exit_code) == KcUtils::ProcessStatus::kSuccess;
 
             if (is_ok)
             {
@@ -204,6 +210,57 @@ static beKA::beStatus PerformAnalysis(const gtString& isa_filename, const gtStri
     return ret;
 }
 
+// Perform live register analysis of the given parsed ISA with the in-process engine.
+// Returns kBeStatusStaticIsaAnalysisFailed if the engine cannot analyze the ISA.
+static beKA::beStatus PerformLiveRegisterAnalysisInProcess(const BeIsaProgram& program, const std::string& target,
+    const std::string& output_filename, beWaveSize wave_size, bool is_reg_type_sgpr)
+{
+    BeLiveRegAnalysis analysis;
+    beStatus ret = BeIsaAnalysisEngine::AnalyzeLiveRegisters(program, target, wave_size, is_reg_type_sgpr, analysis);
+    if (ret == kBeStatusSuccess)
+    {
+        ret = BeIsaAnalysisEngine::WriteLiveRegisterAnalysis(analysis, output_filename);
+    }
+    return ret;
+}
+
+// Generate the control flow graph of the given parsed ISA with the in-process engine.
+// Returns kBeStatusStaticIsaAnalysisFailed if the engine cannot analyze the ISA.
+static beKA::beStatus GenerateControlFlowGraphInProcess(const BeIsaProgram& program, const std::string& output_filename, bool is_per_instruction)
+{
+    BeControlFlowGraph cfg;
+    beStatus ret = BeIsaAnalysisEngine::BuildControlFlowGraph(program, cfg);
+    if (ret == kBeStatusSuccess)
+    {
+        ret = BeIsaAnalysisEngine::WriteControlFlowGraph(cfg, is_per_instruction, output_filename);
+    }
+    return ret;
+}
+
+// Perform the given analysis of the given parsed ISA with the in-process engine.
+// Returns kBeStatusStaticIsaAnalysisFailed if the engine cannot analyze the ISA.
+static beKA::beStatus PerformAnalysisInProcess(const BeIsaProgram& program, const BeStaticIsaAnalysisRequest& request)
+{
+    beStatus ret = kBeStatusGeneralFailed;
+    switch (request.type)
+    {
+    case BeStaticIsaAnalysisType::kLiveVgpr:
+    case BeStaticIsaAnalysisType::kLiveSgpr:
+        ret = PerformLiveRegisterAnalysisInProcess(program, request.target, request.output_filename, request.wave_size,
+                                                   request.type == BeStaticIsaAnalysisType::kLiveSgpr);
+        break;
+    case BeStaticIsaAnalysisType::kCfgPerBlock:
+    case BeStaticIsaAnalysisType::kCfgPerInstruction:
+        ret = GenerateControlFlowGraphInProcess(program, request.output_filename, request.type == BeStaticIsaAnalysisType::kCfgPerInstruction);
+        break;
+    default:
+        // We shouldn't get here.
+        assert(false);
+        break;
+    }
+    return ret;
+}
+
 beKA::beStatus beKA::BeStaticIsaAnalyzer::PreprocessIsaFile(const std::string& isa_filename, const std::string& output_filename)
 {
     beStatus ret = kBeStatusGeneralFailed;
@@ -237,11 +294,9 @@ beKA::beStatus beKA::BeStaticIsaAnalyzer::PreprocessIsaFile(const std::string& i
     return ret;
 }
 
-beKA::beStatus beKA::BeStaticIsaAnalyzer::PerformLiveRegisterAnalysis(const gtString& isa_filename, const gtString& target,
-                                                                      const gtString& output_filename,
-                                                                      beWaveSize      wave_size,
-                                                                      bool            should_print_cmd,
-                                                                      bool            is_reg_type_sgpr)
+// Perform live register analysis of the given ISA disassembly file with the external analyzer.
+static beKA::beStatus PerformLiveRegisterAnalysisWithShae(const gtString& isa_filename, const gtString& target, const gtString& output_filename,
+    beWaveSize wave_size, bool should_print_cmd, bool is_reg_type_sgpr)
 {
     std::stringstream shae_option;
     switch (wave_size)
@@ -281,7 +336,8 @@ beKA::beStatus beKA::BeStaticIsaAnalyzer::PerformLiveRegisterAnalysis(const gtSt
     return PerformAnalysis(isa_filename, target, output_filename, shae_option.str(), should_print_cmd);
 }
 
-beKA::beStatus beKA::BeStaticIsaAnalyzer::GenerateControlFlowGraph(const gtString& isa_filename, const gtString& target, const gtString& output_filename,
+// Generate the control flow graph of the given ISA disassembly file with the external analyzer.
+static beKA::beStatus GenerateControlFlowGraphWithShae(const gtString& isa_filename, const gtString& target, const gtString& output_filename,
     bool is_per_instruction, bool should_print_cmd)
 {
     beStatus ret = kBeStatusGeneralFailed;
@@ -297,18 +353,17 @@ beKA::beStatus beKA::BeStaticIsaAnalyzer::GenerateControlFlowGraph(const gtStrin
 
         if (isa_file_path.exists())
         {
-            // Construct the command.
-            std::stringstream cmd;
+            // Construct the command line arguments.
+            std::stringstream args;
             const std::string kShaeOptCfg = is_per_instruction ? kShaeOptCfgPerInstruciton : kShaeOptCfgPerBlock;
-            cmd << analyzer_path << " " << GetShaeIsaCmd(target) << " " << kShaeOptCfg << " " << '"' << isa_filename.asASCIICharArray()
+            args << GetShaeIsaCmd(target) << " " << kShaeOptCfg << " " << '"' << isa_filename.asASCIICharArray()
                 << "\" \"" << output_filename.asASCIICharArray() << '"';
 
-            // Cancel signal. Not in use for now.
-            bool should_cancel = false;
-
-            gtString analyzer_output;
-            BeUtils::PrintCmdLine(cmd.str(), should_print_cmd);
-            is_ok = osExecAndGrabOutput(cmd.str().c_str(), should_cancel, analyzer_output);
+            // Launch the analyzer.
+            std::string analyzer_output, analyzer_errors;
+            long        exit_code = 0;
+            is_ok = KcUtils::LaunchProcess(analyzer_path, args.str(), "", kProcessWaitInfinite, should_print_cmd, analyzer_output,
+                                           analyzer_errors, exit_code) == KcUtils::ProcessStatus::kSuccess;
 
             if (is_ok)
             {
@@ -331,3 +386,119 @@ beKA::beStatus beKA::BeStaticIsaAnalyzer::GenerateControlFlowGraph(const gtStrin
 
     return ret;
 }
+
+// Perform the given analysis with the external analyzer.
+static beKA::beStatus PerformAnalysisWithShae(const BeStaticIsaAnalysisRequest& request, bool should_print_cmd)
+{
+    gtString isa_filename, target, output_filename;
+    isa_filename << request.isa_filename.c_str();
+    target << request.target.c_str();
+    output_filename << request.output_filename.c_str();
+
+    beStatus ret = kBeStatusGeneralFailed;
+    switch (request.type)
+    {
+    case BeStaticIsaAnalysisType::kLiveVgpr:
+    case BeStaticIsaAnalysisType::kLiveSgpr:
+        ret = PerformLiveRegisterAnalysisWithShae(isa_filename, target, output_filename, request.wave_size, should_print_cmd,
+                                                  request.type == BeStaticIsaAnalysisType::kLiveSgpr);
+        break;
+    case BeStaticIsaAnalysisType::kCfgPerBlock:
+    case BeStaticIsaAnalysisType::kCfgPerInstruction:
+        ret = GenerateControlFlowGraphWithShae(isa_filename, target, output_filename, request.type == BeStaticIsaAnalysisType::kCfgPerInstruction,
+                                               should_print_cmd);
+        break;
+    default:
+        // We shouldn't get here.
+        assert(false);
+        break;
+    }
+    return ret;
+}
+
+void beKA::BeStaticIsaAnalyzer::SetInProcessEngineEnabled(bool is_enabled)
+{
+    is_in_process_engine_enabled = is_enabled;
+}
+
+beKA::beStatus beKA::BeStaticIsaAnalyzer::PerformLiveRegisterAnalysis(const gtString& isa_filename, const gtString& target,
+                                                                      const gtString& output_filename,
+                                                                      beWaveSize      wave_size,
+                                                                      bool            should_print_cmd,
+                                                                      bool            is_reg_type_sgpr)
+{
+    beStatus ret = kBeStatusStaticIsaAnalysisFailed;
+    if (is_in_process_engine_enabled)
+    {
+        BeMappedFile isa_file;
+        BeIsaProgram program;
+        if (isa_file.Open(isa_filename.asASCIICharArray()) && program.Parse(isa_file.GetText()))
+        {
+            ret = PerformLiveRegisterAnalysisInProcess(program, target.asASCIICharArray(), output_filename.asASCIICharArray(), wave_size, is_reg_type_sgpr);
+        }
+    }
+    if (ret == kBeStatusStaticIsaAnalysisFailed)
+    {
+        ret = PerformLiveRegisterAnalysisWithShae(isa_filename, target, output_filename, wave_size, should_print_cmd, is_reg_type_sgpr);
+    }
+
+    return ret;
+}
+
+beKA::beStatus beKA::BeStaticIsaAnalyzer::GenerateControlFlowGraph(const gtString& isa_filename, const gtString& target, const gtString& output_filename,
+    bool is_per_instruction, bool should_print_cmd)
+{
+    beStatus ret = kBeStatusStaticIsaAnalysisFailed;
+    if (is_in_process_engine_enabled)
+    {
+        BeMappedFile isa_file;
+        BeIsaProgram program;
+        if (isa_file.Open(isa_filename.asASCIICharArray()) && program.Parse(isa_file.GetText()))
+        {
+            ret = GenerateControlFlowGraphInProcess(program, output_filename.asASCIICharArray(), is_per_instruction);
+        }
+    }
+    if (ret == kBeStatusStaticIsaAnalysisFailed)
+    {
+        ret = GenerateControlFlowGraphWithShae(isa_filename, target, output_filename, is_per_instruction, should_print_cmd);
+    }
+
+    return ret;
+}
+
+void beKA::BeStaticIsaAnalyzer::GroupRequestsByFile(const std::vector<BeStaticIsaAnalysisRequest>& requests, std::vector<std::vector<size_t>>& file_requests)
+{
+    std::unordered_map<std::string, size_t> file_indices;
+    file_requests.clear();
+    for (size_t i = 0; i < requests.size(); i++)
+    {
+        auto iter = file_indices.emplace(requests[i].isa_filename, file_requests.size());
+        if (iter.second)
+        {
+            file_requests.emplace_back();
+        }
+        file_requests[iter.first->second].push_back(i);
+    }
+}
+
+void beKA::BeStaticIsaAnalyzer::PerformFileAnalyses(std::vector<BeStaticIsaAnalysisRequest>& requests, const std::vector<size_t>& request_indices,
+                                                     bool should_print_cmd)
+{
+    if (!request_indices.empty())
+    {
+        // The file is parsed once, and all of its analyses run on the parsed program.
+        BeMappedFile isa_file;
+        BeIsaProgram program;
+        const bool   is_parsed = is_in_process_engine_enabled && isa_file.Open(requests[request_indices.front()].isa_filename) &&
+                               program.Parse(isa_file.GetText());
+        for (size_t request_index : request_indices)
+        {
+            BeStaticIsaAnalysisRequest& request = requests[request_index];
+            request.status = (is_parsed ? PerformAnalysisInProcess(program, request) : kBeStatusStaticIsaAnalysisFailed);
+            if (request.status == kBeStatusStaticIsaAnalysisFailed)
+            {
+                request.status = PerformAnalysisWithShae(request, should_print_cmd);
+            }
+        }
+    }
+}
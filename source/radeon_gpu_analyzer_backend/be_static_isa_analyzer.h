@@ -8,6 +8,10 @@
 #ifndef RGA_RADEONGPUANALYZERBACKEND_SRC_BE_STATIC_ISA_ANALYZER_H_
 #define RGA_RADEONGPUANALYZERBACKEND_SRC_BE_STATIC_ISA_ANALYZER_H_
 
+// C++.
+#include <string>
+#include <vector>
+
 // Infra.
 #include "external/amdt_base_tools/Include/gtString.h"
 
@@ -17,12 +21,47 @@
 
 namespace beKA
 {
+    // Type of an ISA static analysis.
+    enum class BeStaticIsaAnalysisType
+    {
+        kLiveVgpr,
+        kLiveSgpr,
+        kCfgPerBlock,
+        kCfgPerInstruction
+    };
+
+    // A single analysis of a batch of ISA static analyses.
+    struct BeStaticIsaAnalysisRequest
+    {
+        // The analysis to perform.
+        BeStaticIsaAnalysisType type = BeStaticIsaAnalysisType::kLiveVgpr;
+
+        // The ISA disassembly file.
+        std::string isa_filename;
+
+        // The target device name.
+        std::string target;
+
+        // The file to write the analysis output to.
+        std::string output_filename;
+
+        // The wave size (live register analysis only). kUnknown lets the analysis deduce it from the disassembly.
+        beWaveSize wave_size = kUnknown;
+
+        // The result of the analysis (set by PerformFileAnalyses).
+        beStatus status = kBeStatusInvalid;
+    };
+
     class BeStaticIsaAnalyzer
     {
     public:
     // Pre-processes the ISA disassembly to allow it to be parsed by the static analysis engine.
     static beStatus PreprocessIsaFile(const std::string& isa_filename, const std::string& output_filename);
 
+    // Run the analyses with the in-process analysis engine instead of the external analyzer (disabled by default).
+    // The external analyzer is still launched for ISA that the engine cannot analyze.
+    static void SetInProcessEngineEnabled(bool is_enabled);
+
     // Perform live register analysis on the ISA disassembly contained in the given file,
     // and dump the analysis output to another file.
     static beStatus PerformLiveRegisterAnalysis(const gtString& isa_filename, const gtString& target,
@@ -31,6 +70,14 @@ namespace beKA
     // Generate control flow graph for the ISA disassembly contained in the given file, and dump the analysis output to another file.
     static beStatus GenerateControlFlowGraph(const gtString& isa_filename, const gtString& target, const gtString& output_filename, bool is_per_instruction, bool should_print_cmd);
 
+    // Group a batch of analyses (typically all the analyses of a session) by ISA file.
+    // Each group holds the indices of the requests that analyze the same file, and can be analyzed independently of the other groups.
+    static void GroupRequestsByFile(const std::vector<BeStaticIsaAnalysisRequest>& requests, std::vector<std::vector<size_t>>& file_requests);
+
+    // Perform the given requests of a batch, which all analyze the same ISA file, and store the result of each analysis in its request.
+    // With the in-process engine, the file is mapped and parsed once for all of its analyses.
+    static void PerformFileAnalyses(std::vector<BeStaticIsaAnalysisRequest>& requests, const std::vector<size_t>& request_indices, bool should_print_cmd);
+
 private:
     // No instances.
     BeStaticIsaAnalyzer(const BeStaticIsaAnalyzer& other);
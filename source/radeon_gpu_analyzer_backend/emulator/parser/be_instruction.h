@@ -15,7 +15,7 @@
 // C++.
 #include <math.h>
 #include <string>
-#include <unordered_map>
+#include <string_view>
 
 // Infra.
 #include "DeviceInfo.h"
@@ -162,10 +162,30 @@ public:
     // 64 bit instruction.
     typedef uint64_t Instruction64Bit;
 
+    // Device variants that have different instruction cycle counts.
+    enum DevicePerfVariant
+    {
+        // Hybrid architecture.
+        kDevicePerfVariantHybrid,
+
+        // Half double rate devices.
+        kDevicePerfVariantHalfRate,
+
+        // Quarter double rate devices.
+        kDevicePerfVariantQuarterRate
+    };
+
+    // The ID of an opcode that is not in the performance table.
+    static const int kUnknownOpcodeId = -1;
+
+    // Get the ID of the given (lower case) opcode in the performance table, or kUnknownOpcodeId.
+    static int GetOpcodeId(std::string_view opcode);
+
     Instruction(unsigned int instructionWidth, InstructionCategory instructionFormatKind, InstructionSet instructionFormat, int label_ = kNoLabel, int iGotoLabel = kNoLabel);
 
-    // ctor for label instruction
-    explicit Instruction(const std::string& labelString);
+    // ctor for label instruction.
+    // The label text is referenced, not copied, so it must outlive the instruction.
+    explicit Instruction(std::string_view labelString, int label = kNoLabel);
 
     virtual ~Instruction() = default;
 
@@ -186,10 +206,11 @@ public:
     void SetLineNumber(int iLineNumber) { line_number_ = iLineNumber; }
 
     // Get the source line (and its number) that was translated to this instructions.
-    std::pair<int, std::string>  GetSrcLineInfo() const { return { src_line_number_, src_line_ }; }
+    std::pair<int, std::string_view>  GetSrcLineInfo() const { return { src_line_number_, src_line_ }; }
 
     // Set the source line (and its number) that was translated to this instructions.
-    void SetSrcLineInfo(int lineNum, const std::string& line) { src_line_number_ = lineNum; src_line_ = line; }
+    // The line text is referenced, not copied, so it must outlive the instruction.
+    void SetSrcLineInfo(int lineNum, std::string_view line) { src_line_number_ = lineNum; src_line_ = line; }
 
     // Get the label if any where instruction is a branch.
     int GetGotoLabel() const { return goto_label_; }
@@ -200,44 +221,56 @@ public:
     // Get instruction cycle count for a given target.
     int GetInstructionClockCount(const std::string& deviceName) const;
 
+    // Get instruction cycle count for the given device variant (0 if unknown).
+    int GetInstructionClockCount(DevicePerfVariant deviceVariant) const;
+
+    // Get the ID of the instruction's opcode in the performance table (resolved when the opcode is set).
+    int GetOpcodeId() const { return opcode_id_; }
+
     // The Instruction Asic HW generation. default is SI
     GDT_HW_GENERATION GetHwGen() const { return hw_gen_; }
     void SetHwGen(GDT_HW_GENERATION HwGen) { hw_gen_ = HwGen; }
 
+    // The string representation of the instruction is referenced, not copied: the text that is passed
+    // to the setters must outlive the instruction (typically, it is stored in the parser's InstructionArena).
+
     // String representation of the instruction's opcode.
-    const std::string& GetInstructionOpCode() const { return instruction_opcode_; }
+    std::string_view GetInstructionOpCode() const { return instruction_opcode_; }
 
     // String representation of the instruction's parameters.
-    const std::string& GetInstructionParameters() const { return parameters_; }
+    std::string_view GetInstructionParameters() const { return parameters_; }
 
     // String representation of the instruction's binary representation.
-    const std::string& GetInstructionBinaryRep() const { return binary_representation_; }
+    std::string_view GetInstructionBinaryRep() const { return binary_representation_; }
 
     // String representation of the instruction's offset within the program.
-    const std::string& GetInstructionOffset() const { return offset_in_bytes_; }
+    std::string_view GetInstructionOffset() const { return offset_in_bytes_; }
 
     // Sets the string representation of the instruction's opcode.
-    void SetInstructionOpCode(const std::string& opCode) { instruction_opcode_ = opCode; }
+    void SetInstructionOpCode(std::string_view opCode) { instruction_opcode_ = opCode; opcode_id_ = GetOpcodeId(opCode); }
 
     // Sets the string representation of the instruction's parameters.
-    void SetInstructionParameters(const std::string& params) { parameters_ = params; }
+    void SetInstructionParameters(std::string_view params) { parameters_ = params; }
 
     // Sets the string representation of the instruction's binary representation.
-    void SetInstructionBinaryRep(const std::string& binaryRep) { binary_representation_ = binaryRep; }
+    void SetInstructionBinaryRep(std::string_view binaryRep) { binary_representation_ = binaryRep; }
 
     // Sets the string representation of the instruction's offset within the program.
-    void SetInstructionOffset(const std::string& offset) { offset_in_bytes_ = offset; }
+    void SetInstructionOffset(std::string_view offset) { offset_in_bytes_ = offset; }
 
-    // Sets the string representation of the instruction: opcode, parameters, binary representation and offset within the program.
-    void SetInstructionStringRepresentation(const std::string& opCode,
-        const std::string& params, const std::string& binaryRep, const std::string& offset);
+    // Sets the string representation of the instruction: opcode (in lower case), parameters, binary representation and offset within the program.
+    void SetInstructionStringRepresentation(std::string_view opCode,
+        std::string_view params, std::string_view binaryRep, std::string_view offset);
 
     // Returns pointing label string
-    const std::string& GetPointingLabelString() const { return pointing_label_string_; }
+    std::string_view GetPointingLabelString() const { return pointing_label_string_; }
 
     // Generates a comma separated string representation of the instruction.
     void GetCsvString(const std::string& deviceName, bool srcLineInfo, std::string& commaSeparatedString)const;
 
+    // Appends the comma separated string representation of the instruction to the given text.
+    void AppendCsvString(const std::string& deviceName, bool srcLineInfo, std::string& csvText) const;
+
 protected:
 
     // Instruction format kind.
@@ -262,58 +295,31 @@ protected:
     int line_number_;
 
     // String representation of the instruction's opcode.
-    std::string instruction_opcode_;
+    std::string_view instruction_opcode_;
 
-private:
-
-    // Initializes the performance tables.
-    static void SetUpPerfTables();
-
-    // Initializes the hybrid architecture performance tables.
-    static void SetUpHybridPerfTables();
+    // ID of the instruction's opcode in the performance table.
+    int opcode_id_ = kUnknownOpcodeId;
 
-    // Initializes the scalar performance tables.
-    static void SetUpScalarPerfTables();
-
-    // Initializes quarter devices performance tables.
-    static void SetUpQuarterDevicesPerfTables();
-
-    // Initializes half devices performance tables.
-    static void SetUpHalfDevicesPerfTables();
+private:
 
     // String representation of the parameters.
-    std::string parameters_;
+    std::string_view parameters_;
 
     // String of the binary representation of the instruction (e.g. 0xC2078914).
-    std::string binary_representation_;
+    std::string_view binary_representation_;
 
     // String representation of the offset in bytes of the current instruction
     // from the beginning of the program.
-    std::string offset_in_bytes_;
+    std::string_view offset_in_bytes_;
 
     // If this instruction is being pointed by a label, this member will hold the label.
-    std::string pointing_label_string_;
+    std::string_view pointing_label_string_;
 
     // Corresponding source line.
-    std::string src_line_;
+    std::string_view src_line_;
 
     // Corresponding source line number.
     int src_line_number_;
-
-    // Indicates whether the performance tables were initialized or not.
-    static bool is_perf_tables_initialized_;
-
-    // Holds the cycles per instruction for the 1/2 device architecture.
-    static std::unordered_map<std::string, int> half_device_perf_table_;
-
-    // Holds the cycles per instruction for the 1/4 device architecture.
-    static std::unordered_map<std::string, int> quarter_device_perf_table_;
-
-    // Holds the cycles per instruction for the 1/16 device architecture.
-    static std::unordered_map<std::string, int> hybrid_device_perf_table_;
-
-    // Holds the cycles per instruction for the scalar instructions.
-    static std::unordered_map<std::string, int> scalar_device_perf_table_;
 };
 
 #endif //RGA_RADEONGPUANALYZERBACKEND_SRC_EMULATOR_PARSER_BE_INSTRUCTION_H_
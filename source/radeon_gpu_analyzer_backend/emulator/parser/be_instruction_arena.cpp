@@ -0,0 +1,87 @@
+//=============================================================================
+/// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Implementation for the arena that holds the instructions and text of a parsed shader isa.
+//=============================================================================
+
+// C++.
+#include <algorithm>
+#include <cstring>
+
+// Local.
+#include "be_instruction_arena.h"
+
+// Size of a memory block of the arena.
+static const size_t kArenaBlockSize = 64 * 1024;
+
+std::string_view InstructionArena::Store(std::string_view text)
+{
+    std::string_view ret;
+    if (!text.empty())
+    {
+        char* copy = static_cast<char*>(Allocate(text.size(), 1));
+        std::memcpy(copy, text.data(), text.size());
+        ret = std::string_view(copy, text.size());
+    }
+
+    return ret;
+}
+
+std::string_view InstructionArena::Intern(std::string_view text)
+{
+    std::string_view ret;
+    auto iter = interned_strings_.find(text);
+    if (iter != interned_strings_.end())
+    {
+        ret = *iter;
+    }
+    else
+    {
+        ret = Store(text);
+        interned_strings_.insert(ret);
+    }
+
+    return ret;
+}
+
+void InstructionArena::Reset()
+{
+    interned_strings_.clear();
+    current_block_  = 0;
+    current_offset_ = 0;
+}
+
+void* InstructionArena::Allocate(size_t size, size_t alignment)
+{
+    void* ret = nullptr;
+    while (ret == nullptr)
+    {
+        if (current_block_ < blocks_.size())
+        {
+            Block& block  = blocks_[current_block_];
+            size_t offset = (current_offset_ + alignment - 1) & ~(alignment - 1);
+            if (offset + size <= block.size)
+            {
+                ret             = block.data.get() + offset;
+                current_offset_ = offset + size;
+            }
+            else
+            {
+                // Move to the next block.
+                ++current_block_;
+                current_offset_ = 0;
+            }
+        }
+        else
+        {
+            // All blocks are used: add a new one, large enough for the requested size.
+            Block block;
+            block.size = std::max(kArenaBlockSize, size);
+            block.data.reset(new char[block.size]);
+            blocks_.push_back(std::move(block));
+        }
+    }
+
+    return ret;
+}
@@ -0,0 +1,74 @@
+//=============================================================================
+/// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Header for the arena that holds the instructions and text of a parsed shader isa.
+//=============================================================================
+
+#ifndef RGA_RADEONGPUANALYZERBACKEND_SRC_EMULATOR_PARSER_BE_INSTRUCTION_ARENA_H_
+#define RGA_RADEONGPUANALYZERBACKEND_SRC_EMULATOR_PARSER_BE_INSTRUCTION_ARENA_H_
+
+// C++.
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <string_view>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+// Bump allocator for the instructions of a parsed shader and the text that they refer to.
+// Memory is allocated in large blocks, so parsing a shader requires only a handful of heap allocations.
+// Objects created in the arena are never destructed: Reset() simply rewinds the arena and keeps its blocks
+// for the next shader. Therefore, types created in the arena must not own resources.
+class InstructionArena
+{
+public:
+    InstructionArena() = default;
+    ~InstructionArena() = default;
+
+    InstructionArena(const InstructionArena&) = delete;
+    InstructionArena& operator=(const InstructionArena&) = delete;
+
+    // Construct an object of type T in the arena.
+    template <typename T, typename... Args>
+    T* Create(Args&&... args)
+    {
+        void* memory = Allocate(sizeof(T), alignof(T));
+        return new (memory) T(std::forward<Args>(args)...);
+    }
+
+    // Copy the given text into the arena and return a view of the copy.
+    std::string_view Store(std::string_view text);
+
+    // Return a view of the arena copy of the given text. Identical texts share a single copy.
+    std::string_view Intern(std::string_view text);
+
+    // Discard all objects and text. The memory blocks are kept for reuse.
+    void Reset();
+
+private:
+    // Allocate aligned memory from the current block, moving to the next block if needed.
+    void* Allocate(size_t size, size_t alignment);
+
+    // A memory block of the arena.
+    struct Block
+    {
+        std::unique_ptr<char[]> data;
+        size_t                  size = 0;
+    };
+
+    // The memory blocks of the arena.
+    std::vector<Block> blocks_;
+
+    // Index of the block that is currently used for allocations.
+    size_t current_block_ = 0;
+
+    // Offset of the first free byte in the current block.
+    size_t current_offset_ = 0;
+
+    // The interned strings (views into the arena).
+    std::unordered_set<std::string_view> interned_strings_;
+};
+
+#endif //RGA_RADEONGPUANALYZERBACKEND_SRC_EMULATOR_PARSER_BE_INSTRUCTION_ARENA_H_
@@ -8,18 +8,12 @@
 #define _HAS_AUTO_PTR_ETC 1
 
 // C++.
+#include <algorithm>
+#include <cctype>
+#include <charconv>
 #include <fstream>
 #include <string>
-
-// Boost.
-#ifdef _WIN32
-#pragma warning(push)
-#pragma warning(disable : 4996)
-#endif
-#include <boost/regex.hpp>
-#ifdef _WIN32
-#pragma warning(pop)
-#endif
+#include <string_view>
 
 #include "amdt_os_wrappers/Include/osDebugLog.h"
 
@@ -50,19 +44,39 @@ static const std::string kIsaLabelToken2 = "BB";
 static const std::string kIsaBranchToken  = "branch";
 static const std::string kIsaCallToken    = "call";
 
-static bool ExtractRuntimeChangedNumOfGprs(const std::string& isa_line, unsigned int& num_gprs)
+// Number of hex digits in the text representation of a 32-bit instruction word.
+static const size_t kDwordHexDigits = 8;
+
+// Lengths of the instruction address in SCPC disassembly annotations.
+static const size_t kShortAddressHexDigits = 8;
+static const size_t kLongAddressHexDigits  = 12;
+
+// Binary encoding of an ISA instruction, as annotated in the disassembly.
+struct IsaInstructionEncoding
+{
+    // The first 32-bit word of the instruction.
+    uint32_t first_dword = 0;
+
+    // The second 32-bit word of the instruction (only valid if has_second_dword is true).
+    uint32_t second_dword = 0;
+
+    // True if the annotation holds two 32-bit words.
+    bool has_second_dword = false;
+};
+
+static bool ExtractRuntimeChangedNumOfGprs(std::string_view isa_line, unsigned int& num_gprs)
 {
     bool ret = false;
-    const std::string kChangedByRuntimeToken = "modified by runtime to be ";
+    const std::string_view kChangedByRuntimeToken = "modified by runtime to be ";
     size_t pos_begin = isa_line.find(kChangedByRuntimeToken);
-    if (pos_begin != std::string::npos)
+    if (pos_begin != std::string_view::npos)
     {
         // Handles the case where the number of SGPRs was changed by the runtime.
         pos_begin += kChangedByRuntimeToken.size();
-        size_t pos_end = isa_line.find(";", pos_begin);
+        size_t pos_end = isa_line.find(';', pos_begin);
         if (pos_end > pos_begin)
         {
-            const std::string kNumAsText = isa_line.substr(pos_begin, pos_end - pos_begin);
+            const std::string kNumAsText(isa_line.substr(pos_begin, pos_end - pos_begin));
             num_gprs = std::stoul(kNumAsText);
             ret = true;
         }
@@ -71,6 +85,205 @@ static bool ExtractRuntimeChangedNumOfGprs(const std::string& isa_line, unsigned
     return ret;
 }
 
+// Extract the next line from the text, starting at the given offset, and advance the offset past its line break.
+// A trailing carriage return is not part of the line, so that CRLF text is read like LF text.
+// Returns false when the end of the text was reached.
+static bool GetNextLine(std::string_view text, size_t& offset, std::string_view& line)
+{
+    bool ret = false;
+    if (offset < text.size())
+    {
+        size_t line_end = text.find('\n', offset);
+        if (line_end == std::string_view::npos)
+        {
+            line_end = text.size();
+        }
+        line   = text.substr(offset, line_end - offset);
+        offset = line_end + 1;
+        if (!line.empty() && line.back() == '\r')
+        {
+            line.remove_suffix(1);
+        }
+        ret = true;
+    }
+
+    return ret;
+}
+
+// Reads the lines of an ISA disassembly.
+// If the HSAIL disassembly tokens are implied, the reader produces the lines of
+// kStrHsailDisassemblyTokenStart + isa + kStrHsailDisassemblyTokenEnd + "\n" without copying the ISA text.
+class IsaLineReader
+{
+public:
+    IsaLineReader(std::string_view isa, bool is_hsail_tokens_implied)
+        : isa_(isa)
+        , is_hsail_tokens_implied_(is_hsail_tokens_implied)
+    {
+        // The end token starts with a line break, so an ISA text that ends with a line break is followed by an empty line.
+        const bool is_newline_terminated = (!isa.empty() && isa.back() == '\n');
+        next_trailing_line_ = (is_newline_terminated ? 0 : 1);
+    }
+
+    // Read the next line. Returns false when there are no more lines.
+    bool ReadLine(std::string_view& line)
+    {
+        // The lines that follow the ISA text when the tokens are implied.
+        static const std::string_view kTrailingLines[] = {"", "end", ""};
+        static const size_t           kTrailingLineCount = sizeof(kTrailingLines) / sizeof(kTrailingLines[0]);
+
+        bool ret = false;
+        if (is_hsail_tokens_implied_ && !is_first_line_read_)
+        {
+            // The start token is prepended to the first line.
+            std::string_view first_line;
+            GetNextLine(isa_, offset_, first_line);
+            first_line_.assign(kStrHsailDisassemblyTokenStart).append(first_line);
+            line                = first_line_;
+            is_first_line_read_ = true;
+            ret                 = true;
+        }
+        else if (GetNextLine(isa_, offset_, line))
+        {
+            ret = true;
+        }
+        else if (is_hsail_tokens_implied_ && next_trailing_line_ < kTrailingLineCount)
+        {
+            line = kTrailingLines[next_trailing_line_++];
+            ret  = true;
+        }
+
+        return ret;
+    }
+
+private:
+    // The ISA text.
+    std::string_view isa_;
+
+    // Offset of the next line in the ISA text.
+    size_t offset_ = 0;
+
+    // True if the HSAIL disassembly tokens are implied.
+    bool is_hsail_tokens_implied_ = false;
+
+    // True if the first line was read.
+    bool is_first_line_read_ = false;
+
+    // The first line, including the start token (only used if the tokens are implied).
+    std::string first_line_;
+
+    // Index of the next trailing line to read (only used if the tokens are implied).
+    size_t next_trailing_line_ = 0;
+};
+
+// Returns the offset of the first non-blank character at or after the given offset.
+static size_t SkipBlanks(std::string_view text, size_t offset)
+{
+    while (offset < text.size() && (text[offset] == ' ' || text[offset] == '\t'))
+    {
+        ++offset;
+    }
+
+    return offset;
+}
+
+// Returns the number of consecutive hex digits at the given offset.
+static size_t CountHexDigits(std::string_view text, size_t offset)
+{
+    size_t ret = 0;
+    while (offset + ret < text.size() && std::isxdigit(static_cast<unsigned char>(text[offset + ret])))
+    {
+        ++ret;
+    }
+
+    return ret;
+}
+
+// Parse the 8 hex digits at the given offset as a 32-bit instruction word.
+static bool ParseHexDword(std::string_view text, size_t offset, uint32_t& dword)
+{
+    bool ret = false;
+    if (offset + kDwordHexDigits <= text.size())
+    {
+        const char* digits_begin = text.data() + offset;
+        const char* digits_end   = digits_begin + kDwordHexDigits;
+        auto        result       = std::from_chars(digits_begin, digits_end, dword, 16);
+        ret = (result.ec == std::errc() && result.ptr == digits_end);
+    }
+
+    return ret;
+}
+
+// Parse the instruction encoding that follows an annotation token ("//" or ";") at the given offset.
+// If is_address_expected is true, the encoding is preceded by an 8 or 12 digit address and a colon.
+static bool ParseEncodingAnnotation(std::string_view isa_line, size_t offset, bool is_address_expected, IsaInstructionEncoding& encoding)
+{
+    bool ret = false;
+    offset = SkipBlanks(isa_line, offset);
+    if (is_address_expected)
+    {
+        const size_t address_length = CountHexDigits(isa_line, offset);
+        const size_t address_end    = offset + address_length;
+        const bool   is_address     = (address_length == kShortAddressHexDigits || address_length == kLongAddressHexDigits);
+        offset = (is_address && address_end < isa_line.size() && isa_line[address_end] == ':') ? SkipBlanks(isa_line, address_end + 1) : std::string_view::npos;
+    }
+
+    if (offset != std::string_view::npos && ParseHexDword(isa_line, offset, encoding.first_dword))
+    {
+        const size_t first_dword_end     = offset + kDwordHexDigits;
+        const size_t second_dword_offset = SkipBlanks(isa_line, first_dword_end);
+        encoding.has_second_dword = (second_dword_offset > first_dword_end && ParseHexDword(isa_line, second_dword_offset, encoding.second_dword));
+        ret = true;
+    }
+
+    return ret;
+}
+
+// Extract the binary encoding of the instruction from its disassembly annotation.
+// Recognizes both annotation formats in a single backward scan of the line:
+// SCPC: v_add_u32     v1, s[2:3], v0, s0    // 000000000130: D1190201 00000100
+// LLPC: exp pos0 v1, v0, v3, v2 done; C40008CF 02030001
+// The LLPC format is only recognized if is_llpc_annotation_enabled is true.
+static bool ExtractInstructionEncoding(std::string_view isa_line, bool is_llpc_annotation_enabled, IsaInstructionEncoding& encoding)
+{
+    bool ret = false;
+
+    // The annotation is at the end of the line, so look for the last annotation token that is followed by a valid encoding.
+    for (size_t pos = isa_line.size(); !ret && pos > 0; --pos)
+    {
+        const size_t token_offset = pos - 1;
+        if (isa_line[token_offset] == '/' && token_offset > 0 && isa_line[token_offset - 1] == '/')
+        {
+            ret = ParseEncodingAnnotation(isa_line, token_offset + 1, true, encoding);
+        }
+        else if (is_llpc_annotation_enabled && isa_line[token_offset] == ';')
+        {
+            ret = ParseEncodingAnnotation(isa_line, token_offset + 1, false, encoding);
+        }
+    }
+
+    return ret;
+}
+
+// Extract the value of a "<key> = <number>" statement from the given line.
+static bool ExtractStatementValue(std::string_view isa_line, std::string_view key, unsigned int& value)
+{
+    bool ret = false;
+    for (size_t pos = isa_line.find(key); !ret && pos != std::string_view::npos; pos = isa_line.find(key, pos + 1))
+    {
+        size_t value_offset = SkipBlanks(isa_line, pos + key.size());
+        if (value_offset < isa_line.size() && isa_line[value_offset] == '=')
+        {
+            value_offset = SkipBlanks(isa_line, value_offset + 1);
+            value = 0;
+            std::from_chars(isa_line.data() + value_offset, isa_line.data() + isa_line.size(), value);
+            ret = true;
+        }
+    }
+
+    return ret;
+}
+
 // Trim from the start.
 static std::string& trimStart(std::string& str_to_trim)
 {
@@ -186,6 +399,12 @@ ParserIsa::ParserIsa(ParserSi::LoggingCallBackFuncP log_function)
     parser_si_[Instruction::kInstructionSetExp] = new ParserSiExp();
     parser_si_[Instruction::kInstructionSetVop] = new ParserSiVop();
     parser_si_[Instruction::kInstructionSetFlat] = new ParserFLAT();
+
+    // All instructions are created in the arena of this parser.
+    for (auto& parser : parser_si_)
+    {
+        parser.second->SetInstructionArena(&instruction_arena_);
+    }
 }
 
 ParserIsa::~ParserIsa()
@@ -255,13 +474,13 @@ bool ParserIsa::Parse(const std::string& isa_line, GDT_HW_GENERATION asic_genera
     {
         // Push an instruction of an arbitrary type into the collection so the ISA view can display the text of this instruction.
         // The textual part that is displayed in the ISA view is added in the next if block below.
-        instruction = new SIVOP1Instruction(32, VOPInstruction::kEncodingVop1, SIVOP1Instruction::kNOP, kNoLabel, kNoLabel);
+        instruction = instruction_arena_.Create<SIVOP1Instruction>(32, VOPInstruction::kEncodingVop1, SIVOP1Instruction::kNOP, kNoLabel, kNoLabel);
     }
 
     if (instruction != NULL)
     {
         instruction->SetLineNumber(line_count);
-        instruction->SetSrcLineInfo(src_line_number, src_line);
+        instruction->SetSrcLineInfo(src_line_number, instruction_arena_.Intern(src_line));
         instructions_.push_back(instruction);
 
         std::string opcode;
@@ -274,7 +493,7 @@ bool ParserIsa::Parse(const std::string& isa_line, GDT_HW_GENERATION asic_genera
         if (ret)
         {
             // Set the ISA instruction's string representation.
-            instruction->SetInstructionStringRepresentation(opcode, params, binary_representation, offset);
+            SetInstructionText(*instruction, opcode, params, binary_representation, offset);
         }
     }
 
@@ -332,7 +551,7 @@ bool ParserIsa::Parse(const std::string& isa_line, GDT_HW_GENERATION asic_genera
     {
         // Push an instruction of an arbitrary type into the collection so the ISA view can display the text of this instruction.
         // The textual part that is displayed in the ISA view is added in the next if block below.
-        instruction = new SIVOP1Instruction(32, VOPInstruction::kEncodingVop1, SIVOP1Instruction::kNOP, kNoLabel, kNoLabel);
+        instruction = instruction_arena_.Create<SIVOP1Instruction>(32, VOPInstruction::kEncodingVop1, SIVOP1Instruction::kNOP, kNoLabel, kNoLabel);
     }
 
     if (instruction != NULL)
@@ -340,7 +559,7 @@ bool ParserIsa::Parse(const std::string& isa_line, GDT_HW_GENERATION asic_genera
         if (kNoLabel == instruction->GetLabel())
         {
             instruction->SetLineNumber(line_count);
-            instruction->SetSrcLineInfo(src_line_number, src_line);
+            instruction->SetSrcLineInfo(src_line_number, instruction_arena_.Intern(src_line));
             instructions_.push_back(instruction);
 
             // Set the ISA instruction's string representation.
@@ -352,7 +571,7 @@ bool ParserIsa::Parse(const std::string& isa_line, GDT_HW_GENERATION asic_genera
 
             if (ret)
             {
-                instruction->SetInstructionStringRepresentation(opcode, params, binary_representation, offset);
+                SetInstructionText(*instruction, opcode, params, binary_representation, offset);
             }
         }
     }
@@ -364,7 +583,7 @@ bool ParserIsa::Parse(const std::string& isa)
 {
     ResetInstsCounters();
 
-    bool ret = ParseToVector(isa);
+    bool ret = ParseToVector(isa, false);
     if (ret)
     {
         ret = isa_graph_.BuildISAProgramStructure(instructions_);
@@ -376,45 +595,31 @@ bool ParserIsa::ParseForSize(const std::string& isa)
 {
     bool ret = false;
     ResetInstsCounters();
-    boost::regex code_len_byte_ex("([[:blank:]]*codeLenInByte[[:blank:]]*=[[:blank:]]*)([[:digit:]]*)");
-    boost::regex code_len_byte_ni("([[:blank:]]*CodeLen[[:blank:]]*=[[:blank:]]*)([[:digit:]]*)");
 
     // SCPC disassembly format:
     // v_add_u32     v1, s[2:3], v0, s0    // 000000000130: D1190201 00000100   <--- 64-bit instruction
     // v_mov_b32     v0, 0                 // 000000000138: 7E000280            <--- 32-bit instruction
-    boost::regex instruction_annotation_scpc("//[[:blank:]]*[[:xdigit:]]{12}:[[:blank:]]*([[:xdigit:]]{8})([[:blank:]]+[[:xdigit:]]{8}){0,1}");
-
+    //
     // LLPC disassembly format:
-    // v_add_u32_e32 v0, s2, v0; 68000002                 <--- 64-bit instruction
-    // exp pos0 v1, v0, v3, v2 done; C40008CF 02030001    <--- 32-bit instruction
-    boost::regex instruction_annotation_llpc(";[[:blank:]]*([[:xdigit:]]{8})([[:blank:]]+[[:xdigit:]]{8}){0,1}");
-
-    std::istringstream isa_stream(isa);
-    boost::smatch match_instruction;
-    std::string isa_line;
+    // v_add_u32_e32 v0, s2, v0; 68000002                 <--- 32-bit instruction
+    // exp pos0 v1, v0, v3, v2 done; C40008CF 02030001    <--- 64-bit instruction
+    const std::string_view isa_text(isa);
+    std::string_view       isa_line;
+    size_t                 line_offset = 0;
+    IsaInstructionEncoding encoding;
     int  isa_size = 0;
 
-    while (getline(isa_stream, isa_line))
+    while (GetNextLine(isa_text, line_offset, isa_line))
     {
-        if (boost::regex_search(isa_line, match_instruction, code_len_byte_ex))
-        {
-            std::string code_len_text(match_instruction[2].first, match_instruction[2].second);
-            code_len_ = atoi(code_len_text.c_str());
-            ret = true;
-            break;
-        }
-        else if (boost::regex_search(isa_line, match_instruction, code_len_byte_ni))
+        if (ExtractStatementValue(isa_line, "codeLenInByte", code_len_) || ExtractStatementValue(isa_line, "CodeLen", code_len_))
         {
-            std::string code_len_text(match_instruction[2].first, match_instruction[2].second);
-            code_len_ = atoi(code_len_text.c_str());
             ret = true;
             break;
         }
-        else if (boost::regex_search(isa_line, match_instruction, instruction_annotation_scpc) ||
-            boost::regex_search(isa_line, match_instruction, instruction_annotation_llpc))
+        else if (ExtractInstructionEncoding(isa_line, true, encoding))
         {
             // Count size of instructions "manually" if ISA size is not provided by disassembler.
-            int instruction_size = match_instruction[(int) match_instruction.size() - 1].matched ? 8 : 4;
+            int instruction_size = encoding.has_second_dword ? 8 : 4;
             isa_size += instruction_size;
             ret = true;
         }
@@ -428,7 +633,7 @@ bool ParserIsa::ParseForSize(const std::string& isa)
     return ret;
 }
 
-static bool  GetSourceLineInfo(const std::string& isa_line, const std::string& prev_isa_line, std::string& src_line, int& src_line_number)
+static bool  GetSourceLineInfo(std::string_view isa_line, std::string_view prev_isa_line, std::string& src_line, int& src_line_number)
 {
     bool ret = false;
 
@@ -437,52 +642,55 @@ static bool  GetSourceLineInfo(const std::string& isa_line, const std::string& p
     // ; A[0] = 0.0f;                          <-- isaLine
     const size_t src_line_offset = 2;
     size_t colon_offset = 0;
-    if (prev_isa_line.find(';') == 0 && isa_line.find(';') == 0 && ((colon_offset = prev_isa_line.rfind(':')) != std::string::npos))
+    if (!prev_isa_line.empty() && prev_isa_line[0] == ';' && !isa_line.empty() && isa_line[0] == ';' &&
+        ((colon_offset = prev_isa_line.rfind(':')) != std::string_view::npos))
     {
-        src_line = isa_line.substr(src_line_offset);
-        src_line_number = std::atoi(prev_isa_line.substr(colon_offset + 1).c_str());
+        src_line = std::string(isa_line.substr(std::min(src_line_offset, isa_line.size())));
+        src_line_number = std::atoi(std::string(prev_isa_line.substr(colon_offset + 1)).c_str());
         ret = true;
     }
 
     return ret;
 }
 
-bool ParserIsa::ParseToVector(const std::string& isa)
+bool ParserIsa::Parse(std::string_view isa, bool is_hsail_tokens_implied)
+{
+    ResetInstsCounters();
+
+    bool ret = ParseToVector(isa, is_hsail_tokens_implied);
+    if (ret)
+    {
+        ret = isa_graph_.BuildISAProgramStructure(instructions_);
+    }
+    return ret;
+}
+
+bool ParserIsa::ParseToVector(std::string_view isa, bool is_hsail_tokens_implied)
 {
     int line_count = 0, src_line_number = 0;
     Instruction::Instruction32Bit inst32;
     Instruction::Instruction64Bit inst64;
 
-    std::istringstream isa_stream(isa);
+    // Lines are scanned in place. Only lines that hold instructions are copied, since the instructions keep their text.
+    IsaLineReader          line_reader(isa, is_hsail_tokens_implied);
+    std::string_view       isa_line_view, prev_line;
     std::string isa_line, src_line;
     bool isa_code_proc = false, parse_ok = true, gpr_proc = false, is_vgpr_found = false, is_sgpr_found = false, is_code_len_found = false;
     int label = kNoLabel, goto_label = kNoLabel;
-
-    boost::smatch match_instruction;
-
-    boost::regex regex_inst32_48("([[:print:]]*// [[:print:]]{12}: )([[:print:]]{8})");
-    boost::regex regex_inst32_48_llpc("([[:print:]]*; )([[:print:]]{8})");
-
-    boost::regex regex_inst64_48("([[:print:]]*// [[:print:]]{12}: )([[:print:]]{8})( )([[:print:]]{8})");
-    boost::regex regex_inst64_48_llpc("([[:print:]]*; )([[:print:]]{8})( )([[:print:]]{8})");
-
-    boost::regex regex_inst32("([[:print:]]*// [[:print:]]{8}: )([[:print:]]{8})");
-    boost::regex regex_inst_64("([[:print:]]*// [[:print:]]{8}: )([[:print:]]{8})( )([[:print:]]{8})");
-    boost::regex regex_vgpr("([[:blank:]]*NumVgprs[[:blank:]]*=[[:blank:]]*)([[:digit:]]*)");
-    boost::regex regex_sgprs("([[:blank:]]*NumSgprs[[:blank:]]*=[[:blank:]]*)([[:digit:]]*)");
-    boost::regex regex_code_length_bytes("([[:blank:]]*codeLenInByte[[:blank:]]*=[[:blank:]]*)([[:digit:]]*)");
-    boost::regex regex_code_length_bytes_ni("([[:blank:]]*CodeLen[[:blank:]]*=[[:blank:]]*)([[:digit:]]*)");
+    IsaInstructionEncoding encoding;
 
     std::string isa_start;
     std::string isa_end;
 
     bool is_llpc_disassembly = false;
-    if (isa.rfind("Disassembly for _amdgpu_", 0) == 0)
+    const std::string_view kLlpcEntryPointPrefix = "_amdgpu_";
+    if (is_hsail_tokens_implied ? (isa.substr(0, kLlpcEntryPointPrefix.size()) == kLlpcEntryPointPrefix)
+                                : (isa.rfind("Disassembly for _amdgpu_", 0) == 0))
     {
         is_llpc_disassembly = true;
     }
 
-    if (isa.find("Disassembly --------------------") != std::string::npos)
+    if (isa.find("Disassembly --------------------") != std::string_view::npos)
     {
         // OCL or non DX
         /// ISA SI + "starts" from "; -------- Disassembly --------------------"
@@ -493,12 +701,12 @@ bool ParserIsa::ParseToVector(const std::string& isa)
         isa_end = "; ----------------- CS Data ------------------------";
 
         // For Vulkan, we don't have the CS Data section.
-        if (isa.find(isa_end) == std::string::npos)
+        if (isa.find(isa_end) == std::string_view::npos)
         {
             isa_end = "end";
         }
     }
-    else if (isa.find(kStrHsailDisassemblyTokenStart) != std::string::npos)
+    else if (is_hsail_tokens_implied || isa.find(kStrHsailDisassemblyTokenStart) != std::string_view::npos)
     {
         // Shader entry point in HSAIL disassembly.
         isa_start = kStrHsailDisassemblyTokenStart;
@@ -517,15 +725,14 @@ bool ParserIsa::ParseToVector(const std::string& isa)
 
     GDT_HW_GENERATION asicGen = GDT_HW_GENERATION_NONE;
     // Asic generation is in "asic(".
-    const std::string kAsicGenStr("asic(");
-    std::string  prev_line = "";
+    const std::string_view kAsicGenStr("asic(");
 
-    while (getline(isa_stream, isa_line))
+    while (line_reader.ReadLine(isa_line_view))
     {
         line_count++;
 
-        if (!isa_code_proc && !gpr_proc && strstr(isa_line.c_str(), isa_start.c_str()) == NULL ||
-            GetSourceLineInfo(isa_line, prev_line, src_line, src_line_number))
+        if (!isa_code_proc && !gpr_proc && isa_line_view.find(isa_start) == std::string_view::npos ||
+            GetSourceLineInfo(isa_line_view, prev_line, src_line, src_line_number))
         {
             continue;
         }
@@ -533,8 +740,8 @@ bool ParserIsa::ParseToVector(const std::string& isa)
         {
             isa_code_proc = true;
         }
-        else if (isa_code_proc && strstr(isa_line.c_str(), isa_end.c_str()) != NULL
-                 && isa_line.find("//") == std::string::npos)
+        else if (isa_code_proc && isa_line_view.find(isa_end) != std::string_view::npos
+                 && isa_line_view.find("//") == std::string_view::npos)
         {
             // at least one line of valid code detected
             gpr_proc = true;
@@ -543,10 +750,10 @@ bool ParserIsa::ParseToVector(const std::string& isa)
         else if (isa_code_proc)
         {
             /// check generation first
-            size_t pos = isa_line.find(kAsicGenStr);
-            if (pos != std::string::npos)
+            size_t pos = isa_line_view.find(kAsicGenStr);
+            if (pos != std::string_view::npos)
             {
-                std::string tmp = isa_line.substr(pos + 5, 2);
+                std::string_view tmp = isa_line_view.substr(pos + kAsicGenStr.size(), 2);
 
                 if (tmp == "SI")
                 {
@@ -562,9 +769,7 @@ bool ParserIsa::ParseToVector(const std::string& isa)
                 }
             }
 
-            std::stringstream instruction_stream;
-            std::string::const_iterator isa_line_start = isa_line.begin();
-            std::string::const_iterator isa_line_end = isa_line.end();
+            isa_line.assign(isa_line_view.data(), isa_line_view.size());
             bool is_instruction_parsed = true;
 
             if (label == kNoLabel)
@@ -574,43 +779,28 @@ bool ParserIsa::ParseToVector(const std::string& isa)
 
             goto_label = GetGotoLabel(isa_line);
 
-            if ((boost::regex_search(isa_line_start, isa_line_end, match_instruction, regex_inst_64)) ||
-                (boost::regex_search(isa_line_start, isa_line_end, match_instruction, regex_inst64_48)) ||
-                (is_llpc_disassembly && boost::regex_search(isa_line_start, isa_line_end, match_instruction, regex_inst64_48_llpc)))
+            const bool is_encoding_found = ExtractInstructionEncoding(isa_line_view, is_llpc_disassembly, encoding);
+            if (is_encoding_found && encoding.has_second_dword)
             {
-                // This is either inst64Ex or inst64_48Ex.
-                std::string inst32_text_lower_case(match_instruction[2].first, match_instruction[2].second);
-                std::string inst32_text_upper_case(match_instruction[4].first, match_instruction[4].second);
-                instruction_stream << std::hex << inst32_text_upper_case << inst32_text_lower_case;
-                instruction_stream >> inst64;
+                // This is either a 64-bit instruction or a 32-bit instruction followed by a 32-bit literal.
+                inst64 = (static_cast<Instruction::Instruction64Bit>(encoding.second_dword) << 32) | encoding.first_dword;
                 is_instruction_parsed = Parse(isa_line, asicGen, inst64, src_line, src_line_number, label, goto_label, line_count);
                 label = goto_label = kNoLabel;
 
                 if (!is_instruction_parsed)
                 {
-                    uint32_t literal_32b = 0;
-                    instruction_stream.clear();
-                    instruction_stream << std::hex << inst32_text_lower_case;
-                    instruction_stream >> inst32;
-
-                    instruction_stream.clear();
-                    instruction_stream << std::hex << inst32_text_upper_case;
-                    instruction_stream >> literal_32b;
+                    uint32_t literal_32b = encoding.second_dword;
+                    inst32 = encoding.first_dword;
 
                     is_instruction_parsed = Parse(isa_line, asicGen, inst32, src_line, src_line_number, true, literal_32b, label, goto_label, line_count);
                     label = goto_label = kNoLabel;
 
                 }
             }
-            else if (is_instruction_parsed && (boost::regex_search(isa_line_start, isa_line_end, match_instruction, regex_inst32) ||
-                boost::regex_search(isa_line_start, isa_line_end, match_instruction, regex_inst32_48) ||
-                (is_llpc_disassembly && boost::regex_search(isa_line_start, isa_line_end, match_instruction, regex_inst32_48_llpc))))
+            else if (is_encoding_found)
             {
-                // This is either inst32Ex or inst32_48Ex.
-                std::string inst32_ext(match_instruction[2].first, match_instruction[2].second);
-
-                instruction_stream << std::hex << inst32_ext;
-                instruction_stream >> inst32;
+                // This is a 32-bit instruction.
+                inst32 = encoding.first_dword;
                 is_instruction_parsed = Parse(isa_line, asicGen, inst32, src_line, src_line_number, false, 0, label, goto_label, line_count);
                 label = goto_label = kNoLabel;
             }
@@ -618,7 +808,7 @@ bool ParserIsa::ParseToVector(const std::string& isa)
             {
                 Instruction* instruction = nullptr;
                 std::string trimmed_isa_line = trimStr(isa_line);
-                instruction = new Instruction(trimmed_isa_line);
+                instruction = instruction_arena_.Create<Instruction>(instruction_arena_.Store(trimmed_isa_line), label);
                 instructions_.push_back(instruction);
                 label = goto_label = kNoLabel;
             }
@@ -631,74 +821,66 @@ bool ParserIsa::ParseToVector(const std::string& isa)
         }
         else if (gpr_proc)
         {
-            std::string::const_iterator isa_line_start = isa_line.begin();
-            std::string::const_iterator isa_line_end   = isa_line.end();
-
-            if (boost::regex_search(isa_line_start, isa_line_end, match_instruction, regex_vgpr))
+            unsigned int gprs = 0;
+            if (ExtractStatementValue(isa_line_view, "NumVgprs", gprs))
             {
                 // Mark the VGPR section as found.
                 is_vgpr_found = true;
                 vgprs_ = 0;
 
                 // Check if the number of VGPRs was changed by the runtime.
-                bool is_changed_by_runtime = ExtractRuntimeChangedNumOfGprs(isa_line, vgprs_);
+                bool is_changed_by_runtime = ExtractRuntimeChangedNumOfGprs(isa_line_view, vgprs_);
                 if (!is_changed_by_runtime)
                 {
-                    // If the value was not changed, extract the original value.
-                    std::string vgprs_text(match_instruction[2].first, match_instruction[2].second);
-                    vgprs_ = atoi(vgprs_text.c_str());
+                    // If the value was not changed, use the original value.
+                    vgprs_ = gprs;
                 }
             }
-            else if (boost::regex_search(isa_line_start, isa_line_end, match_instruction, regex_sgprs))
+            else if (ExtractStatementValue(isa_line_view, "NumSgprs", gprs))
             {
                 // Mark the SGPR section as found.
                 is_sgpr_found = true;
                 sgprs_ = 0;
 
                 // Check if the number of SGPRs was changed by the runtime.
-                bool is_changed_by_runtime = ExtractRuntimeChangedNumOfGprs(isa_line, sgprs_);
+                bool is_changed_by_runtime = ExtractRuntimeChangedNumOfGprs(isa_line_view, sgprs_);
                 if (!is_changed_by_runtime)
                 {
-                    // If the value was not changed, extract the original value.
-                    std::string sgprs_text(match_instruction[2].first, match_instruction[2].second);
-                    sgprs_ = atoi(sgprs_text.c_str());
+                    // If the value was not changed, use the original value.
+                    sgprs_ = gprs;
                 }
             }
-            else if (boost::regex_search(isa_line_start, isa_line_end, match_instruction, regex_code_length_bytes))
-            {
-                is_code_len_found = true;
-                std::string code_length_text(match_instruction[2].first, match_instruction[2].second);
-                code_len_ = atoi(code_length_text.c_str());
-            }
-            else if (boost::regex_search(isa_line_start, isa_line_end, match_instruction, regex_code_length_bytes_ni))
+            else if (ExtractStatementValue(isa_line_view, "codeLenInByte", code_len_) ||
+                     ExtractStatementValue(isa_line_view, "CodeLen", code_len_))
             {
                 is_code_len_found = true;
-                std::string code_length_text(match_instruction[2].first, match_instruction[2].second);
-                code_len_ = atoi(code_length_text.c_str());
             }
         }
-        prev_line = isa_line;
+        prev_line = isa_line_view;
     }
 
     return parse_ok;
 }
 
-void ParserIsa::ResetInstsCounters()
+void ParserIsa::SetInstructionText(Instruction& instruction, std::string& opcode, const std::string& params,
+                                   const std::string& binary_representation, const std::string& offset)
 {
-    std::vector<Instruction*>::const_iterator instruction_begin = instructions_.begin();
-    for (; instruction_begin != instructions_.end(); ++instruction_begin)
-    {
-        if (NULL != (*instruction_begin))
-        {
-            delete *instruction_begin;
-        }
-    }
+    // Opcodes are kept in lower case. Since there are only a few distinct opcodes, they are interned.
+    std::transform(opcode.begin(), opcode.end(), opcode.begin(), [](const char& c) { return static_cast<char>(std::tolower(c)); });
+    instruction.SetInstructionStringRepresentation(instruction_arena_.Intern(opcode), instruction_arena_.Store(params),
+                                                   instruction_arena_.Store(binary_representation), instruction_arena_.Store(offset));
+}
 
+void ParserIsa::ResetInstsCounters()
+{
+    // The instructions live in the arena, so there is nothing to delete.
+    // Clear the graph first, since it refers to the instructions.
+    isa_graph_.DestroyISAProgramStructure();
     instructions_.clear();
+    instruction_arena_.Reset();
+
     sgprs_ = 0;
     vgprs_ = 0;
-
-    isa_graph_.DestroyISAProgramStructure();
 }
 
 int ParserIsa::GetLabel(const std::string& isa_line)
@@ -13,12 +13,14 @@
 #include <map>
 #include <sstream>
 #include <set>
+#include <string_view>
 
 #ifdef _WIN32
     #pragma warning(push)
     #pragma warning(disable:4309)
 #endif
 #include "be_parser_si.h"
+#include "be_instruction_arena.h"
 #include "be_isa_program_graph.h"
 #include "source/radeon_gpu_analyzer_backend/be_include.h"
 #ifdef _WIN32
@@ -50,6 +52,10 @@ public:
     // Parse the ISA.
     bool Parse(const std::string& isa);
 
+    // Parse the ISA. If is_hsail_tokens_implied is true, the ISA is parsed as if it was enclosed by
+    // kStrHsailDisassemblyTokenStart and kStrHsailDisassemblyTokenEnd, without copying it.
+    bool Parse(std::string_view isa, bool is_hsail_tokens_implied);
+
     // Parse the ISA and retrieve its size.
     bool ParseForSize(const std::string& isa);
 
@@ -66,10 +72,21 @@ public:
 
     unsigned int GetCodeLength() const { return code_len_; }
 
+    // Get the program graph built by Parse(): the blocks of the program and the links between them.
+    const ISAProgramGraph& GetProgramGraph() const { return isa_graph_; }
+
+    // Estimate the number of cycles per wavefront out of the program graph built by Parse().
+    void GetCycleEstimate(ISAProgramGraph::CycleEstimate& estimate) { isa_graph_.GetCycleEstimate(estimate); }
+
 private:
     // Reset all instruction counters.
     void ResetInstsCounters();
 
+    // Store the text of the instruction in the arena and set it as the instruction's string representation.
+    // The opcode is converted to lower case in place.
+    void SetInstructionText(Instruction& instruction, std::string& opcode, const std::string& params,
+                            const std::string& binary_representation, const std::string& offset);
+
     // Get an ISA line and return the label if any.
     int GetLabel(const std::string& isa_line);
 
@@ -77,13 +94,16 @@ private:
     int GetGotoLabel(const std::string& isa_line);
 
     // Parse the ISA disassembly line by line, and store the instructions internally.
-    bool ParseToVector(const std::string& isa);
+    bool ParseToVector(std::string_view isa, bool is_hsail_tokens_implied);
 
     unsigned int sgprs_ = 0;
     unsigned int vgprs_ = 0;
     unsigned int code_len_ = 0;
 
-    // all instructions generated for the ISA
+    // Holds the instructions and their text. Rewound (rather than freed instruction by instruction) on every parse.
+    InstructionArena instruction_arena_;
+
+    // all instructions generated for the ISA (allocated in instruction_arena_)
     std::vector<Instruction*> instructions_;
 
     // The map between Parser`s instruction kind identifier and the parser
@@ -6,478 +6,513 @@
 //=============================================================================
 
 // C++.
+#include <algorithm>
+#include <climits>
 #include <sstream>
 #include <fstream>
 #include <iostream>
 #include <string>
+#include <string_view>
 
 // Local.
 #include "be_isa_program_graph.h"
-#include "be_parser_si.h"
 
 const int kDefaultIterationCount = 10;
 const int kDefaultIterationCountHwLoops = 64;
 
-ISAProgramGraph::ISAProgramGraph()
-{
-    next_label_ = kNoLabel - 1 ;
-    isa_code_block_ = NULL;
-    loop_iteration_count_ = kDefaultIterationCount;
-}
+// Opcodes that end the program, or jump to an address that is not known statically.
+static const std::string_view kOpcodeEndProgram = "s_endpgm";
+static const std::string_view kOpcodeSetPc = "s_setpc";
 
+// The unconditional branch.
+static const std::string_view kOpcodeBranch = "s_branch";
 
-IsaCodeBlock* ISAProgramGraph::CreateNewNode(int label)
+// Opcodes that read the lanes of the wavefront one at a time: a loop that starts with them is a loop over the lanes (hardware loop).
+static const std::string_view kOpcodeReadFirstLane = "v_readfirstlane_b32";
+static const std::string_view kOpcodeMoveRelD = "v_movereld_b32";
+
+// Cycles of a branch when it is not taken and when it is taken (the "4|16" of the parsed ISA).
+const int kBranchCyclesNotTaken = 4;
+const int kBranchCyclesTaken = 16;
+
+// Cycles to issue an instruction that has no entry in the performance table (memory, export, flow control).
+// The latency of memory accesses is not modeled: it is assumed to be hidden by other wavefronts.
+const int kDefaultIssueCycles = 4;
+
+// Get the lowest, typical and highest cycle count of the given instruction.
+static void GetInstructionCycles(const Instruction& instruction, int& min_cycles, int& typical_cycles, int& max_cycles)
 {
-    LabelNodeSet new_node_set;
-    IsaCodeBlock* new_node_isa = new IsaCodeBlock();
+    const int table_cycles = instruction.GetInstructionClockCount(Instruction::kDevicePerfVariantHybrid);
 
-    // Case this is a chunk of instruction not under specific label.
-    if (label == kNoLabel)
+    if (table_cycles > 0)
     {
-        new_node_isa->label_ = next_label_;
-        new_node_set.label_ = next_label_;
-        next_label_--;
+        min_cycles = table_cycles;
+        typical_cycles = table_cycles;
+        max_cycles = table_cycles;
+    }
+    else if (instruction.GetInstructionCategory() == Instruction::kBranch || instruction.GetGotoLabel() != kNoLabel)
+    {
+        min_cycles = kBranchCyclesNotTaken;
+        typical_cycles = (kBranchCyclesNotTaken + kBranchCyclesTaken) / 2;
+        max_cycles = kBranchCyclesTaken;
     }
     else
     {
-        // There is a label parsed from the ISA.
-        new_node_set.label_ = label;
-        new_node_isa->label_ = label;
+        min_cycles = kDefaultIssueCycles;
+        typical_cycles = kDefaultIssueCycles;
+        max_cycles = kDefaultIssueCycles;
     }
+}
 
-    new_node_set.node_code_block_ = new_node_isa;
-    node_set_.insert(new_node_set);
+// Returns true if the given opcode starts with the given prefix.
+static bool IsOpcode(std::string_view opcode, std::string_view prefix)
+{
+    return opcode.compare(0, prefix.size(), prefix) == 0;
+}
 
-    // Check if this is the head of the graph- if so- save it.
-    if (NULL == isa_code_block_)
+// Get the successors of the given block. The branch target precedes the fall through block.
+// Returns the number of successors.
+static int GetSuccessors(const IsaCodeBlock& block, int successors[3])
+{
+    int count = 0;
+    for (int successor : {block.GetNext(), block.GetTrue(), block.GetFalse()})
     {
-        isa_code_block_ = new_node_isa;
+        if (successor != kNoBlock)
+        {
+            successors[count++] = successor;
+        }
     }
+    return count;
+}
 
-    return new_node_isa;
+ISAProgramGraph::ISAProgramGraph()
+{
+    loop_iteration_count_ = kDefaultIterationCount;
 }
 
 void ISAProgramGraph::DestroyISAProgramStructure()
 {
+    blocks_.clear();
+    label_blocks_.clear();
+    loops_.clear();
+    dominator_tree_pre_.clear();
+    dominator_tree_post_.clear();
+}
+
+int ISAProgramGraph::LabelSearcher(int label) const
+{
+    auto it = label_blocks_.find(label);
+    return (it != label_blocks_.end() ? it->second : kNoBlock);
+}
+
+bool ISAProgramGraph::BuildISAProgramStructure(std::vector<Instruction*>& instructions)
+{
+    DestroyISAProgramStructure();
 
-    if (!node_set_.empty())
+    bool ret = !instructions.empty();
+    if (ret)
     {
-        std::set<LabelNodeSet, LabelNodeSetCompare>::const_iterator iterBegin = node_set_.begin();
+        BuildBlocks(instructions);
 
-        for (; iterBegin != node_set_.end(); ++iterBegin)
+        std::vector<std::vector<int>> predecessors(blocks_.size());
+        for (size_t i = 0; i < blocks_.size(); i++)
         {
-            if (iterBegin->node_code_block_)
+            int successors[3];
+            const int successor_count = GetSuccessors(blocks_[i], successors);
+            for (int j = 0; j < successor_count; j++)
             {
-                delete iterBegin->node_code_block_;
+                predecessors[successors[j]].push_back(static_cast<int>(i));
             }
         }
 
-        node_set_.clear();
-
-        isa_code_block_ = NULL;
-        next_label_ = kNoLabel - 1;
-    }
-}
-
-IsaCodeBlock* ISAProgramGraph::LabelSearcher(int label)
-{
-    IsaCodeBlock* ret = NULL;
-    LabelNodeSet new_node_set;
-    new_node_set.label_ = label;
-
-    std::set<LabelNodeSet, LabelNodeSetCompare>::const_iterator iter_begin = node_set_.find(new_node_set);
-    if (iter_begin != node_set_.end())
-    {
-        ret = iter_begin->node_code_block_;
+        BuildDominatorTree(predecessors);
+        FindLoops(predecessors);
+        UpdateNumOfIteration();
     }
 
     return ret;
 }
 
-bool ISAProgramGraph::BuildISAProgramStructure(std::vector<Instruction*>& instructions)
-{
-    std::vector<Instruction*>::const_iterator iIterator = instructions.begin();
-    return BuildISAProgramStructureInternal(instructions, iIterator, this->isa_code_block_);
-}
-
-bool ISAProgramGraph::BuildISAProgramStructureInternal(std::vector<Instruction*>& instructions,
-    std::vector<Instruction*>::const_iterator instruction_iter, IsaCodeBlock* head_isa_node)
+void ISAProgramGraph::BuildBlocks(std::vector<Instruction*>& instructions)
 {
-    if (instruction_iter == instructions.end())
+    // A block starts at the first instruction, at every label and after every branch.
+    bool is_block_end = true;
+    for (Instruction* instruction : instructions)
     {
-        return false;
-    }
-
-    std::vector<Instruction*>::const_iterator iter = instruction_iter;
-    Instruction* curr_instruction = *instruction_iter;
+        const int label = instruction->GetLabel();
+        if (is_block_end || label != kNoLabel)
+        {
+            blocks_.emplace_back();
+            if (label != kNoLabel)
+            {
+                blocks_.back().label_ = label;
+                label_blocks_.emplace(label, static_cast<int>(blocks_.size() - 1));
+            }
+        }
+        blocks_.back().instructions_.push_back(instruction);
 
-    // Set the label.
-    if (NULL == head_isa_node)
-    {
-        head_isa_node = CreateNewNode(curr_instruction->GetLabel());
+        const std::string_view opcode = instruction->GetInstructionOpCode();
+        is_block_end = (instruction->GetGotoLabel() != kNoLabel || IsOpcode(opcode, kOpcodeEndProgram) || IsOpcode(opcode, kOpcodeSetPc));
     }
 
-    // Iterate through the instructions and push them to the node.
-    for (; iter != instructions.end(); ++iter)
+    // Link the blocks.
+    for (size_t i = 0; i < blocks_.size(); i++)
     {
-        // First- add it to the instructions vector of the node.
-        head_isa_node->instructions_.push_back(*iter);
+        IsaCodeBlock&          block        = blocks_[i];
+        const Instruction*     last         = block.instructions_.back();
+        const std::string_view opcode       = last->GetInstructionOpCode();
+        const int              fall_through = (i + 1 < blocks_.size() ? static_cast<int>(i + 1) : kNoBlock);
 
-        // A branch.
-        if ((*iter)->GetGotoLabel() != kNoLabel)
+        if (last->GetGotoLabel() != kNoLabel)
         {
-            // this is the info we want to gather in order to decide how to build the graph
-            bool does_node_exist = false;
-            bool is_loop = false;
-            bool is_branch = false;
-
-            std::vector<Instruction*>::const_iterator instruction_begin = instructions.begin();
-
-            // Case 1: the label is already in the graph: search for the label in the IsaTree if found- set the true pointer if false call with the label.
-            IsaCodeBlock* loop = LabelSearcher((*iter)->GetGotoLabel());
-
-            if (loop)
+            const int target = LabelSearcher(last->GetGotoLabel());
+            if (IsOpcode(opcode, kOpcodeBranch))
             {
-                // The node is already in the graph.
-                // This check if we have a real loop, and if so, update the num of iterations.
-                is_loop = UpdateNumOfIteration(instructions, loop, iter);
-                does_node_exist = true;
+                // An unconditional branch: there is no fall through.
+                block.next_ = target;
             }
-            else // need to create a new node
+            else
             {
-                instruction_begin = instructions.begin();
-
-                for (; instruction_begin != instructions.end(); ++instruction_begin)
-                {
-                    if (((*instruction_begin)->GetLabel() != kNoLabel) && ((*instruction_begin)->GetLabel() == (*iter)->GetGotoLabel()))
-                    {
-                        break;
-                    }
-                }
-
-                if (instruction_begin != instructions.end())
-                {
-                    loop = CreateNewNode((*iter)->GetGotoLabel());
-
-                }
-
+                block.true_ = target;
+                block.false_ = fall_through;
             }
+        }
+        else if (!IsOpcode(opcode, kOpcodeEndProgram) && !IsOpcode(opcode, kOpcodeSetPc))
+        {
+            block.next_ = fall_through;
+        }
+    }
+}
 
-            // Now see if we are facing an S_Branch  or S_CBranch (unconditional branch vs. conditional).
-            curr_instruction = *iter;
+void ISAProgramGraph::BuildDominatorTree(const std::vector<std::vector<int>>& predecessors)
+{
+    const int block_count = static_cast<int>(blocks_.size());
+
+    // Number the blocks that are reachable from the entry block in post order, with an iterative depth first search.
+    std::vector<int> post_order;
+    std::vector<int> post_order_index(block_count, -1);
+    std::vector<bool> is_visited(block_count, false);
+    std::vector<std::pair<int, int>> stack;
+    stack.push_back({0, 0});
+    is_visited[0] = true;
+    while (!stack.empty())
+    {
+        const int block = stack.back().first;
+        int successors[3];
+        const int successor_count = GetSuccessors(blocks_[block], successors);
+        if (stack.back().second < successor_count)
+        {
+            const int successor = successors[stack.back().second++];
+            if (!is_visited[successor])
+            {
+                is_visited[successor] = true;
+                stack.push_back({successor, 0});
+            }
+        }
+        else
+        {
+            post_order_index[block] = static_cast<int>(post_order.size());
+            post_order.push_back(block);
+            stack.pop_back();
+        }
+    }
 
-            if (curr_instruction->GetInstructionCategory() == Instruction::kScalarAlu)
+    // Compute the immediate dominators by iterating over the blocks in reverse post order
+    // until they are stable (Cooper, Harvey and Kennedy, "A Simple, Fast Dominance Algorithm").
+    std::vector<int> immediate_dominators(block_count, kNoBlock);
+    immediate_dominators[0] = 0;
+    bool is_changed = true;
+    while (is_changed)
+    {
+        is_changed = false;
+        for (auto it = post_order.rbegin(); it != post_order.rend(); ++it)
+        {
+            const int block = *it;
+            if (block != 0)
             {
-                if (curr_instruction->GetInstructionFormat() == Instruction::kInstructionSetSopp)
+                int new_dominator = kNoBlock;
+                for (int predecessor : predecessors[block])
                 {
-                    SISOPPInstruction* instruction_si_sopp = dynamic_cast<SISOPPInstruction*>(curr_instruction);
-
-                    if (instruction_si_sopp != NULL)
+                    if (immediate_dominators[predecessor] != kNoBlock)
                     {
-                        SISOPPInstruction::OP opSOPP = instruction_si_sopp->GetOp();
-
-                        if (SISOPPInstruction::kBranch == opSOPP)
+                        if (new_dominator == kNoBlock)
                         {
-                            is_branch = true;
+                            new_dominator = predecessor;
                         }
-                    }
-                    else
-                    {
-                        VISOPPInstruction* instruction_vi_sopp = dynamic_cast<VISOPPInstruction*>(curr_instruction);
-
-                        if (instruction_vi_sopp != NULL)
+                        else
                         {
-                            VISOPPInstruction::OP opSOPP = instruction_vi_sopp->GetOp();
-
-                            if (VISOPPInstruction::kBranch == opSOPP)
+                            // Walk up from both blocks to their closest common dominator.
+                            int finger = predecessor;
+                            while (finger != new_dominator)
                             {
-                                is_branch = true;
+                                while (post_order_index[finger] < post_order_index[new_dominator])
+                                {
+                                    finger = immediate_dominators[finger];
+                                }
+                                while (post_order_index[new_dominator] < post_order_index[finger])
+                                {
+                                    new_dominator = immediate_dominators[new_dominator];
+                                }
                             }
                         }
                     }
                 }
-            }
-
-            // Now we have all the information we need, just need to set the right sequential and call function again.
-            if (is_branch)
-            {
-                if (!is_loop) // this is a case where we will mark the next because this is unconditional branch and we do it always
-                {
-                    head_isa_node->SetNext(loop);
-                }
-                else
-                {
-                    // We shouldn't get it, but just in case.
-                    head_isa_node->SetNext(NULL);
-                    head_isa_node->SetFalse(NULL);
-                    head_isa_node->SetTrue(NULL);
-                }
 
-                if (!does_node_exist)
+                if (immediate_dominators[block] != new_dominator)
                 {
-                    BuildISAProgramStructureInternal(instructions, instruction_begin, loop);
+                    immediate_dominators[block] = new_dominator;
+                    is_changed = true;
                 }
-
-                // We have an unconditional branch we break here because there is no false.
-                break;
             }
-            else
-            {
-                if (is_loop)
-                {
-                    // in case of a loop, we mark the TRUE=NULL because we already know it is a loop and we don't want loops in the graph
-                    head_isa_node->true_ = NULL; //pLoop;
-                }
-                else
-                {
-                    // this is the case where we have a branch that points to a node which exist in the graph and it is not a loop.
-                    head_isa_node->SetTrue(loop);
-                }
-
-                if (!does_node_exist)
-                {
-                    BuildISAProgramStructureInternal(instructions, instruction_begin, loop);
-                }
+        }
+    }
 
-                std::vector<Instruction*>::const_iterator next_instruction = (iter + 1);
-                if (next_instruction != instructions.end())
-                {
-                    IsaCodeBlock* pFalseIsaNode = CreateNewNode((*next_instruction)->GetLabel());
-                    head_isa_node->SetFalse(pFalseIsaNode);
-                    BuildISAProgramStructureInternal(instructions, next_instruction, pFalseIsaNode);
-                }
+    // Number the blocks in a walk of the dominator tree, so that dominance can be checked in constant time.
+    std::vector<std::vector<int>> children(block_count);
+    for (int block : post_order)
+    {
+        if (block != 0)
+        {
+            children[immediate_dominators[block]].push_back(block);
+        }
+    }
 
-                break;
-            }
+    dominator_tree_pre_.assign(block_count, -1);
+    dominator_tree_post_.assign(block_count, -1);
+    int walk_index = 0;
+    stack.clear();
+    stack.push_back({0, 0});
+    dominator_tree_pre_[0] = walk_index++;
+    while (!stack.empty())
+    {
+        const int block = stack.back().first;
+        if (stack.back().second < static_cast<int>(children[block].size()))
+        {
+            const int child = children[block][stack.back().second++];
+            dominator_tree_pre_[child] = walk_index++;
+            stack.push_back({child, 0});
         }
         else
         {
-            // Not a branch- is next instruction is with a label?
-            std::vector<Instruction*>::const_iterator next_instruction = (iter + 1);
-
-            if ((next_instruction != instructions.end()) && ((*next_instruction)->GetLabel() != kNoLabel))
-            {
-                IsaCodeBlock* next_code_block = LabelSearcher((*next_instruction)->GetLabel());
-                if (next_code_block)
-                {
-                    head_isa_node->SetNext(next_code_block);
-                    return true;
-                }
-                else
-                {
-                    std::vector<Instruction*>::const_iterator instruction_begin = instructions.begin();
-
-                    for (; instruction_begin != instructions.end(); ++instruction_begin)
-                    {
-                        if (((*instruction_begin)->GetLabel() != kNoLabel) && ((*instruction_begin)->GetLabel() == (*next_instruction)->GetLabel()))
-                        {
-                            break;
-                        }
-                    }
-
-                    if (instruction_begin != instructions.end())
-                    {
-                        IsaCodeBlock* pNextIsaNode = CreateNewNode((*instruction_begin)->GetLabel());
-                        head_isa_node->SetNext(pNextIsaNode);
-                        BuildISAProgramStructureInternal(instructions, instruction_begin, pNextIsaNode);
-                        break;
-                    }
-                }
-            }
+            dominator_tree_post_[block] = walk_index++;
+            stack.pop_back();
         }
     }
-
-    return true;
 }
 
-
-bool ISAProgramGraph::UpdateNumOfIteration(std::vector<Instruction*>& instructions, IsaCodeBlock* loop, const std::vector<Instruction*>::const_iterator iter)
+bool ISAProgramGraph::Dominates(int dominator, int block) const
 {
-    std::vector<Instruction*>::const_iterator instruction_begin = instructions.begin();
-    bool isFound = false;
+    return dominator_tree_pre_[dominator] >= 0 && dominator_tree_pre_[block] >= 0 &&
+           dominator_tree_pre_[dominator] <= dominator_tree_pre_[block] && dominator_tree_post_[block] <= dominator_tree_post_[dominator];
+}
 
-    for (; (instruction_begin != instructions.end()) && (instruction_begin < iter); ++instruction_begin)
-    {
-        if (((*instruction_begin)->GetLabel() != kNoLabel) && ((*instruction_begin)->GetLabel() == loop->label_))
-        {
-            isFound = true;
-            loop->SetIterationCount(loop_iteration_count_);
-            break;
-        }
-    }
+bool ISAProgramGraph::IsBackEdge(int from, int to) const
+{
+    return Dominates(to, from);
+}
 
-    // It is a loop, check if this is HW loop or regular and update num of iteration.
-    if (isFound)
+void ISAProgramGraph::FindLoops(const std::vector<std::vector<int>>& predecessors)
+{
+    const int block_count = static_cast<int>(blocks_.size());
+
+    // Every back edge adds to the loop of its target: the blocks that reach the source of the edge
+    // without passing through the target. Back edges to the same header share a loop, so membership is tracked
+    // per loop: the walks of other loops in between must not make a block look new to this one.
+    std::vector<int>               header_loops(block_count, kNoBlock);
+    std::vector<std::vector<bool>> loop_members;
+    std::vector<int>               worklist;
+    for (int from = 0; from < block_count; from++)
     {
-        instruction_begin = loop->instructions_.begin();
-
-        for (; instruction_begin < loop->instructions_.end(); ++instruction_begin)
+        int successors[3];
+        const int successor_count = GetSuccessors(blocks_[from], successors);
+        for (int i = 0; i < successor_count; i++)
         {
-            SIVOP1Instruction* curr_instruction = dynamic_cast<SIVOP1Instruction*>(*instruction_begin);
-
-            if (curr_instruction != NULL)
+            const int header = successors[i];
+            if (IsBackEdge(from, header))
             {
-                if ((curr_instruction->GetInstructionType() == SIVOP1Instruction::kEncodingVop1) &&
-                    ((curr_instruction->GetOp() == SIVOP1Instruction::kReadfirstlaneB32) || (curr_instruction->GetOp() == SIVOP1Instruction::kMovereldB32)))
+                int loop_index = header_loops[header];
+                if (loop_index == kNoBlock)
                 {
-                    loop->SetIterationCount(kDefaultIterationCountHwLoops);
-                    break;
+                    loop_index = static_cast<int>(loops_.size());
+                    header_loops[header] = loop_index;
+                    loops_.emplace_back();
+                    loops_.back().header = header;
+                    loops_.back().blocks.push_back(header);
+                    loop_members.emplace_back(block_count, false);
+                    loop_members.back()[header] = true;
+
+                    // A loop that reads the lanes one at a time iterates over the lanes of the wavefront.
+                    for (const Instruction* instruction : blocks_[header].instructions_)
+                    {
+                        const std::string_view opcode = instruction->GetInstructionOpCode();
+                        if (IsOpcode(opcode, kOpcodeReadFirstLane) || IsOpcode(opcode, kOpcodeMoveRelD))
+                        {
+                            loops_.back().is_hw_loop = true;
+                            break;
+                        }
+                    }
                 }
-            }
-            else
-            {
-                VIVOP1Instruction* curr_instruction_vivo = dynamic_cast<VIVOP1Instruction*>(*instruction_begin);
 
-                if (curr_instruction_vivo != NULL)
+                IsaLoop&           loop    = loops_[loop_index];
+                std::vector<bool>& members = loop_members[loop_index];
+                if (!members[from])
                 {
-                    if ((curr_instruction_vivo->GetInstructionType() == VIVOP1Instruction::kEncodingVop1) && (curr_instruction_vivo->GetOp() == VIVOP1Instruction::kReadfirstlaneB32))
+                    members[from] = true;
+                    loop.blocks.push_back(from);
+                    worklist.push_back(from);
+                }
+                while (!worklist.empty())
+                {
+                    const int block = worklist.back();
+                    worklist.pop_back();
+                    for (int predecessor : predecessors[block])
                     {
-                        loop->SetIterationCount(kDefaultIterationCountHwLoops);
-                        break;
+                        if (!members[predecessor] && dominator_tree_pre_[predecessor] >= 0)
+                        {
+                            members[predecessor] = true;
+                            loop.blocks.push_back(predecessor);
+                            worklist.push_back(predecessor);
+                        }
                     }
                 }
             }
         }
     }
 
-    return isFound;
-}
-
-void ISAProgramGraph::GetInstructionsOfProgramPath(std::set<LabelNodeSet, LabelNodeSetCompare>& path_instruction_set, int iPath)
-{
-    GetInstructionsOfProgramPathInternal(path_instruction_set, this->isa_code_block_, iPath, 1);
-}
-
-void ISAProgramGraph::GetInstructionsOfProgramPathInternal(std::set<LabelNodeSet, LabelNodeSetCompare>& path_instruction_set, IsaCodeBlock* head_isa_code_block, int path_num, int iteration_count)
-{
-    if (NULL == head_isa_code_block)
-    {
-        return;
-    }
-
-    // If the node is in the set- return. we visit only once.
-    LabelNodeSet label_node_set_temp;
-    label_node_set_temp.label_ = head_isa_code_block->GetLabel();
-    if (path_instruction_set.find(label_node_set_temp) != path_instruction_set.end())
+    // Assign the loops from the outermost to the innermost: the innermost loop of a block is the last one that contains it,
+    // and the parent of a loop is the innermost loop that contained its header before it.
+    std::vector<int> loop_order(loops_.size());
+    for (size_t i = 0; i < loop_order.size(); i++)
     {
-        return;
+        loop_order[i] = static_cast<int>(i);
     }
-
-    // We got here with the node- put it in the set.
-    LabelNodeSet new_label_node_set;
-    new_label_node_set.label_ = head_isa_code_block->GetLabel();
-    new_label_node_set.iteration_count_ = iteration_count * (head_isa_code_block->GetIterationCount());
-    new_label_node_set.node_code_block_ = head_isa_code_block;
-    path_instruction_set.insert(new_label_node_set);
-
-    // Check where we go next.
-    int iteration_count_temp = new_label_node_set.iteration_count_;
-    if (head_isa_code_block->GetTrue())
+    std::stable_sort(loop_order.begin(), loop_order.end(), [this](int a, int b) { return loops_[a].blocks.size() > loops_[b].blocks.size(); });
+    for (int loop_index : loop_order)
     {
-        // If this is true, we probably going out of a loop- reduce the iteration count.
-        if (head_isa_code_block->GetFalse() && (head_isa_code_block->GetIterationCount() > 1))
+        IsaLoop& loop = loops_[loop_index];
+        loop.parent = blocks_[loop.header].loop_;
+        for (int block : loop.blocks)
         {
-            if (iteration_count_temp > 1)
-            {
-                iteration_count_temp /= loop_iteration_count_;
-            }
-
-            GetInstructionsOfProgramPathInternal(path_instruction_set, head_isa_code_block->GetTrue(), path_num, iteration_count_temp);
+            blocks_[block].loop_ = loop_index;
         }
+    }
+}
 
-        // We do the true unless we are in the false path.
-        if (path_num != 2)
+void ISAProgramGraph::UpdateNumOfIteration()
+{
+    for (IsaCodeBlock& block : blocks_)
+    {
+        // A block is executed once per iteration of every loop that contains it.
+        uint64_t iteration_count = 1;
+        for (int loop = block.loop_; loop != kNoBlock && iteration_count < INT_MAX; loop = loops_[loop].parent)
         {
-            GetInstructionsOfProgramPathInternal(path_instruction_set, head_isa_code_block->GetTrue(), path_num, new_label_node_set.iteration_count_);
+            iteration_count *= static_cast<uint64_t>(loops_[loop].is_hw_loop ? kDefaultIterationCountHwLoops : loop_iteration_count_);
         }
+        block.iteration_count_ = static_cast<int>(std::min<uint64_t>(iteration_count, INT_MAX));
     }
+}
 
-    if (head_isa_code_block->GetFalse())
+void ISAProgramGraph::GetInstructionsOfProgramPath(std::vector<int>& path_blocks, int path_num) const
+{
+    path_blocks.clear();
+
+    if (!blocks_.empty())
     {
-        iteration_count_temp = new_label_node_set.iteration_count_;
+        std::vector<bool> is_visited(blocks_.size(), false);
+        std::vector<int> worklist;
+        auto visit = [&](int block) {
+            if (block != kNoBlock && !is_visited[block])
+            {
+                is_visited[block] = true;
+                worklist.push_back(block);
+            }
+        };
 
-        // we do the false always if the true is null because this is probably an end of a loop
-        if (!head_isa_code_block->GetTrue())
+        visit(0);
+        while (!worklist.empty())
         {
-            if ((head_isa_code_block->GetIterationCount() > 1) && (iteration_count_temp > 1))
+            const int block_index = worklist.back();
+            worklist.pop_back();
+            path_blocks.push_back(block_index);
+
+            // The TRUE path follows the branch target and the FALSE path follows the fall through,
+            // unless the edge closes a loop, in which case the path leaves the loop.
+            const IsaCodeBlock& block = blocks_[block_index];
+            bool is_true_taken = (block.true_ != kNoBlock && !IsBackEdge(block_index, block.true_));
+            bool is_false_taken = (block.false_ != kNoBlock && !IsBackEdge(block_index, block.false_));
+            if (path_num == kCalcTrue && is_true_taken)
             {
-                iteration_count_temp /= loop_iteration_count_;
+                is_false_taken = false;
+            }
+            else if (path_num == kCalcFalse && is_false_taken)
+            {
+                is_true_taken = false;
             }
 
-            GetInstructionsOfProgramPathInternal(path_instruction_set, head_isa_code_block->GetFalse(), path_num, iteration_count_temp);
-        }
-        else if (path_num != 1)
-        {
-            GetInstructionsOfProgramPathInternal(path_instruction_set, head_isa_code_block->GetFalse(), path_num, iteration_count_temp);
+            if (block.next_ != kNoBlock && !IsBackEdge(block_index, block.next_))
+            {
+                visit(block.next_);
+            }
+            if (is_false_taken)
+            {
+                visit(block.false_);
+            }
+            if (is_true_taken)
+            {
+                visit(block.true_);
+            }
         }
 
+        // Keep the blocks in program order.
+        std::sort(path_blocks.begin(), path_blocks.end());
     }
-
-
-    if (head_isa_code_block->GetNext())
-    {
-        // do it always
-        GetInstructionsOfProgramPathInternal(path_instruction_set, head_isa_code_block->GetNext(), path_num, new_label_node_set.iteration_count_);
-    }
-
 }
 
-void ISAProgramGraph::DumpGraph(std::set<ISAProgramGraph::LabelNodeSet, ISAProgramGraph::LabelNodeSetCompare> path_instruction_set, std::string sFileName)
+void ISAProgramGraph::DumpGraph(const std::vector<int>& path_blocks, const std::string& sFileName) const
 {
     // open the file:
     std::ofstream ofs;
     ofs.open(sFileName.c_str(), std::ofstream::out);
     ofs << "digraph G {\n";
 
+    std::vector<bool> is_in_path(blocks_.size(), false);
+    for (int block_index : path_blocks)
+    {
+        is_in_path[block_index] = true;
+    }
 
-    std::set<LabelNodeSet, LabelNodeSetCompare>::iterator iter = path_instruction_set.begin();
-
-    for (; iter != path_instruction_set.end(); ++iter)
+    for (int block_index : path_blocks)
     {
+        const IsaCodeBlock& block = blocks_[block_index];
+        const std::string name = (block.label_ != kNoLabel ? std::to_string(block.label_) : "B" + std::to_string(block_index));
+
         //loops gets double circle shape, also the arrows are red and mark the number of times it will be done
-        if ((*iter).iteration_count_ > 1)
+        if (block.iteration_count_ > 1)
         {
-            ofs << (*iter).label_ << " " << "[shape=doublecircle,style=filled,color=\".7 .3 1.0\", label=\" " << (*iter).label_ << " X " << (*iter).iteration_count_ << "\"];\n";
+            ofs << block_index << " " << "[shape=doublecircle,style=filled,color=\".7 .3 1.0\", label=\" " << name << " X " << block.iteration_count_ << "\"];\n";
         }
         else
         {
-            ofs << (*iter).label_ << " " << "[shape=box];\n";
+            ofs << block_index << " " << "[shape=box, label=\"" << name << "\"];\n";
         }
     }
 
-    for (iter = path_instruction_set.begin(); iter != path_instruction_set.end(); ++iter)
+    for (int block_index : path_blocks)
     {
-        if ((*iter).node_code_block_->GetTrue())
+        const IsaCodeBlock& block = blocks_[block_index];
+        if (block.true_ != kNoBlock && is_in_path[block.true_])
         {
-            LabelNodeSet temp;
-            temp.label_ = (*iter).node_code_block_->GetTrue()->GetLabel();
-
-            if (path_instruction_set.find(temp) != path_instruction_set.end())
-            {
-                ofs << (*iter).label_ << " -> " << (*iter).node_code_block_->GetTrue()->GetLabel() << "[label=\"T\"]" << ";\n ";
-            }
+            ofs << block_index << " -> " << block.true_ << "[label=\"T\"]" << ";\n ";
         }
 
-        if ((*iter).node_code_block_->GetFalse())
+        if (block.false_ != kNoBlock && is_in_path[block.false_])
         {
-            LabelNodeSet temp;
-            temp.label_ = (*iter).node_code_block_->GetFalse()->GetLabel();
-
-            if (path_instruction_set.find(temp) != path_instruction_set.end())
-            {
-                ofs << (*iter).label_ << " -> " << (*iter).node_code_block_->GetFalse()->GetLabel() <<  "[label=\"F\"]" << ";\n ";
-            }
+            ofs << block_index << " -> " << block.false_ << "[label=\"F\"]" << ";\n ";
         }
 
-        if ((*iter).node_code_block_->GetNext())
+        if (block.next_ != kNoBlock && is_in_path[block.next_])
         {
-            LabelNodeSet temp;
-            temp.label_ = (*iter).node_code_block_->GetNext()->GetLabel();
-
-            if (path_instruction_set.find(temp) != path_instruction_set.end())
-            {
-                ofs << (*iter).label_ << " -> " << (*iter).node_code_block_->GetNext()->GetLabel() << "[label=\"N\"]" << ";\n ";
-            }
+            ofs << block_index << " -> " << block.next_ << "[label=\"N\"]" << ";\n ";
         }
     }
 
@@ -485,24 +520,80 @@ void ISAProgramGraph::DumpGraph(std::set<ISAProgramGraph::LabelNodeSet, ISAProgr
     ofs.close();
 }
 
-void ISAProgramGraph::CountInstructions(std::set<ISAProgramGraph::LabelNodeSet, ISAProgramGraph::LabelNodeSetCompare> path_instruction_set,
-    ISAProgramGraph::NumOfInstructionsInCategory& category_instruction_count)
+void ISAProgramGraph::CountInstructions(const std::vector<int>& path_blocks, ISAProgramGraph::NumOfInstructionsInCategory& category_instruction_count)
 {
-    (void)(path_instruction_set);
-    (void)(category_instruction_count);
+    category_instruction_count = NumOfInstructionsInCategory();
+
+    for (int block_index : path_blocks)
+    {
+        // A block in a loop is executed once per iteration.
+        const IsaCodeBlock& block = blocks_[block_index];
+        const unsigned int weight = static_cast<unsigned int>(std::max(block.iteration_count_, 1));
+
+        for (const Instruction* instruction : block.instructions_)
+        {
+            // Labels are not instructions.
+            if (instruction != NULL && instruction->GetPointingLabelString().empty())
+            {
+                switch (instruction->GetInstructionCategory())
+                {
+                case Instruction::kScalarMemoryRead:
+                    category_instruction_count.instruction_count_scalar_memory_read += weight;
+                    break;
+                case Instruction::kScalarMemoryWrite:
+                    category_instruction_count.instruction_count_scalar_memory_write += weight;
+                    break;
+                case Instruction::kScalarAlu:
+                    category_instruction_count.instruction_count_scalar_alu += weight;
+                    break;
+                case Instruction::kVectorMemoryRead:
+                    category_instruction_count.instruction_count_vector_memory_read += weight;
+                    break;
+                case Instruction::kVectorMemoryWrite:
+                    category_instruction_count.instruction_count_vector_memory_write += weight;
+                    break;
+                case Instruction::kVectorAlu:
+                    category_instruction_count.instruction_count_vector_alu += weight;
+                    break;
+                case Instruction::kLds:
+                    category_instruction_count.instruction_count_lds += weight;
+                    break;
+                case Instruction::kGds:
+                    category_instruction_count.instruction_count_gds += weight;
+                    break;
+                case Instruction::kExport:
+                    category_instruction_count.instruction_count_export += weight;
+                    break;
+                case Instruction::kAtomics:
+                    category_instruction_count.instruction_count_atomics += weight;
+                    break;
+                default:
+                    // Flow control is not counted in any category, but it is counted in the cycles.
+                    break;
+                }
+
+                int min_cycles = 0, typical_cycles = 0, max_cycles = 0;
+                GetInstructionCycles(*instruction, min_cycles, typical_cycles, max_cycles);
+                category_instruction_count.calculated_cycles += typical_cycles;
+                category_instruction_count.calculated_cycles_per_wavefront += static_cast<uint64_t>(typical_cycles) * weight;
+                category_instruction_count.min_cycles_per_wavefront += static_cast<uint64_t>(min_cycles) * weight;
+                category_instruction_count.max_cycles_per_wavefront += static_cast<uint64_t>(max_cycles) * weight;
+            }
+        }
+    }
 }
 
 void ISAProgramGraph::GetNumOfInstructionsInCategory(ISAProgramGraph::NumOfInstructionsInCategory instruction_category_count[kCalcPathCount], std::string graph_text)
 {
-    std::set<ISAProgramGraph::LabelNodeSet, ISAProgramGraph::LabelNodeSetCompare> path_instruction_set_all;
+    std::vector<int> path_instruction_set_all;
     GetInstructionsOfProgramPath(path_instruction_set_all, kCalcAll); // ALL
     CountInstructions(path_instruction_set_all, instruction_category_count[kCalcAll]);
 
-    std::set<ISAProgramGraph::LabelNodeSet, ISAProgramGraph::LabelNodeSetCompare> path_instruction_set_true;
+    std::vector<int> path_instruction_set_true;
     GetInstructionsOfProgramPath(path_instruction_set_true, kCalcTrue); // TRUE
     CountInstructions(path_instruction_set_true, instruction_category_count[kCalcTrue]);
 
-    std::set<ISAProgramGraph::LabelNodeSet, ISAProgramGraph::LabelNodeSetCompare> path_instruction_set_false;
+    std::vector<int> path_instruction_set_false;
     GetInstructionsOfProgramPath(path_instruction_set_false, kCalcFalse); // FALSE
     CountInstructions(path_instruction_set_false, instruction_category_count[kCalcFalse]);
 
@@ -524,11 +615,24 @@ void ISAProgramGraph::GetNumOfInstructionsInCategory(ISAProgramGraph::NumOfInstr
     }
 }
 
+void ISAProgramGraph::GetCycleEstimate(ISAProgramGraph::CycleEstimate& estimate)
+{
+    ISAProgramGraph::NumOfInstructionsInCategory path_count[kCalcPathCount];
+    GetNumOfInstructionsInCategory(path_count, "");
+
+    const NumOfInstructionsInCategory& path_true = path_count[kCalcTrue];
+    const NumOfInstructionsInCategory& path_false = path_count[kCalcFalse];
+    estimate.min_cycles = std::min(path_true.min_cycles_per_wavefront, path_false.min_cycles_per_wavefront);
+    estimate.typical_cycles = (path_true.calculated_cycles_per_wavefront + path_false.calculated_cycles_per_wavefront) / 2;
+    estimate.max_cycles = path_count[kCalcAll].max_cycles_per_wavefront;
+}
+
 void ISAProgramGraph::SetNumOfLoopIteration(int loop_iteration_count)
 {
     if (loop_iteration_count > 0)
     {
         loop_iteration_count_ = loop_iteration_count;
+        UpdateNumOfIteration();
     }
 }
 
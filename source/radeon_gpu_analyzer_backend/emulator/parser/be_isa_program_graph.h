@@ -9,57 +9,61 @@
 #define RGA_RADEONGPUANALYZERBACKEND_SRC_EMULATOR_PARSER_BE_ISA_PROGRAM_GRAPH_H_
 
 #include "be_instruction.h"
+#include <cstdint>
 #include <iostream>
 #include <vector>
 #include <map>
 #include <sstream>
 #include <fstream>
-#include <iostream>
 #include <set>
 #include <string>
+#include <unordered_map>
+
+// This value means no block (an index into the block array of ISAProgramGraph).
+const int kNoBlock = -1;
 
 // Basic node in the isa program.
 class IsaCodeBlock
 {
 private:
-    // The label number of the loop, if any.
+    // The label number of the block, if any.
     int label_ = kNoLabel;
 
-    // How many times to do the loop, if applicable.
+    // How many times the block is executed: the product of the iteration counts of the loops that contain it.
     int iteration_count_ = 1;
 
-    // How many nodes points on me.
+    // Index of the innermost loop that contains the block, or kNoBlock.
+    int loop_ = kNoBlock;
+
+    // The instructions of the block.
     std::vector<Instruction*> instructions_;
 
-    // Next code block.
-    IsaCodeBlock* next_ = nullptr;
+    // Next code block (fall through or unconditional branch).
+    int next_ = kNoBlock;
 
-    // Next code block in case of branch is true. null if point to the upper loop to avoid loops in the graph.
-    IsaCodeBlock* true_ = nullptr;
+    // Next code block in case of branch is true.
+    int true_ = kNoBlock;
 
     // Next code block in case of branch is false.
-    IsaCodeBlock* false_ = nullptr;
+    int false_ = kNoBlock;
 
 public:
     ~IsaCodeBlock() = default;
 
     int GetLabel() const {return label_;}
-    IsaCodeBlock* GetNext() {return next_;}
-    IsaCodeBlock* GetTrue() {return true_;}
-    IsaCodeBlock* GetFalse() {return false_;}
+    int GetNext() const {return next_;}
+    int GetTrue() const {return true_;}
+    int GetFalse() const {return false_;}
     int GetIterationCount() const {return iteration_count_;}
+    int GetLoop() const {return loop_;}
     const std::vector<Instruction*>& GetIsaCodeBlockInstructions() const { return instructions_;}
 
-    void SetNext(IsaCodeBlock* p) { next_ = p; }
-    void SetTrue(IsaCodeBlock*  p)  { true_ = p; }
-    void SetFalse(IsaCodeBlock* p) { false_ = p; }
-    void SetIterationCount(int iteration_count) { iteration_count_ = iteration_count; }
-
     friend class ISAProgramGraph;
 };
 
 // This class is a utility class that can build, destroy, search and traverse ISAProgramGraph.
-// The LabelNodeSet is saved as well so finding a label will be efficient
+// The blocks are kept in a flat array and refer to each other by index. Loops are found by a dominator
+// analysis, and the iteration count of every block is derived from the nest of loops that contain it.
 class ISAProgramGraph
 {
 public:
@@ -84,8 +88,16 @@ public:
         unsigned int instruction_count_gds = 0;
         unsigned int instruction_count_export = 0;
         unsigned int instruction_count_atomics = 0;
-        unsigned int calculated_cycles = 0;
-        unsigned int calculated_cycles_per_wavefront = 0;
+
+        // Cycles of the path's instructions (with their typical cost), where every block is counted once.
+        uint64_t calculated_cycles = 0;
+
+        // Cycles that a wavefront spends executing the path: the cost of every block is multiplied by its loop iteration count.
+        uint64_t calculated_cycles_per_wavefront = 0;
+
+        // Same as calculated_cycles_per_wavefront, with the lowest and with the highest cost of the instructions whose cost varies.
+        uint64_t min_cycles_per_wavefront = 0;
+        uint64_t max_cycles_per_wavefront = 0;
 
         NumOfInstructionsInCategory& operator=(const NumOfInstructionsInCategory& original)
         {
@@ -101,68 +113,77 @@ public:
             instruction_count_atomics = original.instruction_count_atomics;
             calculated_cycles = original.calculated_cycles;
             calculated_cycles_per_wavefront = original.calculated_cycles_per_wavefront;
+            min_cycles_per_wavefront = original.min_cycles_per_wavefront;
+            max_cycles_per_wavefront = original.max_cycles_per_wavefront;
             return *this;
         };
     };
 
-private:
-    class LabelNodeSet
+    // Static estimate of the number of cycles that a wavefront spends executing the program.
+    struct CycleEstimate
     {
-    public:
-        int label_;
-        int iteration_count_;
-        IsaCodeBlock* node_code_block_;
+        // The cheaper of the TRUE and FALSE paths, with the lowest cost of every instruction.
+        uint64_t min_cycles = 0;
 
-        LabelNodeSet()
-        {
-            label_ = kNoLabel;
-            node_code_block_ = NULL;
-            iteration_count_ = 1;
-        }
+        // The average of the TRUE and FALSE paths, with the typical cost of every instruction.
+        uint64_t typical_cycles = 0;
+
+        // The ALL path (a divergent wavefront executes both sides of every branch), with the highest cost of every instruction.
+        uint64_t max_cycles = 0;
     };
 
-    class LabelNodeSetCompare
+private:
+    // A natural loop: the header, and the blocks that reach a back edge to the header without passing through it.
+    struct IsaLoop
     {
-    public:
-        bool operator()(const LabelNodeSet& lhs, const LabelNodeSet& rhs) const
-        {
-            if (lhs.label_ < rhs.label_)
-            {
-                return true;
-            }
-            else
-            {
-                return false;
-            }
-        }
+        // Index of the loop header block.
+        int header = kNoBlock;
+
+        // Index of the innermost loop that contains this loop, or kNoBlock.
+        int parent = kNoBlock;
+
+        // The blocks of the loop.
+        std::vector<int> blocks;
+
+        // True for a loop over the lanes of the wavefront, which uses the default iteration count of hardware loops.
+        bool is_hw_loop = false;
     };
 
-private:
-    // Head of the entire ISA graph.
-    IsaCodeBlock* isa_code_block_;
+    // The blocks of the program. The first block is the entry block.
+    std::vector<IsaCodeBlock> blocks_;
 
-    // Container for quick node search.
-    std::set<LabelNodeSet, LabelNodeSetCompare> node_set_;
+    // Container for quick block search by label.
+    std::unordered_map<int, int> label_blocks_;
+
+    // The loops of the program.
+    std::vector<IsaLoop> loops_;
+
+    // Position of every block in a pre-order and a post-order walk of the dominator tree (-1 for unreachable blocks).
+    std::vector<int> dominator_tree_pre_;
+    std::vector<int> dominator_tree_post_;
 
-    // Fake label for nodes with no original label in the ISA.
-    int next_label_;
     int loop_iteration_count_;
 
-    // Internal function that builds the graph out of the instruction vector.
-    bool BuildISAProgramStructureInternal(std::vector<Instruction*>& Instructions, std::vector<Instruction*>::const_iterator instIterator, IsaCodeBlock* pHeadIsaNode);
+    // Split the instructions into blocks and link the blocks.
+    void BuildBlocks(std::vector<Instruction*>& instructions);
+
+    // Compute the dominator tree of the blocks.
+    void BuildDominatorTree(const std::vector<std::vector<int>>& predecessors);
 
-    // Part of ISA program graph. when a loop is discovered update the default num of iteration.
-    bool UpdateNumOfIteration(std::vector<Instruction*>& Instructions, IsaCodeBlock* pLoop, const std::vector<Instruction*>::const_iterator iIterator);
+    // Find the natural loops of the program and their nesting.
+    void FindLoops(const std::vector<std::vector<int>>& predecessors);
 
-    // Internal recursive search.
-    void GetInstructionsOfProgramPathInternal(std::set<LabelNodeSet, LabelNodeSetCompare>& PathInstructionsSet, IsaCodeBlock* pHeadISACodeBlock, int iPath, int iNumOfIterations);
+    // Set the iteration count of every block according to the loops that contain it.
+    void UpdateNumOfIteration();
 
+    // Returns true if block "dominator" dominates block "block".
+    bool Dominates(int dominator, int block) const;
 
-    // Create a new node, updates it's label and update the node set.
-    IsaCodeBlock* CreateNewNode(int label_);
+    // Returns true if the edge between the given blocks goes back to the header of a loop.
+    bool IsBackEdge(int from, int to) const;
 
     // The main function that counts the instruction in the specific ISA graph. this is the main idea of the entire analysis.
-    void CountInstructions(std::set<ISAProgramGraph::LabelNodeSet, ISAProgramGraph::LabelNodeSetCompare> PathInstructionsSet, ISAProgramGraph::NumOfInstructionsInCategory& NumOfInstructionsInCategory);
+    void CountInstructions(const std::vector<int>& path_blocks, ISAProgramGraph::NumOfInstructionsInCategory& NumOfInstructionsInCategory);
 
 public:
     ISAProgramGraph();
@@ -174,18 +195,25 @@ public:
      // Destroy ALL the program graph.
     void DestroyISAProgramStructure();
 
-    // Return the node with the desired label
-    IsaCodeBlock* LabelSearcher(int label_);
+    // Return the index of the block with the desired label, or kNoBlock.
+    int LabelSearcher(int label_) const;
 
-    // Return the vector of instruction in a specific path (all/true/false)
-    void GetInstructionsOfProgramPath(std::set<LabelNodeSet, LabelNodeSetCompare>& PathInstructionsSet, int iPath);
+    // Return the blocks of the program.
+    const std::vector<IsaCodeBlock>& GetBlocks() const { return blocks_; }
+
+    // Return the indices of the blocks in a specific path (all/true/false). Back edges are not followed:
+    // the repetitions of a loop are accounted for by the iteration counts of its blocks.
+    void GetInstructionsOfProgramPath(std::vector<int>& path_blocks, int iPath) const;
 
     // Save the graph in GRAPHVIZ format.
-    void DumpGraph(std::set<ISAProgramGraph::LabelNodeSet, ISAProgramGraph::LabelNodeSetCompare> PathInstructionsSet, std::string sFileName);
+    void DumpGraph(const std::vector<int>& path_blocks, const std::string& sFileName) const;
 
     // Traverse through all Graph Paths (ALL/TRUE/FALSE) and count the instructions.
     void GetNumOfInstructionsInCategory(ISAProgramGraph::NumOfInstructionsInCategory NumOfInstructionsInCategory[kCalcPathCount], std::string sDumpGraph);
 
+    // Estimate the min/typical/max number of cycles per wavefront out of the ALL/TRUE/FALSE paths.
+    void GetCycleEstimate(CycleEstimate& estimate);
+
     void SetNumOfLoopIteration(int iNumOfLoopIteration);
     int GetNumOfLoopIteration();
 };
@@ -167,7 +167,7 @@ public:
     virtual ParserSi::kaStatus Parse(GDT_HW_GENERATION, Instruction::Instruction64Bit hexInstruction, Instruction*& instruction,
                                      int label_ = kNoLabel, int iGotoLabel = kNoLabel) override
     {
-        instruction = new FLATInstruction((uint16_t)INSTRUCTION_FIELD(hexInstruction, FLAT, OFFSET, 0),
+        instruction = CreateInstruction<FLATInstruction>((uint16_t)INSTRUCTION_FIELD(hexInstruction, FLAT, OFFSET, 0),
                                                0 != INSTRUCTION_FIELD(hexInstruction, FLAT, LDS,   13),
                                            (uint8_t)INSTRUCTION_FIELD(hexInstruction, FLAT, SEG,   14),
                                                0 != INSTRUCTION_FIELD(hexInstruction, FLAT, GLC,   16),
@@ -10,6 +10,7 @@
 
 #include <string>
 #include "be_instruction.h"
+#include "be_instruction_arena.h"
 #include "be_instruction_smrd.h"
 #include "be_instruction_sopp.h"
 #include "be_instruction_sopc.h"
@@ -146,7 +147,21 @@ public:
     // \param[in] callback a pointer to callback function.
     static void SetLog(LoggingCallBackFuncP callback);
 
+    // Set the arena in which the parsed instructions are created.
+    void SetInstructionArena(InstructionArena* arena) { instruction_arena_ = arena; }
+
+protected:
+    // Create an instruction of type T in the instruction arena.
+    template <typename T, typename... Args>
+    T* CreateInstruction(Args&&... args)
+    {
+        return instruction_arena_->Create<T>(std::forward<Args>(args)...);
+    }
+
 private:
+    // The arena that holds the parsed instructions (owned by the ISA parser).
+    InstructionArena* instruction_arena_ = nullptr;
+
     // Stream for diagnostic output.
     static LoggingCallBackFuncP log_callback_;
 };
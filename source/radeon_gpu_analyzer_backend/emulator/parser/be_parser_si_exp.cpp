@@ -89,7 +89,7 @@ ParserSi::kaStatus ParserSiExp::Parse(GDT_HW_GENERATION, Instruction::Instructio
     vsrc[2] = GetVsrc(hex_instruction, 2);
     vsrc[3] = GetVsrc(hex_instruction, 3);
 
-    instruction = new EXPInstruction(en, target, compr, done, vm, vsrc[0], vsrc[1], vsrc[2], vsrc[3], label, goto_label);
+    instruction = CreateInstruction<EXPInstruction>(en, target, compr, done, vm, vsrc[0], vsrc[1], vsrc[2], vsrc[3], label, goto_label);
     return ParserSi::kStatusSuccess;
 }
 
@@ -185,13 +185,13 @@ ParserSi::kaStatus ParserSiMtbuf::Parse(GDT_HW_GENERATION hw_generation, Instruc
     if ((hw_generation == GDT_HW_GENERATION_SEAISLAND) || (hw_generation == GDT_HW_GENERATION_SOUTHERNISLAND))
     {
         SIMTBUFInstruction::OP op = GetSiOpMtbuf(hex_instruction, instruction_kind);
-        instruction = new SIMTBUFInstruction(offset, offen, idxen, glc, addr64, op, dfmt, nmft, vaddr, vdata, srsrc, slc,
+        instruction = CreateInstruction<SIMTBUFInstruction>(offset, offen, idxen, glc, addr64, op, dfmt, nmft, vaddr, vdata, srsrc, slc,
                                              tfe, soffset, ridx, instruction_kind, label, goto_label);
     }
     else
     {
         VIMTBUFInstruction::OP op = GetViOpMtbuf(hex_instruction, instruction_kind);
-        instruction = new VIMTBUFInstruction(offset, offen, idxen, glc, addr64, op, dfmt, nmft, vaddr, vdata, srsrc, slc,
+        instruction = CreateInstruction<VIMTBUFInstruction>(offset, offen, idxen, glc, addr64, op, dfmt, nmft, vaddr, vdata, srsrc, slc,
                                              tfe, soffset, ridx, instruction_kind, label, goto_label);
     }
 
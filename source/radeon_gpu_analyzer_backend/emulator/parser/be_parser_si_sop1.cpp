@@ -113,17 +113,17 @@ ParserSi::kaStatus ParserSiSop1::Parse(GDT_HW_GENERATION hw_generation, Instruct
     if ((hw_generation == GDT_HW_GENERATION_SEAISLAND) || (hw_generation == GDT_HW_GENERATION_SOUTHERNISLAND))
     {
         SISOP1Instruction::OP op = GetSISOP1Op(hex_instruction);
-        instruction = new SISOP1Instruction(ssrc0, op, sdst, ridx0, sdstRidx1, label, goto_label);
+        instruction = CreateInstruction<SISOP1Instruction>(ssrc0, op, sdst, ridx0, sdstRidx1, label, goto_label);
     }
     else if (hw_generation == GDT_HW_GENERATION_VOLCANICISLAND)
     {
         VISOP1Instruction::OP op = GetVISOP1Op(hex_instruction);
-        instruction = new VISOP1Instruction(ssrc0, op, sdst, ridx0, sdstRidx1, label, goto_label);
+        instruction = CreateInstruction<VISOP1Instruction>(ssrc0, op, sdst, ridx0, sdstRidx1, label, goto_label);
     }
     else if (hw_generation == GDT_HW_GENERATION_GFX9)
     {
         G9SOP1Instruction::OP op = GetG9SOP1Op(hex_instruction);
-        instruction = new G9SOP1Instruction(ssrc0, op, sdst, ridx0, sdstRidx1, label, goto_label);
+        instruction = CreateInstruction<G9SOP1Instruction>(ssrc0, op, sdst, ridx0, sdstRidx1, label, goto_label);
     }
     else
     {
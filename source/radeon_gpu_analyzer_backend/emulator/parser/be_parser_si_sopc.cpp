@@ -92,12 +92,12 @@ ParserSi::kaStatus ParserSiSopC::Parse(GDT_HW_GENERATION hw_generation, Instruct
     if ((hw_generation == GDT_HW_GENERATION_SEAISLAND) || (hw_generation == GDT_HW_GENERATION_SOUTHERNISLAND))
     {
         SISOPCInstruction::OP op = GetSiSopcOp(hex_instruction);
-        instruction = new SISOPCInstruction(ssrc0, ssrc1, op, ridx0, ridx1, label, goto_label);
+        instruction = CreateInstruction<SISOPCInstruction>(ssrc0, ssrc1, op, ridx0, ridx1, label, goto_label);
     }
     else
     {
         VISOPCInstruction::OP op = GetViSopcOp(hex_instruction);
-        instruction = new VISOPCInstruction(ssrc0, ssrc1, op, ridx0, ridx1, label, goto_label);
+        instruction = CreateInstruction<VISOPCInstruction>(ssrc0, ssrc1, op, ridx0, ridx1, label, goto_label);
     }
 
     return ParserSi::kStatusSuccess;
@@ -54,12 +54,12 @@ ParserSi::kaStatus ParserSiSopp::Parse(GDT_HW_GENERATION hw_generation, Instruct
     if ((hw_generation == GDT_HW_GENERATION_SEAISLAND) || (hw_generation == GDT_HW_GENERATION_SOUTHERNISLAND))
     {
         SISOPPInstruction::OP op = GetSiSoppOp(hex_instruction);
-        instruction = new SISOPPInstruction(simm16, op, label, goto_label);
+        instruction = CreateInstruction<SISOPPInstruction>(simm16, op, label, goto_label);
     }
     else
     {
         VISOPPInstruction::OP op = GetViSoppOp(hex_instruction);
-        instruction = new VISOPPInstruction(simm16, op, label, goto_label);
+        instruction = CreateInstruction<VISOPPInstruction>(simm16, op, label, goto_label);
     }
 
     return ParserSi::kStatusSuccess;
@@ -55,12 +55,12 @@ ParserSi::kaStatus ParserSiVintrp::Parse(GDT_HW_GENERATION hw_generation, Instru
     if ((hw_generation == GDT_HW_GENERATION_SEAISLAND) || (hw_generation == GDT_HW_GENERATION_SOUTHERNISLAND))
     {
         SIVINTRPInstruction::OP op = GetSIVINTRPOp(hex_instruction);
-        instruction = new SIVINTRPInstruction(vsrc, attrchan, attr, op, vdst, label, goto_label);
+        instruction = CreateInstruction<SIVINTRPInstruction>(vsrc, attrchan, attr, op, vdst, label, goto_label);
     }
     else
     {
         VIVINTRPInstruction::OP op = GetVIVINTRPOp(hex_instruction);
-        instruction = new VIVINTRPInstruction(vsrc, attrchan, attr, op, vdst, label, goto_label);
+        instruction = CreateInstruction<VIVINTRPInstruction>(vsrc, attrchan, attr, op, vdst, label, goto_label);
     }
 
     return ParserSi::kStatusSuccess;
@@ -19,7 +19,7 @@ ParserSi::kaStatus ParserSiVop::Parse(GDT_HW_GENERATION hw_generation, Instructi
             uint64_t hex_instruction_temp = hex_instruction << 15;
             hex_instruction_temp = hex_instruction_temp >> 24;
             SIVOP1Instruction::Vop1Op op1 = static_cast<SIVOP1Instruction::Vop1Op>(hex_instruction_temp);
-            instruction = new SIVOP1Instruction(32, encoding, op1, label, goto_label);
+            instruction = CreateInstruction<SIVOP1Instruction>(32, encoding, op1, label, goto_label);
             ret = ParserSi::kStatusSuccess;
         }
         else if (VOPInstruction::kEncodingVop2 == encoding)
@@ -27,7 +27,7 @@ ParserSi::kaStatus ParserSiVop::Parse(GDT_HW_GENERATION hw_generation, Instructi
             uint64_t hex_instruction_temp = hex_instruction << 15;
             hex_instruction_temp = hex_instruction_temp >> 24;
             SIVOP2Instruction::Vop2Op op2 = static_cast<SIVOP2Instruction::Vop2Op>(hex_instruction_temp);
-            instruction = new SIVOP2Instruction(32, encoding, op2, label, goto_label);
+            instruction = CreateInstruction<SIVOP2Instruction>(32, encoding, op2, label, goto_label);
             ret = ParserSi::kStatusSuccess;
         }
 
@@ -36,7 +36,7 @@ ParserSi::kaStatus ParserSiVop::Parse(GDT_HW_GENERATION hw_generation, Instructi
             uint64_t hex_instruction_temp = hex_instruction << 15;
             hex_instruction_temp = hex_instruction_temp >> 24;
             SIVOPCInstruction::VopcOp opc = static_cast<SIVOPCInstruction::VopcOp>(hex_instruction_temp);
-            instruction = new SIVOPCInstruction(32, encoding, opc, label, goto_label);
+            instruction = CreateInstruction<SIVOPCInstruction>(32, encoding, opc, label, goto_label);
             ret = ParserSi::kStatusSuccess;
         }
     }
@@ -47,7 +47,7 @@ ParserSi::kaStatus ParserSiVop::Parse(GDT_HW_GENERATION hw_generation, Instructi
             uint64_t hex_instruction_temp = hex_instruction << 15;
             hex_instruction_temp = hex_instruction_temp >> 24;
             VIVOP1Instruction::Vop1Op op1 = static_cast<VIVOP1Instruction::Vop1Op>(hex_instruction_temp);
-            instruction = new VIVOP1Instruction(32, encoding, op1, label, goto_label);
+            instruction = CreateInstruction<VIVOP1Instruction>(32, encoding, op1, label, goto_label);
             ret = ParserSi::kStatusSuccess;
         }
         else if (VOPInstruction::kEncodingVop2 == encoding)
@@ -55,7 +55,7 @@ ParserSi::kaStatus ParserSiVop::Parse(GDT_HW_GENERATION hw_generation, Instructi
             uint64_t hex_instruction_temp = hex_instruction << 15;
             hex_instruction_temp = hex_instruction_temp >> 24;
             VIVOP2Instruction::Vop2Op op2 = static_cast<VIVOP2Instruction::Vop2Op>(hex_instruction_temp);
-            instruction = new VIVOP2Instruction(32, encoding, op2, label, goto_label);
+            instruction = CreateInstruction<VIVOP2Instruction>(32, encoding, op2, label, goto_label);
             ret = ParserSi::kStatusSuccess;
         }
 
@@ -64,7 +64,7 @@ ParserSi::kaStatus ParserSiVop::Parse(GDT_HW_GENERATION hw_generation, Instructi
             uint64_t hex_instruction_temp = hex_instruction << 15;
             hex_instruction_temp = hex_instruction_temp >> 24;
             VIVOPCInstruction::VopcOp opc = static_cast<VIVOPCInstruction::VopcOp>(hex_instruction_temp);
-            instruction = new VIVOPCInstruction(32, encoding, opc, label, goto_label);
+            instruction = CreateInstruction<VIVOPCInstruction>(32, encoding, opc, label, goto_label);
             ret = ParserSi::kStatusSuccess;
         }
     }
@@ -75,7 +75,7 @@ ParserSi::kaStatus ParserSiVop::Parse(GDT_HW_GENERATION hw_generation, Instructi
             uint64_t hex_instruction_temp = hex_instruction << 15;
             hex_instruction_temp = hex_instruction_temp >> 24;
             G9VOP1Instruction::Vop1Op op1 = static_cast<G9VOP1Instruction::Vop1Op>(hex_instruction_temp);
-            instruction = new G9VOP1Instruction(32, encoding, op1, label, goto_label);
+            instruction = CreateInstruction<G9VOP1Instruction>(32, encoding, op1, label, goto_label);
             ret = ParserSi::kStatusSuccess;
         }
         else if (VOPInstruction::kEncodingVop2 == encoding)
@@ -83,7 +83,7 @@ ParserSi::kaStatus ParserSiVop::Parse(GDT_HW_GENERATION hw_generation, Instructi
             uint64_t hex_instruction_temp = hex_instruction << 15;
             hex_instruction_temp = hex_instruction_temp >> 24;
             G9VOP2Instruction::Vop2Op op2 = static_cast<G9VOP2Instruction::Vop2Op>(hex_instruction_temp);
-            instruction = new G9VOP2Instruction(32, encoding, op2, label, goto_label);
+            instruction = CreateInstruction<G9VOP2Instruction>(32, encoding, op2, label, goto_label);
             ret = ParserSi::kStatusSuccess;
         }
 
@@ -92,7 +92,7 @@ ParserSi::kaStatus ParserSiVop::Parse(GDT_HW_GENERATION hw_generation, Instructi
             uint64_t hex_instruction_temp = hex_instruction << 15;
             hex_instruction_temp = hex_instruction_temp >> 24;
             VIVOPCInstruction::VopcOp opc = static_cast<VIVOPCInstruction::VopcOp>(hex_instruction_temp);
-            instruction = new VIVOPCInstruction(32, encoding, opc, label, goto_label);
+            instruction = CreateInstruction<VIVOPCInstruction>(32, encoding, opc, label, goto_label);
             ret = ParserSi::kStatusSuccess;
         }
     }
@@ -116,7 +116,7 @@ ParserSi::kaStatus ParserSiVop::Parse(GDT_HW_GENERATION hw_generation, Instructi
             uint64_t hex_instruction_temp = hex_instruction << 15;
             hex_instruction_temp = hex_instruction_temp >> 24;
             SIVOP3Instruction::Vop3Op op3 = static_cast<SIVOP3Instruction::Vop3Op>(hex_instruction_temp);
-            instruction = new SIVOP3Instruction(64, encoding, op3, label, goto_label);
+            instruction = CreateInstruction<SIVOP3Instruction>(64, encoding, op3, label, goto_label);
             ret =  ParserSi::kStatusSuccess;
         }
     }
@@ -126,7 +126,7 @@ ParserSi::kaStatus ParserSiVop::Parse(GDT_HW_GENERATION hw_generation, Instructi
         {
             uint64_t hex_instruction_temp = (hex_instruction >> 16) & 0x7F;
             G9VOP3Instruction::Vop3Op op3 = static_cast<G9VOP3Instruction::Vop3Op>(hex_instruction_temp);
-            instruction = new G9VOP3Instruction(64, encoding, op3, label, goto_label);
+            instruction = CreateInstruction<G9VOP3Instruction>(64, encoding, op3, label, goto_label);
             ret =  ParserSi::kStatusSuccess;
         }
         else if (VOPInstruction::kEncodingVop3 == encoding)
@@ -134,7 +134,7 @@ ParserSi::kaStatus ParserSiVop::Parse(GDT_HW_GENERATION hw_generation, Instructi
             uint64_t hex_instruction_temp = hex_instruction << 15;
             hex_instruction_temp = hex_instruction_temp >> 24;
             G9VOP3Instruction::Vop3Op op3 = static_cast<G9VOP3Instruction::Vop3Op>(hex_instruction_temp);
-            instruction = new G9VOP3Instruction(64, encoding, op3, label, goto_label);
+            instruction = CreateInstruction<G9VOP3Instruction>(64, encoding, op3, label, goto_label);
             ret =  ParserSi::kStatusSuccess;
         }
     }
@@ -0,0 +1,163 @@
+//=============================================================================
+/// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Test that compares the live register analysis of the in-process ISA analysis engine with the analysis of shae.
+//=============================================================================
+
+// C++.
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Local.
+#include "radeon_gpu_analyzer_backend/be_isa_analysis_engine.h"
+
+using namespace beKA;
+
+// The ISA disassembly samples, the target that each of them was compiled for, the shae options that
+// the CLI passes for that target, and the wave size.
+struct Fixture
+{
+    const char* file_name;
+    const char* target;
+    const char* shae_isa_option;
+    beWaveSize  wave_size;
+};
+
+static const Fixture kFixtures[] = {{"reduce_gfx1030.isa", "gfx1030", "--isa gfx10_3", kWave32},
+                                    {"nest_gfx1030.isa", "gfx1030", "--isa gfx10_3", kWave32},
+                                    {"branch_gfx900.isa", "gfx900", "--isa gfx9", kWave64},
+                                    {"mac_gfx90a.isa", "gfx90a", "--isa gfx90a", kWave64}};
+
+// The line of the analysis file that precedes the per-instruction rows.
+static const char* kTableHeaderStart = "  Line |";
+
+// Read the whole file into the given text.
+static bool ReadFile(const std::string& file_path, std::string& text)
+{
+    std::ifstream     file(file_path, std::ios::binary);
+    std::stringstream file_text;
+    file_text << file.rdbuf();
+    text = file_text.str();
+    return file.good() && !text.empty();
+}
+
+// Read the lines of the analysis file, starting at the table header: the per-instruction rows with the number of
+// live registers, the register usage and the instruction, followed by the maximum, allocated and requested registers.
+static bool ReadAnalysis(const std::string& file_path, std::vector<std::string>& lines)
+{
+    std::string text;
+    bool        ret = ReadFile(file_path, text);
+    if (ret)
+    {
+        std::stringstream stream(text);
+        std::string       line;
+        bool              is_table = false;
+        while (std::getline(stream, line))
+        {
+            line.erase(line.find_last_not_of(" \r") + 1);
+            is_table = is_table || line.compare(0, std::string(kTableHeaderStart).size(), kTableHeaderStart) == 0;
+            if (is_table)
+            {
+                lines.push_back(line);
+            }
+        }
+        ret = !lines.empty();
+    }
+    return ret;
+}
+
+// Analyze the sample with the engine and write the analysis file.
+static bool AnalyzeWithEngine(const std::string& isa, const Fixture& fixture, bool is_reg_type_sgpr, const std::string& output_path)
+{
+    BeIsaProgram      program;
+    BeLiveRegAnalysis analysis;
+    return program.Parse(isa) &&
+           BeIsaAnalysisEngine::AnalyzeLiveRegisters(program, fixture.target, fixture.wave_size, is_reg_type_sgpr, analysis) == kBeStatusSuccess &&
+           BeIsaAnalysisEngine::WriteLiveRegisterAnalysis(analysis, output_path) == kBeStatusSuccess;
+}
+
+// Analyze the sample with shae, with the options that the CLI passes.
+static bool AnalyzeWithShae(const std::string& shae_path, const std::string& isa_path, const Fixture& fixture, bool is_reg_type_sgpr,
+                            const std::string& output_path)
+{
+    std::stringstream cmd;
+    cmd << '"' << shae_path << "\" " << fixture.shae_isa_option << " analyse-liveness --arch-info";
+    if (is_reg_type_sgpr)
+    {
+        cmd << " --reg-type sgpr";
+    }
+    else
+    {
+        cmd << (fixture.wave_size == kWave64 ? " --wave-size 64" : " --wave-size 32");
+    }
+    cmd << " \"" << isa_path << "\" \"" << output_path << '"';
+    return std::system(cmd.str().c_str()) == 0;
+}
+
+// Usage: be_isa_analysis_engine_test [fixtures directory] [shae path]
+int main(int argc, char* argv[])
+{
+    const std::string fixtures_dir = (argc > 1 ? argv[1] : RGA_ISA_ANALYSIS_ENGINE_TEST_FIXTURES_DIR);
+    const std::string shae_path    = (argc > 2 ? argv[2] : RGA_ISA_ANALYSIS_ENGINE_TEST_SHAE_PATH);
+    int               match_count  = 0;
+    bool              ret          = true;
+
+    for (const Fixture& fixture : kFixtures)
+    {
+        const std::string fixture_path = fixtures_dir + "/" + fixture.file_name;
+        std::string       isa;
+        if (!ReadFile(fixture_path, isa))
+        {
+            std::printf("Failed to read %s\n", fixture_path.c_str());
+            ret = false;
+            continue;
+        }
+
+        for (bool is_reg_type_sgpr : {false, true})
+        {
+            const char*              reg_type      = (is_reg_type_sgpr ? "SGPR" : "VGPR");
+            const std::string        output_base   = std::string(fixture.file_name) + "." + reg_type;
+            const std::string        engine_output = output_base + ".engine.txt";
+            const std::string        shae_output   = output_base + ".shae.txt";
+            std::vector<std::string> engine_lines;
+            std::vector<std::string> shae_lines;
+            if (!AnalyzeWithEngine(isa, fixture, is_reg_type_sgpr, engine_output) || !ReadAnalysis(engine_output, engine_lines))
+            {
+                std::printf("The engine failed to analyze the %ss of %s\n", reg_type, fixture_path.c_str());
+                ret = false;
+            }
+            else if (!AnalyzeWithShae(shae_path, fixture_path, fixture, is_reg_type_sgpr, shae_output) || !ReadAnalysis(shae_output, shae_lines))
+            {
+                std::printf("shae failed to analyze the %ss of %s\n", reg_type, fixture_path.c_str());
+                ret = false;
+            }
+            else
+            {
+                // Report every line that differs.
+                const size_t line_count = std::max(engine_lines.size(), shae_lines.size());
+                bool         is_match   = true;
+                for (size_t i = 0; i < line_count; i++)
+                {
+                    const std::string engine_line = (i < engine_lines.size() ? engine_lines[i] : "<none>");
+                    const std::string shae_line   = (i < shae_lines.size() ? shae_lines[i] : "<none>");
+                    if (engine_line != shae_line)
+                    {
+                        std::printf("%s %s:\n  engine: %s\n  shae:   %s\n", fixture.file_name, reg_type, engine_line.c_str(), shae_line.c_str());
+                        is_match = false;
+                    }
+                }
+                match_count += (is_match ? 1 : 0);
+                ret = ret && is_match;
+            }
+        }
+    }
+
+    std::printf("%d of %zu live register analyses match shae.\n", match_count, 2 * sizeof(kFixtures) / sizeof(kFixtures[0]));
+    return (ret ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,244 @@
+//=============================================================================
+/// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Benchmark that compares the regex-based ISA line scanner that the parser used to have with its string_view scanner.
+//=============================================================================
+
+// C++.
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <string>
+
+// Boost.
+#include <boost/regex.hpp>
+
+// Local.
+#include "emulator/parser/be_isa_parser.h"
+
+// The ISA disassembly sample whose code section is repeated to form the large disassembly.
+static const char* kFixtureFileName = "reduce_gfx1030.isa";
+
+// The line that starts the code section of the sample.
+static const char* kCodeSectionStart = "@kernel ";
+
+// Default number of repetitions of the sample's code section.
+static const unsigned kDefaultRepeatCount = 5000;
+
+// Number of timed runs of every scanner. The fastest run is reported.
+static const int kRunCount = 3;
+
+// Read the whole file into the given text.
+static bool ReadFile(const std::string& file_path, std::string& text)
+{
+    std::ifstream     file(file_path, std::ios::binary);
+    std::stringstream file_text;
+    file_text << file.rdbuf();
+    text = file_text.str();
+    return file.good() && !text.empty();
+}
+
+// Build a large disassembly out of the sample: its header, followed by its code section repeated the given number of times.
+static bool BuildLargeIsa(const std::string& sample, unsigned repeat_count, std::string& isa)
+{
+    const size_t code_start = sample.find(kCodeSectionStart);
+    const size_t code_end   = (code_start != std::string::npos ? sample.find('\n', code_start) : std::string::npos);
+    bool         ret        = (code_end != std::string::npos);
+    if (ret)
+    {
+        const std::string header = sample.substr(0, code_end + 1);
+        const std::string code   = sample.substr(code_end + 1);
+        isa.reserve(header.size() + code.size() * repeat_count);
+        isa = header;
+        for (unsigned i = 0; i < repeat_count; i++)
+        {
+            isa += code;
+        }
+    }
+    return ret;
+}
+
+// The code size scan of ParserIsa::ParseForSize before the string_view scanner replaced the regular expressions.
+static unsigned ParseForSizeWithRegex(const std::string& isa)
+{
+    unsigned int code_len = 0;
+    bool         ret      = false;
+    boost::regex code_len_byte_ex("([[:blank:]]*codeLenInByte[[:blank:]]*=[[:blank:]]*)([[:digit:]]*)");
+    boost::regex code_len_byte_ni("([[:blank:]]*CodeLen[[:blank:]]*=[[:blank:]]*)([[:digit:]]*)");
+    boost::regex instruction_annotation_scpc("//[[:blank:]]*[[:xdigit:]]{12}:[[:blank:]]*([[:xdigit:]]{8})([[:blank:]]+[[:xdigit:]]{8}){0,1}");
+    boost::regex instruction_annotation_llpc(";[[:blank:]]*([[:xdigit:]]{8})([[:blank:]]+[[:xdigit:]]{8}){0,1}");
+
+    std::istringstream isa_stream(isa);
+    boost::smatch      match_instruction;
+    std::string        isa_line;
+    int                isa_size = 0;
+
+    while (getline(isa_stream, isa_line))
+    {
+        if (boost::regex_search(isa_line, match_instruction, code_len_byte_ex))
+        {
+            std::string code_len_text(match_instruction[2].first, match_instruction[2].second);
+            code_len = atoi(code_len_text.c_str());
+            ret      = true;
+            break;
+        }
+        else if (boost::regex_search(isa_line, match_instruction, code_len_byte_ni))
+        {
+            std::string code_len_text(match_instruction[2].first, match_instruction[2].second);
+            code_len = atoi(code_len_text.c_str());
+            ret      = true;
+            break;
+        }
+        else if (boost::regex_search(isa_line, match_instruction, instruction_annotation_scpc) ||
+                 boost::regex_search(isa_line, match_instruction, instruction_annotation_llpc))
+        {
+            int instruction_size = match_instruction[(int)match_instruction.size() - 1].matched ? 8 : 4;
+            isa_size += instruction_size;
+            ret = true;
+        }
+    }
+
+    if (ret && isa_size != 0)
+    {
+        code_len = isa_size;
+    }
+    return code_len;
+}
+
+// The code size scan of ParserIsa::ParseForSize with the string_view scanner.
+static unsigned ParseForSizeWithScanner(const std::string& isa)
+{
+    ParserIsa parser;
+    parser.ParseForSize(isa);
+    return parser.GetCodeLength();
+}
+
+// The instruction encoding scan of ParserIsa::ParseToVector before the string_view scanner replaced the regular expressions,
+// without the instruction decoding. Returns the number of instructions whose encoding was found.
+static unsigned ScanEncodingsWithRegex(const std::string& isa)
+{
+    boost::smatch match_instruction;
+    boost::regex  regex_inst32_48("([[:print:]]*// [[:print:]]{12}: )([[:print:]]{8})");
+    boost::regex  regex_inst64_48("([[:print:]]*// [[:print:]]{12}: )([[:print:]]{8})( )([[:print:]]{8})");
+    boost::regex  regex_inst32("([[:print:]]*// [[:print:]]{8}: )([[:print:]]{8})");
+    boost::regex  regex_inst_64("([[:print:]]*// [[:print:]]{8}: )([[:print:]]{8})( )([[:print:]]{8})");
+
+    std::istringstream isa_stream(isa);
+    std::string        isa_line;
+    unsigned           ret = 0;
+    while (getline(isa_stream, isa_line))
+    {
+        std::stringstream           instruction_stream;
+        std::string::const_iterator isa_line_start = isa_line.begin();
+        std::string::const_iterator isa_line_end   = isa_line.end();
+        if (boost::regex_search(isa_line_start, isa_line_end, match_instruction, regex_inst_64) ||
+            boost::regex_search(isa_line_start, isa_line_end, match_instruction, regex_inst64_48))
+        {
+            std::string                   inst32_text_lower_case(match_instruction[2].first, match_instruction[2].second);
+            std::string                   inst32_text_upper_case(match_instruction[4].first, match_instruction[4].second);
+            Instruction::Instruction64Bit inst64 = 0;
+            instruction_stream << std::hex << inst32_text_upper_case << inst32_text_lower_case;
+            instruction_stream >> inst64;
+            ret++;
+        }
+        else if (boost::regex_search(isa_line_start, isa_line_end, match_instruction, regex_inst32) ||
+                 boost::regex_search(isa_line_start, isa_line_end, match_instruction, regex_inst32_48))
+        {
+            std::string                   inst32_ext(match_instruction[2].first, match_instruction[2].second);
+            Instruction::Instruction32Bit inst32 = 0;
+            instruction_stream << std::hex << inst32_ext;
+            instruction_stream >> inst32;
+            ret++;
+        }
+    }
+    return ret;
+}
+
+// The full parse with the string_view scanner: instruction decoding and program graph included.
+// Returns the number of parsed instructions, not including the labels.
+static unsigned ParseWithScanner(const std::string& isa)
+{
+    ParserIsa parser;
+    parser.Parse(std::string_view(isa), true);
+    const std::vector<Instruction*>& instructions = parser.GetInstructions();
+    return static_cast<unsigned>(std::count_if(
+        instructions.begin(), instructions.end(), [](const Instruction* instruction) { return instruction->GetLabel() == kNoLabel; }));
+}
+
+// Run the scanner a few times and return the time of the fastest run in milliseconds, along with the scanner's result.
+static double TimeScanner(const std::function<unsigned(const std::string&)>& scanner, const std::string& isa, unsigned& result)
+{
+    double ret = 0;
+    for (int i = 0; i < kRunCount; i++)
+    {
+        const auto                                      start   = std::chrono::steady_clock::now();
+        result                                                  = scanner(isa);
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        ret = (i == 0 ? elapsed.count() : std::min(ret, elapsed.count()));
+    }
+    return ret;
+}
+
+// Print the times of the regex-based and the string_view scanners and the speedup.
+static void PrintComparison(const char* name, double regex_time, double scanner_time, size_t isa_size)
+{
+    const double mega_bytes = static_cast<double>(isa_size) / (1024 * 1024);
+    std::printf("%-36s regex: %9.2f ms (%7.1f MB/s)   string_view: %9.2f ms (%7.1f MB/s)   speedup: %5.1fx\n",
+                name,
+                regex_time,
+                mega_bytes * 1000 / regex_time,
+                scanner_time,
+                mega_bytes * 1000 / scanner_time,
+                regex_time / scanner_time);
+}
+
+// Usage: be_isa_parser_benchmark [fixtures directory] [repetitions of the sample's code section]
+int main(int argc, char* argv[])
+{
+    const std::string fixtures_dir = (argc > 1 ? argv[1] : RGA_ISA_PARSER_TEST_FIXTURES_DIR);
+    const unsigned    repeat_count = (argc > 2 ? static_cast<unsigned>(std::strtoul(argv[2], nullptr, 10)) : kDefaultRepeatCount);
+    const std::string fixture_path = fixtures_dir + "/" + kFixtureFileName;
+    std::string       sample;
+    std::string       isa;
+    bool              ret = ReadFile(fixture_path, sample) && BuildLargeIsa(sample, std::max(repeat_count, 1u), isa);
+    if (!ret)
+    {
+        std::printf("Failed to read %s\n", fixture_path.c_str());
+    }
+    else
+    {
+        std::printf("ISA disassembly: %zu bytes, %zu lines\n", isa.size(), static_cast<size_t>(std::count(isa.begin(), isa.end(), '\n')));
+
+        // The code size scan: both scanners must find the same code size.
+        unsigned     regex_size   = 0;
+        unsigned     scanner_size = 0;
+        const double regex_time   = TimeScanner(ParseForSizeWithRegex, isa, regex_size);
+        const double scanner_time = TimeScanner(ParseForSizeWithScanner, isa, scanner_size);
+        PrintComparison("Code size scan (ParseForSize):", regex_time, scanner_time, isa.size());
+
+        // The instruction scan: the regex-based scan only finds the encodings, while the string_view parse
+        // also decodes the instructions and builds the program graph. Both must find the same instructions.
+        unsigned     regex_count        = 0;
+        unsigned     scanner_count      = 0;
+        const double regex_scan_time    = TimeScanner(ScanEncodingsWithRegex, isa, regex_count);
+        const double scanner_parse_time = TimeScanner(ParseWithScanner, isa, scanner_count);
+        PrintComparison("Instruction scan vs. full parse:", regex_scan_time, scanner_parse_time, isa.size());
+
+        if (regex_size != scanner_size || regex_count != scanner_count)
+        {
+            std::printf("The scanners disagree: code size %u vs. %u, instruction count %u vs. %u\n",
+                        regex_size,
+                        scanner_size,
+                        regex_count,
+                        scanner_count);
+            ret = false;
+        }
+    }
+
+    return (ret ? EXIT_SUCCESS : EXIT_FAILURE);
+}
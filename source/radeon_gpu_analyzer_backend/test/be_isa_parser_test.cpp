@@ -0,0 +1,156 @@
+//=============================================================================
+/// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Test that parses ISA disassembly with LF and with CRLF line breaks and compares the results.
+//=============================================================================
+
+// C++.
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+// Local.
+#include "emulator/parser/be_isa_parser.h"
+
+// The ISA disassembly samples, and the number of instructions, labels and branches that the parser reads from each of them.
+struct Fixture
+{
+    const char* file_name;
+    const char* device;
+    size_t      instruction_count;
+    size_t      label_count;
+    size_t      branch_count;
+};
+
+static const Fixture kFixtures[] = {{"reduce_gfx1030.isa", "gfx1030", 24, 2, 2}};
+
+// Read the whole file into the given text.
+static bool ReadFile(const std::string& file_path, std::string& text)
+{
+    std::ifstream     file(file_path, std::ios::binary);
+    std::stringstream file_text;
+    file_text << file.rdbuf();
+    text = file_text.str();
+    return file.good() && !text.empty();
+}
+
+// Replace the LF line breaks of the text with CRLF line breaks.
+static std::string ToCrlf(const std::string& text)
+{
+    std::string ret;
+    ret.reserve(text.size() + text.size() / 32);
+    for (char c : text)
+    {
+        if (c == '\n')
+        {
+            ret.push_back('\r');
+        }
+        ret.push_back(c);
+    }
+    return ret;
+}
+
+// Counts of the parsed instructions.
+struct ParseResults
+{
+    size_t instruction_count = 0;
+    size_t label_count       = 0;
+    size_t branch_count      = 0;
+};
+
+// Parse the text and print everything that the parser extracted: the fields, the source line and the CSV row of every instruction,
+// the code length and the cycle estimate, which depends on the program graph that the labels and branches form.
+static bool ParseAndDump(const std::string& text, const std::string& device, bool is_hsail_tokens_implied, std::string& dump, ParseResults& results)
+{
+    ParserIsa parser;
+    bool      ret = parser.Parse(std::string_view(text), is_hsail_tokens_implied);
+    if (ret)
+    {
+        std::stringstream out;
+        for (const Instruction* instruction : parser.GetInstructions())
+        {
+            out << instruction->GetLabel() << "|" << instruction->GetGotoLabel() << "|" << instruction->GetLineNumber() << "|"
+                << instruction->GetPointingLabelString() << "|" << instruction->GetInstructionOpCode() << "|"
+                << instruction->GetInstructionParameters() << "|" << instruction->GetInstructionBinaryRep() << "|"
+                << instruction->GetInstructionOffset() << "|" << instruction->GetSrcLineInfo().second << "|";
+            std::string csv_row;
+            instruction->AppendCsvString(device, true, csv_row);
+            out << csv_row << std::endl;
+
+            results.instruction_count++;
+            results.label_count += (instruction->GetLabel() != kNoLabel ? 1 : 0);
+            results.branch_count += (instruction->GetGotoLabel() != kNoLabel ? 1 : 0);
+        }
+
+        ISAProgramGraph::CycleEstimate estimate;
+        parser.GetCycleEstimate(estimate);
+        out << "cycles " << estimate.min_cycles << " " << estimate.typical_cycles << " " << estimate.max_cycles << std::endl;
+
+        ParserIsa size_parser;
+        size_parser.ParseForSize(text);
+        out << "code length " << size_parser.GetCodeLength() << std::endl;
+        dump = out.str();
+    }
+    return ret;
+}
+
+// Usage: be_isa_parser_test [fixtures directory]
+int main(int argc, char* argv[])
+{
+    const std::string fixtures_dir = (argc > 1 ? argv[1] : RGA_ISA_PARSER_TEST_FIXTURES_DIR);
+    bool              ret          = true;
+
+    for (const Fixture& fixture : kFixtures)
+    {
+        const std::string fixture_path = fixtures_dir + "/" + fixture.file_name;
+        std::string       lf_text;
+        if (!ReadFile(fixture_path, lf_text) || lf_text.find('\r') != std::string::npos)
+        {
+            std::printf("Failed to read %s, or it does not have LF line breaks\n", fixture_path.c_str());
+            ret = false;
+            continue;
+        }
+        const std::string crlf_text = ToCrlf(lf_text);
+
+        // The CLI parses the per-kernel disassembly files with the HSAIL tokens implied, other callers do not.
+        for (bool is_hsail_tokens_implied : {false, true})
+        {
+            std::string  lf_dump;
+            std::string  crlf_dump;
+            ParseResults lf_results;
+            ParseResults crlf_results;
+            if (!ParseAndDump(lf_text, fixture.device, is_hsail_tokens_implied, lf_dump, lf_results) ||
+                !ParseAndDump(crlf_text, fixture.device, is_hsail_tokens_implied, crlf_dump, crlf_results))
+            {
+                std::printf("Failed to parse %s (HSAIL tokens implied: %d)\n", fixture_path.c_str(), is_hsail_tokens_implied);
+                ret = false;
+            }
+            else if (lf_results.instruction_count != fixture.instruction_count || lf_results.label_count != fixture.label_count ||
+                     lf_results.branch_count != fixture.branch_count)
+            {
+                std::printf("Unexpected parse of %s (HSAIL tokens implied: %d): %zu instructions, %zu labels, %zu branches\n",
+                            fixture_path.c_str(),
+                            is_hsail_tokens_implied,
+                            lf_results.instruction_count,
+                            lf_results.label_count,
+                            lf_results.branch_count);
+                ret = false;
+            }
+            else if (crlf_dump != lf_dump || crlf_dump.find('\r') != std::string::npos)
+            {
+                std::printf("The CRLF parse of %s (HSAIL tokens implied: %d) differs from the LF parse:\nLF:\n%s\nCRLF:\n%s\n",
+                            fixture_path.c_str(),
+                            is_hsail_tokens_implied,
+                            lf_dump.c_str(),
+                            crlf_dump.c_str());
+                ret = false;
+            }
+        }
+    }
+
+    std::printf("%s\n", (ret ? "The LF and CRLF parses match." : "The LF and CRLF parses do not match."));
+    return (ret ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,229 @@
+//=============================================================================
+/// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Test that compares the streaming and YAML DOM readers of the code object metadata parser.
+//=============================================================================
+
+// C++.
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Local.
+#include "radeon_gpu_analyzer_backend/be_metadata_parser.h"
+
+// A sample amdgpu-dis output that the random edits start from, and the status of reading it.
+struct Fixture
+{
+    const char*    file_name;
+    beKA::beStatus status;
+};
+
+static const Fixture kFixtures[] = {{"graphics_pipeline.txt", beKA::beStatus::kBeStatusGraphicsCodeObjMetaDataSuccess},
+                                    {"ray_tracing_pipeline.txt", beKA::beStatus::kBeStatusRayTracingCodeObjMetaDataSuccess}};
+
+// The number of random edits of each sample.
+static const int kEditCountPerFixture = 40000;
+
+// The values and lines that the random edits write. They cover the number formats, value kinds and YAML
+// constructs that the streaming reader rejects, as well as keys that it reads.
+static const char* kEditTokens[] = {"0x10", "010", "12", "-1", "~", "[ ]", "{ }", ".cs", ".zz", ".vertex", "Miss", "  .extra: 1", ".api: X",
+                                    "amdhsa.kernels: 1", "lgc.shader.CS.main:", "  - .cs", "\"0x20\"", "0x", "99999999999999999999", "*a", "&a 5",
+                                    "? [a]", ".shader_functions:", ".shaders: ~", ".hardware_mapping: []", "1 # c"};
+
+// Print the parse status and all of the parsed metadata.
+static std::string DumpPipeline(beKA::beStatus status, const BeAmdPalMetaData::PipelineMetaData& pipeline)
+{
+    std::stringstream out;
+    auto              dump_stats = [&out](const beKA::AnalysisData& stats) {
+        out << stats.scratch_memory_used << "," << stats.wavefront_size << "," << stats.num_gprs_used << "," << stats.lds_size_used << ","
+            << stats.stack_size_used << "," << stats.num_sgprs_available << "," << stats.num_sgprs_used << "," << stats.num_vgprs_available << ","
+            << stats.num_vgprs_used << std::endl;
+    };
+
+    out << static_cast<int>(status) << " api=" << pipeline.api << std::endl;
+    for (const BeAmdPalMetaData::HardwareStageMetaData& stage : pipeline.hardware_stages)
+    {
+        out << "stage " << static_cast<int>(stage.stage_type) << " ";
+        dump_stats(stage.stats);
+    }
+    for (const BeAmdPalMetaData::ShaderFunctionMetaData& function : pipeline.shader_functions)
+    {
+        out << "function " << function.name << " " << static_cast<int>(function.shader_subtype) << " ";
+        dump_stats(function.stats);
+    }
+    for (const BeAmdPalMetaData::ShaderMetaData& shader : pipeline.shaders)
+    {
+        out << "shader " << static_cast<int>(shader.shader_type) << " " << static_cast<int>(shader.hardware_mapping) << " "
+            << static_cast<int>(shader.shader_subtype) << std::endl;
+    }
+    return out.str();
+}
+
+// Split the given text into lines.
+static std::vector<std::string> SplitLines(const std::string& text)
+{
+    std::vector<std::string> lines;
+    std::stringstream        stream(text);
+    std::string              line;
+    while (std::getline(stream, line))
+    {
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+// Join the given lines into text.
+static std::string JoinLines(const std::vector<std::string>& lines)
+{
+    std::string text;
+    for (const std::string& line : lines)
+    {
+        text += line;
+        text += '\n';
+    }
+    return text;
+}
+
+// Counts of the compared inputs.
+struct CompareResults
+{
+    int input_count     = 0;
+    int streaming_count = 0;
+    int dom_only_count  = 0;
+    int mismatch_count  = 0;
+};
+
+// Parse the given text with both readers and with the combined entry point.
+// When the streaming reader succeeds, its metadata must match the DOM reader's metadata.
+// The combined entry point must always produce the status and metadata of the DOM reader.
+static bool CompareReaders(const std::string& text, CompareResults& results)
+{
+    BeAmdPalMetaData::PipelineMetaData dom_pipeline;
+    BeAmdPalMetaData::PipelineMetaData streaming_pipeline;
+    BeAmdPalMetaData::PipelineMetaData combined_pipeline;
+    beKA::beStatus                     dom_status       = BeAmdPalMetaData::ParseAmdgpudisMetadataDom(text, dom_pipeline);
+    beKA::beStatus                     streaming_status = BeAmdPalMetaData::ParseAmdgpudisMetadataStreaming(text, streaming_pipeline);
+    beKA::beStatus                     combined_status  = BeAmdPalMetaData::ParseAmdgpudisMetadata(text, combined_pipeline);
+
+    const std::string dom_dump = DumpPipeline(dom_status, dom_pipeline);
+    bool              ret      = (DumpPipeline(combined_status, combined_pipeline) == dom_dump);
+    if (streaming_status != beKA::beStatus::kBeStatusCodeObjMdParsingFailed)
+    {
+        results.streaming_count++;
+        ret = ret && (DumpPipeline(streaming_status, streaming_pipeline) == dom_dump);
+    }
+    else if (dom_status != beKA::beStatus::kBeStatusCodeObjMdParsingFailed)
+    {
+        results.dom_only_count++;
+    }
+
+    results.input_count++;
+    if (!ret)
+    {
+        results.mismatch_count++;
+        std::printf("Mismatch for input:\n%s\nDOM reader:\n%sStreaming reader:\n%sCombined:\n%s\n",
+                    text.c_str(),
+                    dom_dump.c_str(),
+                    DumpPipeline(streaming_status, streaming_pipeline).c_str(),
+                    DumpPipeline(combined_status, combined_pipeline).c_str());
+    }
+    return ret;
+}
+
+// Usage: be_metadata_parser_test [fixtures directory] [random seed]
+int main(int argc, char* argv[])
+{
+    const std::string fixtures_dir = (argc > 1 ? argv[1] : RGA_METADATA_PARSER_TEST_FIXTURES_DIR);
+    const unsigned    seed         = (argc > 2 ? static_cast<unsigned>(std::strtoul(argv[2], nullptr, 10)) : 1);
+    std::mt19937      random(seed);
+    CompareResults    results;
+    bool              ret = true;
+
+    for (const Fixture& fixture : kFixtures)
+    {
+        const std::string fixture_path = fixtures_dir + "/" + fixture.file_name;
+        std::ifstream     fixture_file(fixture_path);
+        std::stringstream fixture_text;
+        fixture_text << fixture_file.rdbuf();
+        if (!fixture_file || fixture_text.str().empty())
+        {
+            std::printf("Failed to read %s\n", fixture_path.c_str());
+            ret = false;
+            continue;
+        }
+
+        // The unmodified sample must be read by the streaming reader.
+        BeAmdPalMetaData::PipelineMetaData pipeline;
+        if (BeAmdPalMetaData::ParseAmdgpudisMetadataStreaming(fixture_text.str(), pipeline) != fixture.status)
+        {
+            std::printf("The streaming reader failed to read %s\n", fixture_path.c_str());
+            ret = false;
+        }
+        ret = CompareReaders(fixture_text.str(), results) && ret;
+
+        // Apply a few random line edits to the sample and compare the readers on the result.
+        const std::vector<std::string> fixture_lines = SplitLines(fixture_text.str());
+        const size_t                   token_count   = sizeof(kEditTokens) / sizeof(kEditTokens[0]);
+        for (int i = 0; i < kEditCountPerFixture; i++)
+        {
+            std::vector<std::string> lines      = fixture_lines;
+            const unsigned           edit_count = 1 + random() % 3;
+            for (unsigned j = 0; j < edit_count && !lines.empty(); j++)
+            {
+                const size_t line_index = random() % lines.size();
+                switch (random() % 5)
+                {
+                case 0:
+                    // Remove a line.
+                    lines.erase(lines.begin() + line_index);
+                    break;
+                case 1:
+                {
+                    // Duplicate a line at another position.
+                    const std::string line = lines[random() % lines.size()];
+                    lines.insert(lines.begin() + line_index, line);
+                    break;
+                }
+                case 2:
+                {
+                    // Replace the value of a key.
+                    const size_t colon_pos = lines[line_index].find(':');
+                    if (colon_pos != std::string::npos)
+                    {
+                        lines[line_index] = lines[line_index].substr(0, colon_pos + 1) + " " + kEditTokens[random() % token_count];
+                    }
+                    break;
+                }
+                case 3:
+                {
+                    // Replace a line, keeping its indentation.
+                    const size_t text_pos = lines[line_index].find_first_not_of(' ');
+                    if (text_pos != std::string::npos)
+                    {
+                        lines[line_index] = lines[line_index].substr(0, text_pos) + kEditTokens[random() % token_count];
+                    }
+                    break;
+                }
+                default:
+                    // Swap two lines.
+                    std::swap(lines[line_index], lines[random() % lines.size()]);
+                    break;
+                }
+            }
+            ret = CompareReaders(JoinLines(lines), results) && ret;
+        }
+    }
+
+    std::printf("Compared %d inputs: %d read by the streaming reader, %d read only by the DOM reader, %d mismatches.\n",
+                results.input_count,
+                results.streaming_count,
+                results.dom_only_count,
+                results.mismatch_count);
+    return (ret ? EXIT_SUCCESS : EXIT_FAILURE);
+}
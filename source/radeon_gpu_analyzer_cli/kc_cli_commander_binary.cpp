@@ -8,6 +8,8 @@
 // C++.
 #include <filesystem>
 #include <string>
+#include <utility>
+#include <vector>
 
 // Shared.
 #include "common/rga_cli_defs.h"
@@ -21,6 +23,8 @@
 // Local.
 #include "radeon_gpu_analyzer_cli/kc_cli_commander_binary.h"
 #include "radeon_gpu_analyzer_cli/kc_cli_string_constants.h"
+#include "radeon_gpu_analyzer_cli/kc_compilation_cache.h"
+#include "radeon_gpu_analyzer_cli/kc_job_pool.h"
 #include "radeon_gpu_analyzer_cli/kc_xml_writer.h"
 
 const char kMultipleBinaryFolderNumberWildcardToken = '*';
@@ -65,39 +69,129 @@ void KcCliCommanderBinary::RunCompileCommands(const Config& config, LoggingCallb
     beKA::beStatus        status = GetSupportedTargets(devices);
     if (status == beKA::beStatus::kBeStatusSuccess)
     {
+        // Identify the unique input binaries. Binaries are identified by their content, so that a binary
+        // that is given more than once, under any name, is only analyzed once.
+        std::vector<size_t>           unique_inputs;
+        std::vector<Config>           unique_configs;
+        std::map<std::string, size_t> content_to_input;
+        size_t                        duplicate_count = 0;
         for (size_t i = 0; i < config.input_files.size(); i++)
         {
-            Config             config_updated  = create_updated_config_for_binary(config, i);
-            const auto&        input_file_name = config.input_files[i];
-            const std::string& bin_file_name   = KcUtils::Quote(input_file_name);
-            auto               found           = binary_file_to_binary_analysis_map_.find(bin_file_name);
-            if (found == binary_file_to_binary_analysis_map_.end())
+            const std::string& input_file_name = config.input_files[i];
+            const std::string  bin_file_name   = KcUtils::Quote(input_file_name);
+
+            // Binaries that cannot be read are identified by their name, and fail their validation.
+            KcCompilationCacheKey content_key("binary-content");
+            const std::string     content_id = content_key.AddFile(input_file_name) ? content_key.ToString() : bin_file_name;
+
+            auto found = content_to_input.find(content_id);
+            if (found != content_to_input.end() || binary_file_to_binary_analysis_map_.count(bin_file_name) > 0)
             {
-                status = IsBinaryInputValid(config_updated, verbose, bin_file_name);
-                std::string amdgpu_dis_stdout;
-                std::string amdgpu_dis_stderr;
-                if (status == beKA::beStatus::kBeStatusSuccess)
+                if (found != content_to_input.end() && bin_file_name != KcUtils::Quote(config.input_files[found->second]))
                 {
-                    status = DisassembleBinary(bin_file_name, verbose, amdgpu_dis_stdout, amdgpu_dis_stderr);
-                    assert(status == beKA::beStatus::kBeStatusSuccess);
+                    RgLog::stdOut << kStrInfoBinDuplicateSkipped << KcUtils::Quote(config.input_files[found->second]) << ": " << bin_file_name << std::endl;
                 }
+                duplicate_count++;
+            }
+            else
+            {
+                content_to_input[content_id] = i;
+                unique_inputs.push_back(i);
+
+                // Create the output folders of all binaries up front, before the binaries are analyzed concurrently.
+                unique_configs.push_back(create_updated_config_for_binary(config, i));
+            }
+        }
+
+        // Analyze the binaries on up to config.jobs threads. When binaries are analyzed concurrently,
+        // the analyses of each binary run sequentially, so that the number of threads stays bounded.
+        const bool is_parallel = KcJobPool::ResolveWorkerCount(config.jobs, unique_inputs.size()) > 1;
+        if (is_parallel)
+        {
+            for (Config& config_updated : unique_configs)
+            {
+                config_updated.jobs = 1;
+            }
+        }
+
+        std::vector<std::unique_ptr<KcCliBinaryAnalysis>> analyses(unique_inputs.size());
+        std::vector<beKA::beStatus>                       binary_status(unique_inputs.size(), beKA::beStatus::kBeStatusGeneralFailed);
+        KcJobPool::Run(unique_inputs.size(), config.jobs, [&](size_t job_index) {
+            binary_status[job_index] =
+                AnalyzeBinary(unique_configs[job_index], verbose, devices, config.input_files[unique_inputs[job_index]], log_callback, analyses[job_index]);
+        });
+
+        // Collect the analyses of the binaries, and summarize the results.
+        size_t success_count = 0;
+        for (size_t i = 0; i < unique_inputs.size(); i++)
+        {
+            if (analyses[i] != nullptr)
+            {
+                binary_file_to_binary_analysis_map_[KcUtils::Quote(config.input_files[unique_inputs[i]])] = std::move(*analyses[i]);
+            }
+            if (binary_status[i] == beKA::beStatus::kBeStatusSuccess)
+            {
+                success_count++;
+            }
+        }
 
-                if (status == beKA::beStatus::kBeStatusSuccess)
+        if (config.input_files.size() > 1)
+        {
+            RgLog::stdOut << kStrInfoBinSummaryAnalyzed << config.input_files.size() << kStrInfoBinSummaryCodeObjects << success_count
+                          << kStrInfoBinSummarySucceeded << (unique_inputs.size() - success_count) << kStrInfoBinSummaryFailed << duplicate_count
+                          << kStrInfoBinSummaryDuplicates << std::endl;
+            for (size_t i = 0; i < unique_inputs.size(); i++)
+            {
+                if (binary_status[i] != beKA::beStatus::kBeStatusSuccess)
                 {
-                    std::set<std::string> matched_devices;
-                    status = InitRequestedAsicBinary(config_updated, verbose, devices, bin_file_name, amdgpu_dis_stdout, matched_devices);
-                    if (status == beKA::beStatus::kBeStatusSuccess && matched_devices.size() == 1)
-                    {
-                        std::vector<std::string> asics(matched_devices.begin(), matched_devices.end());
-                        binary_file_to_binary_analysis_map_[bin_file_name] = KcCliBinaryAnalysis{asics[0], bin_file_name, log_callback};
-                        status = binary_file_to_binary_analysis_map_[bin_file_name].AnalyzeCodeObject(config_updated, amdgpu_dis_stdout);
-                    }
+                    RgLog::stdOut << kStrInfoBinSummaryFailedFile << KcUtils::Quote(config.input_files[unique_inputs[i]]) << std::endl;
                 }
             }
         }
     }
 }
 
+beKA::beStatus KcCliCommanderBinary::AnalyzeBinary(const Config&                         config,
+                                                   bool                                  verbose,
+                                                   const std::set<std::string>&          supported_devices,
+                                                   const std::string&                    input_file_name,
+                                                   LoggingCallbackFunction               log_callback,
+                                                   std::unique_ptr<KcCliBinaryAnalysis>& analysis)
+{
+    const std::string bin_file_name = KcUtils::Quote(input_file_name);
+    beKA::beStatus    status        = IsBinaryInputValid(config, verbose, bin_file_name);
+    std::string       amdgpu_dis_stdout;
+    std::string       amdgpu_dis_stderr;
+    if (status == beKA::beStatus::kBeStatusSuccess)
+    {
+        // Fetch the disassembly from the compilation cache, or disassemble the binary.
+        KcCompilationCacheKey cache_key("amdgpu-dis");
+        const bool            is_cacheable = KcCompilationCache::IsEnabled() && cache_key.AddFile(input_file_name);
+        if (!is_cacheable || !KcCompilationCache::FetchText(cache_key, amdgpu_dis_stdout))
+        {
+            status = DisassembleBinary(bin_file_name, verbose, amdgpu_dis_stdout, amdgpu_dis_stderr);
+            assert(status == beKA::beStatus::kBeStatusSuccess);
+            if (is_cacheable && status == beKA::beStatus::kBeStatusSuccess)
+            {
+                KcCompilationCache::StoreText(cache_key, amdgpu_dis_stdout);
+            }
+        }
+    }
+
+    if (status == beKA::beStatus::kBeStatusSuccess)
+    {
+        std::set<std::string> matched_devices;
+        status = InitRequestedAsicBinary(config, verbose, supported_devices, bin_file_name, amdgpu_dis_stdout, matched_devices);
+        if (status == beKA::beStatus::kBeStatusSuccess && matched_devices.size() == 1)
+        {
+            analysis = std::make_unique<KcCliBinaryAnalysis>(*matched_devices.begin(), bin_file_name, log_callback);
+            status   = analysis->AnalyzeCodeObject(config, amdgpu_dis_stdout);
+        }
+    }
+
+    return status;
+}
+
 bool KcCliCommanderBinary::RunPostCompileSteps(const Config& config)
 {
     bool ret = !config.session_metadata_file.empty();
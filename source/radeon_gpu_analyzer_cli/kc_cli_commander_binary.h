@@ -45,6 +45,15 @@ private:
     // Extract target device from ISA disassembly.
     static bool ExtractDeviceFromAmdgpudisOutput(const std::string& amdgpu_dis_output, std::string& device);
 
+    // Validate, disassemble and analyze a single input binary. Sets "analysis" once the target device of the binary is identified.
+    // Can be called concurrently for different binaries.
+    beKA::beStatus AnalyzeBinary(const Config&                         config,
+                                 bool                                  verbose,
+                                 const std::set<std::string>&          supported_devices,
+                                 const std::string&                    input_file_name,
+                                 LoggingCallbackFunction               log_callback,
+                                 std::unique_ptr<KcCliBinaryAnalysis>& analysis);
+
     // Identify the devices requested by user.
     beKA::beStatus InitRequestedAsicBinary(const Config&                config,
                                            bool                         verbose,
@@ -30,6 +30,7 @@
 #include "radeon_gpu_analyzer_cli/kc_xml_writer.h"
 #include "radeon_gpu_analyzer_cli/kc_utils_lightning.h"
 #include "radeon_gpu_analyzer_cli/kc_cli_commander_lightning.h"
+#include "radeon_gpu_analyzer_cli/kc_job_pool.h"
 #include "radeon_gpu_analyzer_cli/kc_statistics_device_props.h"
 
 // Backend.
@@ -372,40 +373,84 @@ beKA::beStatus KcCLICommanderLightning::CompileOpenCL(const Config& config, cons
 {
     beKA::beStatus status = beKA::beStatus::kBeStatusSuccess;
 
-    // Run LC compiler for all requested devices
-    for (const std::string& device : ocl_options.selected_devices)
-    {
-        std::string  error_text;
-        LogPreStep(kStrInfoCompiling, device);
-        std::string  bin_filename;
+    // Run LC compiler for all requested devices.
+    // Each device runs its own compile + disassemble pipeline, and up to config.jobs devices are processed concurrently.
+    // All pipelines share the RGA temp folder: temp file names are reserved per process, so concurrent jobs never collide.
+    const std::vector<std::string> devices(ocl_options.selected_devices.cbegin(), ocl_options.selected_devices.cend());
+    std::vector<beKA::beStatus>    device_status(devices.size(), beKA::beStatus::kBeStatusSuccess);
 
-        // Adjust the device name if necessary.
-        std::string clang_device = device;
-        if (kLcDeviceInfoToClangDeviceMap.count(clang_device) > 0)
+    // Prepare the compilation cache key of the sources. The compiler diagnostics are not cached,
+    // so builds that dump the IL or print the warnings always invoke the compiler.
+    source_cache_key_.reset();
+    if (KcCompilationCache::IsEnabled() && !ocl_options.should_dump_il && !config.is_warnings_required)
+    {
+        source_cache_key_ = std::make_unique<KcCompilationCacheKey>("opencl-binary");
+        if (!KcUtilsLightning::AddCompilerToCacheKey(compiler_paths_.bin, should_print_cmd_, *source_cache_key_) ||
+            !KcUtilsLightning::AddSourcesToCacheKey(config, compiler_paths_, *source_cache_key_))
         {
-            clang_device = kLcDeviceInfoToClangDeviceMap.at(device);
+            source_cache_key_.reset();
         }
+    }
 
-        // Update the binary and ISA names for current device.
-        beKA::beStatus current_status = AdjustBinaryFileName(config, device, bin_filename);
+    KcJobPool::Run(devices.size(), config.jobs, [&](size_t device_index) {
+        device_status[device_index] = CompileOpenCLForDevice(config, ocl_options, devices[device_index]);
+    });
 
-        // If file with the same name exist, delete it.
-        KcUtils::DeleteFile(bin_filename);
+    // Report the status of the last failed device, as for a sequential build.
+    for (beKA::beStatus current_status : device_status)
+    {
+        status = (current_status == beKA::beStatus::kBeStatusSuccess ? status : current_status);
+    }
 
-        // Prepare a list of source files.
-        std::vector<std::string>  src_filenames;
-        for (const std::string& input_file : config.input_files)
-        {
-            src_filenames.push_back(input_file);
-        }
+    return status;
+}
 
-        if (current_status != beKA::beStatus::kBeStatusSuccess)
-        {
-            KcUtilsLightning::LogErrorStatus(current_status, error_text);
-            continue;
-        }
+beKA::beStatus KcCLICommanderLightning::CompileOpenCLForDevice(const Config& config, const OpenCLOptions& ocl_options, const std::string& device)
+{
+    std::string  error_text;
+    LogPreStep(kStrInfoCompiling, device);
+    std::string  bin_filename;
+
+    // Adjust the device name if necessary.
+    std::string clang_device = device;
+    if (kLcDeviceInfoToClangDeviceMap.count(clang_device) > 0)
+    {
+        clang_device = kLcDeviceInfoToClangDeviceMap.at(device);
+    }
+
+    // Update the binary and ISA names for current device.
+    beKA::beStatus current_status = AdjustBinaryFileName(config, device, bin_filename);
 
-        // Compile source to binary.
+    // If file with the same name exist, delete it.
+    KcUtils::DeleteFile(bin_filename);
+
+    // Prepare a list of source files.
+    std::vector<std::string>  src_filenames;
+    for (const std::string& input_file : config.input_files)
+    {
+        src_filenames.push_back(input_file);
+    }
+
+    if (current_status != beKA::beStatus::kBeStatusSuccess)
+    {
+        // The failure is reported, but (as before) it does not fail the whole build.
+        KcUtilsLightning::LogErrorStatus(current_status, error_text);
+        return beKA::beStatus::kBeStatusSuccess;
+    }
+
+    // Fetch the binary from the compilation cache, or compile source to binary.
+    std::unique_ptr<KcCompilationCacheKey> cache_key;
+    if (source_cache_key_ != nullptr)
+    {
+        cache_key = std::make_unique<KcCompilationCacheKey>(*source_cache_key_);
+        cache_key->AddText(clang_device);
+    }
+    if (cache_key != nullptr && KcCompilationCache::FetchFiles(*cache_key, {bin_filename}))
+    {
+        current_status = beKA::beStatus::kBeStatusSuccess;
+    }
+    else
+    {
         current_status = BeProgramBuilderLightning::CompileOpenCLToBinary(compiler_paths_,
                                                                          ocl_options,
                                                                          src_filenames,
@@ -413,66 +458,73 @@ beKA::beStatus KcCLICommanderLightning::CompileOpenCL(const Config& config, cons
                                                                          clang_device,
                                                                          should_print_cmd_,
                                                                          error_text);
-        LogResult(current_status == beKA::beStatus::kBeStatusSuccess);
+        if (cache_key != nullptr && current_status == beKA::beStatus::kBeStatusSuccess)
+        {
+            KcCompilationCache::StoreFiles(*cache_key, {bin_filename});
+        }
+    }
+    LogResult(current_status == beKA::beStatus::kBeStatusSuccess);
 
-        if (current_status == beKA::beStatus::kBeStatusSuccess)
+    if (current_status == beKA::beStatus::kBeStatusSuccess)
+    {
+        // If "dump IL" option is passed to the Lightning Compiler, it should dump the IL to stderr.
+        if (ocl_options.should_dump_il)
         {
-            // If "dump IL" option is passed to the Lightning Compiler, it should dump the IL to stderr.
-            if (ocl_options.should_dump_il)
-            {
-                current_status = DumpIL(config, ocl_options, src_filenames, device, clang_device, error_text);
-            }
-            else if (config.is_warnings_required)
-            {
-                // Pass the warnings printed by the compiler to RGA stderr.
-                DumpCompilerWarnings(error_text);
-            }
+            current_status = DumpIL(config, ocl_options, src_filenames, device, clang_device, error_text);
+        }
+        else if (config.is_warnings_required)
+        {
+            // Pass the warnings printed by the compiler to RGA stderr.
+            DumpCompilerWarnings(error_text);
+        }
 
-            // Disassemble binary to ISA text.
-            if (!config.isa_file.empty() ||
-                !config.analysis_file.empty() ||
-                !config.livereg_analysis_file.empty() || 
-                !config.sgpr_livereg_analysis_file.empty() || 
-                !config.block_cfg_file.empty() ||
-                !config.inst_cfg_file.empty())
-            {
-                LogPreStep(kStrInfoExtractingIsaForDevice, device);
-                current_status = DisassembleBinary(bin_filename, config.isa_file, clang_device, device, config.function, config.is_line_numbers_required, error_text);
-                LogResult(current_status == beKA::beStatus::kBeStatusSuccess);
+        // Disassemble binary to ISA text.
+        if (!config.isa_file.empty() ||
+            !config.analysis_file.empty() ||
+            !config.livereg_analysis_file.empty() || 
+            !config.sgpr_livereg_analysis_file.empty() || 
+            !config.block_cfg_file.empty() ||
+            !config.inst_cfg_file.empty() ||
+            !config.cycle_estimate_file.empty())
+        {
+            LogPreStep(kStrInfoExtractingIsaForDevice, device);
+            current_status = DisassembleBinary(bin_filename, config.isa_file, clang_device, device, config.function, config.is_line_numbers_required, error_text);
+            LogResult(current_status == beKA::beStatus::kBeStatusSuccess);
 
-                assert(current_status == beKA::beStatus::kBeStatusSuccess);
-                // Propagate the binary file name to the Output Files Metadata table.
-                if (current_status == beKA::beStatus::kBeStatusSuccess)
+            assert(current_status == beKA::beStatus::kBeStatusSuccess);
+            // Propagate the binary file name to the Output Files Metadata table.
+            if (current_status == beKA::beStatus::kBeStatusSuccess)
+            {
+                std::lock_guard<std::mutex> lock(output_md_lock_);
+                for (auto& output_md_node : output_metadata_)
                 {
-                    for (auto& output_md_node : output_metadata_)
+                    const std::string& md_device = output_md_node.first.first;
+                    if (md_device == device)
                     {
-                        const std::string& md_device = output_md_node.first.first;
-                        if (md_device == device)
-                        {
-                            output_md_node.second.bin_file = bin_filename;
-                            output_md_node.second.is_bin_file_temp = config.binary_output_file.empty();
-                        }
+                        output_md_node.second.bin_file = bin_filename;
+                        output_md_node.second.is_bin_file_temp = config.binary_output_file.empty();
                     }
                 }
             }
-            else
-            {
-                output_metadata_[{device, ""}] = RgOutputFiles(RgaEntryType::kOpenclKernel, "", bin_filename);
-            }
         }
         else
         {
-            // Store error status to the metadata.
-            RgOutputFiles output(RgaEntryType::kOpenclKernel, "", "");
-            output.status = false;
-            output_metadata_[{device, ""}] = output;
+            std::lock_guard<std::mutex> lock(output_md_lock_);
+            output_metadata_[{device, ""}] = RgOutputFiles(RgaEntryType::kOpenclKernel, "", bin_filename);
         }
-
-        status = (current_status == beKA::beStatus::kBeStatusSuccess ? status : current_status);
-        KcUtilsLightning::LogErrorStatus(current_status, error_text);
+    }
+    else
+    {
+        // Store error status to the metadata.
+        RgOutputFiles output(RgaEntryType::kOpenclKernel, "", "");
+        output.status = false;
+        std::lock_guard<std::mutex> lock(output_md_lock_);
+        output_metadata_[{device, ""}] = output;
     }
 
-    return status;
+    KcUtilsLightning::LogErrorStatus(current_status, error_text);
+
+    return current_status;
 }
 
 beKA::beStatus KcCLICommanderLightning::DisassembleBinary(const std::string& binFileName,
@@ -485,19 +537,59 @@ beKA::beStatus KcCLICommanderLightning::DisassembleBinary(const std::string& bin
 {
     std::string  out_isa_text;
     std::vector<std::string>  kernel_names;
-    beKA::beStatus status = BeProgramBuilderLightning::DisassembleBinary(compiler_paths_.bin, binFileName,
-        clangDevice, lineNumbers, should_print_cmd_, out_isa_text, error_text);
+
+    // The disassembly and the kernel names are cached by the contents of the binary.
+    KcCompilationCacheKey isa_cache_key("opencl-objdump");
+    const bool is_cacheable = KcCompilationCache::IsEnabled() &&
+                              KcUtilsLightning::AddCompilerToCacheKey(compiler_paths_.bin, should_print_cmd_, isa_cache_key) &&
+                              isa_cache_key.AddFile(binFileName);
+    KcCompilationCacheKey kernel_names_cache_key = isa_cache_key;
+    isa_cache_key.AddText(clangDevice);
+    isa_cache_key.AddText(lineNumbers ? "line-numbers" : "");
+    kernel_names_cache_key.AddText("kernel-names");
+
+    beKA::beStatus status = beKA::kBeStatusSuccess;
+    if (!is_cacheable || !KcCompilationCache::FetchText(isa_cache_key, out_isa_text))
+    {
+        status = BeProgramBuilderLightning::DisassembleBinary(compiler_paths_.bin, binFileName,
+            clangDevice, lineNumbers, should_print_cmd_, out_isa_text, error_text);
+        if (is_cacheable && status == beKA::kBeStatusSuccess)
+        {
+            KcCompilationCache::StoreText(isa_cache_key, out_isa_text);
+        }
+    }
 
     if (status == beKA::kBeStatusSuccess)
     {
-        status = BeProgramBuilderLightning::ExtractKernelNames(compiler_paths_.bin, binFileName,
-            should_print_cmd_, kernel_names);
+        std::string kernel_names_text;
+        if (is_cacheable && KcCompilationCache::FetchText(kernel_names_cache_key, kernel_names_text))
+        {
+            std::istringstream kernel_names_stream(kernel_names_text);
+            for (std::string kernel_name; std::getline(kernel_names_stream, kernel_name);)
+            {
+                kernel_names.push_back(kernel_name);
+            }
+        }
+        else
+        {
+            status = BeProgramBuilderLightning::ExtractKernelNames(compiler_paths_.bin, binFileName,
+                should_print_cmd_, kernel_names);
+            if (is_cacheable && status == beKA::kBeStatusSuccess)
+            {
+                for (const std::string& kernel_name : kernel_names)
+                {
+                    kernel_names_text += kernel_name + "\n";
+                }
+                KcCompilationCache::StoreText(kernel_names_cache_key, kernel_names_text);
+            }
+        }
     }
     else
     {
         // Store error status to the metadata.
         RgOutputFiles output(RgaEntryType::kOpenclKernel, "", "");
         output.status = false;
+        std::lock_guard<std::mutex> lock(output_md_lock_);
         output_metadata_[{rgaDevice, ""}] = output;
     }
 
@@ -530,35 +622,20 @@ void KcCLICommanderLightning::RunCompileCommands(const Config& config, LoggingCa
         util.ExtractStatistics(config);
     }
 
-    // Block post-processing until quality of analysis engine improves when processing llvm disassembly.
-    bool is_livereg_required = !config.livereg_analysis_file.empty();
-    if (is_livereg_required)
-    {
-        // Perform Live Registers analysis if required.
-        if (status || is_multiple_devices)
-        {
-            util.PerformLiveVgprAnalysis(config);
-        }
-    }
-
+    // Perform the live register analyses and extract the Control Flow Graphs if required.
+    // All analyses of all kernels are submitted as a single batch.
+    bool is_livereg_required      = !config.livereg_analysis_file.empty();
     bool is_sgpr_livereg_required = !config.sgpr_livereg_analysis_file.empty();
-    if (is_sgpr_livereg_required)
+    bool is_cfg_required          = (!config.block_cfg_file.empty() || !config.inst_cfg_file.empty());
+    if ((is_livereg_required || is_sgpr_livereg_required || is_cfg_required) && (status || is_multiple_devices))
     {
-        // Perform Live Registers analysis if required.
-        if (status || is_multiple_devices)
-        {
-            util.PerformLiveSgprAnalysis(config);
-        }
+        util.PerformStaticIsaAnalyses(config);
     }
 
-    bool is_cfg_required = (!config.block_cfg_file.empty() || !config.inst_cfg_file.empty());
-    if (is_cfg_required)
+    // Estimate the cycles per wavefront of the kernels if required.
+    if ((status || is_multiple_devices) && !config.cycle_estimate_file.empty())
     {
-        // Extract Control Flow Graph.
-        if (status || is_multiple_devices)
-        {
-            util.ExtractCFG(config);
-        }
+        util.EstimateCycles(config);
     }
 
     // Extract CodeObj metadata if required.
@@ -696,9 +773,15 @@ static void  FilterISALine(std::string & isa_line)
 bool  KcCLICommanderLightning::ReduceISA(const std::string& binFile, IsaMap& kernel_isa_text)
 {
     bool  ret = false;
+
+    // Read the code sizes of all kernels at once.
+    KernelCodeSizeMap  code_sizes;
+    BeProgramBuilderLightning::ExtractKernelCodeSizes(compiler_paths_.bin, binFile, should_print_cmd_, code_sizes);
+
     for (auto& kernel_isa : kernel_isa_text)
     {
-        int  code_size = BeProgramBuilderLightning::GetKernelCodeSize(compiler_paths_.bin, binFile, kernel_isa.first, should_print_cmd_);
+        auto  code_size_entry = code_sizes.find(kernel_isa.first);
+        int   code_size = (code_size_entry != code_sizes.end() ? code_size_entry->second : -1);
         assert(code_size != -1);
         if (code_size != -1)
         {
@@ -843,6 +926,7 @@ bool KcCLICommanderLightning::SplitISA(const std::string& bin_file, const std::s
                 {
                     RgOutputFiles  outFiles = RgOutputFiles(RgaEntryType::kOpenclKernel, isa_filename.asASCIICharArray());
                     outFiles.is_isa_file_temp = is_isa_file_temp;
+                    std::lock_guard<std::mutex> lock(output_md_lock_);
                     output_metadata_[{device, isa_text_map_item.first}] = outFiles;
                 }
             }
@@ -11,10 +11,12 @@
 #include <string>
 #include <set>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 
 // Local.
 #include "radeon_gpu_analyzer_cli/kc_cli_commander.h"
+#include "radeon_gpu_analyzer_cli/kc_compilation_cache.h"
 
 // Backend.
 #include "source/radeon_gpu_analyzer_backend/be_program_builder_lightning.h"
@@ -66,9 +68,13 @@ private:
     // Perform requested compilation.
     bool  Compile(const Config& config);
 
-    // Perform OpenCL compilation.
+    // Perform OpenCL compilation for all selected devices.
     beKA::beStatus CompileOpenCL(const Config& config, const OpenCLOptions& ocl_options);
 
+    // Compile, disassemble and split the ISA for a single device.
+    // This function may be called concurrently for different devices.
+    beKA::beStatus CompileOpenCLForDevice(const Config& config, const OpenCLOptions& ocl_options, const std::string& device);
+
     // Disassemble binary file.
     // The disassembled ISA text are be divided into per-kernel parts and stored in separate files.
     // The names of ISA files are generated based on provided user ISA file name.
@@ -122,6 +128,12 @@ private:
 
     // Specifies whether the "-#" option (print commands) is enabled.
     bool  should_print_cmd_;
+
+    // Guards the output metadata while devices are compiled concurrently.
+    std::mutex  output_md_lock_;
+
+    // Compilation cache key of the sources and options of the build (null if the build is not cached).
+    std::unique_ptr<KcCompilationCacheKey>  source_cache_key_;
 };
 
 #endif // RGA_RADEONGPUANALYZERCLI_SRC_KC_CLI_COMMANDER_LIGHTNING_H_
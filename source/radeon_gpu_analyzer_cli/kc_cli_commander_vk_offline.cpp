@@ -11,6 +11,7 @@
 // Local.
 #include "radeon_gpu_analyzer_cli/kc_cli_commander_vk_offline.h"
 #include "radeon_gpu_analyzer_cli/kc_cli_string_constants.h"
+#include "radeon_gpu_analyzer_cli/kc_compilation_cache.h"
 #include "radeon_gpu_analyzer_cli/kc_utils.h"
 #include "radeon_gpu_analyzer_cli/kc_statistics_parser_vulkan.h"
 #include "radeon_gpu_analyzer_cli/kc_utils_vulkan.h"
@@ -647,6 +648,33 @@ void GetBeVkPipelineFileNames(const Config&           config,
     }
 }
 
+// Add the inputs of the amdllpc compilation of the pipeline to a compilation cache key:
+// the target device, the options and the contents of the SPIR-V (or .pipe) input files.
+static bool AddPipelineToCacheKey(const Config& config, const VkOfflineOptions& vulkan_options, KcCompilationCacheKey& key)
+{
+    bool ret = vulkan_options.is_pipeline_binary_required && !vulkan_options.pipeline_binary.empty();
+
+    BeVkPipelineFiles spv_files, isa_files, stats_files;
+    GetBeVkPipelineFileNames(config, vulkan_options, spv_files, isa_files, stats_files);
+
+    key.AddText(vulkan_options.target_device_name);
+    key.AddText(std::to_string(vulkan_options.optimization_level));
+    for (int stage = 0; ret && stage < BePipelineStage::kCount; stage++)
+    {
+        key.AddText(std::to_string(stage));
+        if (!spv_files[stage].empty())
+        {
+            ret = key.AddFile(spv_files[stage]);
+        }
+    }
+    if (ret && !vulkan_options.pipe_file.empty())
+    {
+        ret = key.AddFile(vulkan_options.pipe_file);
+    }
+
+    return ret;
+}
+
 void KcCLICommanderVkOffline::RunCompileCommands(const Config& config, LoggingCallbackFunction callback)
 {
     log_callback_ = callback;
@@ -731,10 +759,23 @@ void KcCLICommanderVkOffline::RunCompileCommands(const Config& config, LoggingCa
                 // A handle for canceling the build. Currently not in use.
                 bool should_cancel = false;
 
-                // Compile.
+                // Fetch the pipeline binary from the compilation cache, or compile.
                 gtString build_error_log;
                 beKA::beStatus compilation_status = kBeStatusGeneralFailed;
-                compilation_status = vulkan_builder_->CompileWithAmdllpc(vulkan_options, should_cancel, config.print_process_cmd_line, build_error_log);
+                KcCompilationCacheKey cache_key("vk-offline-pipeline");
+                const bool is_cacheable = KcCompilationCache::IsEnabled() && AddPipelineToCacheKey(config, vulkan_options, cache_key);
+                if (is_cacheable && KcCompilationCache::FetchFiles(cache_key, {vulkan_options.pipeline_binary}))
+                {
+                    compilation_status = kBeStatusSuccess;
+                }
+                else
+                {
+                    compilation_status = vulkan_builder_->CompileWithAmdllpc(vulkan_options, should_cancel, config.print_process_cmd_line, build_error_log);
+                    if (is_cacheable && compilation_status == kBeStatusSuccess)
+                    {
+                        KcCompilationCache::StoreFiles(cache_key, {vulkan_options.pipeline_binary});
+                    }
+                }
                 if (compilation_status == kBeStatusSuccess)
                 {
                     log_msg << kStrInfoSuccess << std::endl;
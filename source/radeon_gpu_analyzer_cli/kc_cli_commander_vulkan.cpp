@@ -32,6 +32,7 @@
 // Local.
 #include "radeon_gpu_analyzer_cli/kc_cli_commander_vulkan.h"
 #include "radeon_gpu_analyzer_cli/kc_cli_commander_vk_offline.h"
+#include "radeon_gpu_analyzer_cli/kc_job_pool.h"
 #include "radeon_gpu_analyzer_cli/kc_xml_writer.h"
 #include "radeon_gpu_analyzer_cli/kc_cli_string_constants.h"
 #include "radeon_gpu_analyzer_cli/kc_utils_vulkan.h"
@@ -799,21 +800,26 @@ void KcCliCommanderVulkan::RunCompileCommands(const Config& config, LoggingCallb
                 }
                 else
                 {
-                    // Compile per-device.
-                    for (const std::string& target : asics_)
+                    // Compile per-device. The devices are compiled concurrently (up to config.jobs at a time),
+                    // while the console output is still printed in the order of the devices.
+                    const std::vector<std::string> targets(asics_.cbegin(), asics_.cend());
+                    if (status)
                     {
-                        // Compile for the specific target.
-                        configPerDevice.asics.clear();
-                        configPerDevice.asics.push_back(target);
+                        KcJobPool::Run(targets.size(), config.jobs, [&](size_t target_index) {
+                            // Compile for the specific target.
+                            Config target_config = config;
+                            target_config.asics.clear();
+                            target_config.asics.push_back(targets[target_index]);
 
-                        // Now, compile the SPIR-V binaries.
-                        if (status)
-                        {
                             // Perform back-end compilation from a SPIR-V binary to ISA disassembly & statistics.
-                            CompileSpvToIsaForDevice(configPerDevice, spv_files, target);
-                        }
+                            CompileSpvToIsaForDevice(target_config, spv_files, targets[target_index]);
+                        });
                     }
 
+                    // Post-processing uses the configuration of the last target.
+                    configPerDevice.asics.clear();
+                    configPerDevice.asics.push_back(targets.back());
+
                     KcUtilsVulkan util(output_metadata_, physical_adapter_name_, log_callback_, kVulkanStageFileSuffix);
                     util.RunPostProcessingSteps(configPerDevice);
                 }
@@ -1289,6 +1295,7 @@ void KcCliCommanderVulkan::CompileSpvToIsaForDevice(const Config&            con
             status = KcUtilsVulkan::ConvertStats(isa_files, stats_files, config, device);
         }
 
+        std::lock_guard<std::mutex> lock(output_md_lock_);
         if (status == kBeStatusSuccess)
         {
             StoreOutputFilesToOutputMD(device, spv_files, isa_files, stats_files, wave_sizes);
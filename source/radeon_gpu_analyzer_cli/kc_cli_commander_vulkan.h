@@ -7,6 +7,9 @@
 #ifndef RGA_RADEONGPUANALYZERCLI_SRC_KC_CLI_COMMANDER_VULKAN_H_
 #define RGA_RADEONGPUANALYZERCLI_SRC_KC_CLI_COMMANDER_VULKAN_H_
 
+// C++.
+#include <mutex>
+
 // Local.
 #include "radeon_gpu_analyzer_cli/kc_cli_commander.h"
 
@@ -53,6 +56,7 @@ private:
 
     // Compile a SPIR-V binary file to ISA disassembly file(s) and shader statistics file(s) for specified device.
     // (This function invokes VulkanBackend executable).
+    // This function may be called concurrently for different devices.
     // is_vk_offline is set to true, if compilation fell back to vk-spv-offline mode.
     void CompileSpvToIsaForDevice(const Config& config, const BeVkPipelineFiles& spv_files, const std::string& device, bool is_physical_adapter = false);
 
@@ -95,6 +99,9 @@ private:
 
     // Temporary files.
     std::vector<std::string> temp_files_;
+
+    // Guards the output metadata and the list of temporary files while devices are compiled concurrently.
+    std::mutex output_md_lock_;
 };
 
 #endif  // RGA_RADEONGPUANALYZERCLI_SRC_KC_CLI_COMMANDER_VULKAN_H_
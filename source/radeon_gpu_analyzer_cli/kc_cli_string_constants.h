@@ -81,6 +81,13 @@ static const char* kStrInfoValidateBinFile = "Info: validating input code object
 static const char* kStrInfoDisassemblingBinary = "Info: disassembling input code object ";
 static const char* kStrInfoDetectBinWorkflowType  = "Info: identifying workflow type for input code object: ";
 static const char* kStrInfoDetectBinTargetDevice  = "Info: extracting device information from: ";
+static const char* kStrInfoBinDuplicateSkipped    = "Info: skipping input code object identical to ";
+static const char* kStrInfoBinSummaryAnalyzed     = "Info: analyzed ";
+static const char* kStrInfoBinSummaryCodeObjects  = " input code object(s): ";
+static const char* kStrInfoBinSummarySucceeded    = " succeeded, ";
+static const char* kStrInfoBinSummaryFailed       = " failed, ";
+static const char* kStrInfoBinSummaryDuplicates   = " skipped as duplicates.";
+static const char* kStrInfoBinSummaryFailedFile   = "Info: failed input code object: ";
 
 
 // Build output.
@@ -90,6 +97,7 @@ static const char* kStrInfoAborting = "Aborting.";
 static const char* kStrInfoCompiling = "Building for ";
 static const char* kStrInfoExtractingIsaForDevice = "Extracting ISA for ";
 static const char* kStrInfoExtractingStats = "Extracting statistics";
+static const char* kStrInfoEstimatingCycles = "Estimating cycles";
 
 // Shaders and pipeline stages.
 static const char* kStrVertexStage = "vertex";
@@ -115,6 +123,7 @@ static const char* kStrDefaultExtensionBin = "bin";
 static const char* kStrDefaultExtensionMetadata = "amdMetadata";
 static const char* kStrDefaultExtensionDxasm = "dxasm";
 static const char* kStrDefaultExtensionStats = "stats";
+static const char* kStrDefaultExtensionCycles = "cycles";
 static const char* kStrDefaultExtensionCsv = "csv";
 static const char* kStrDefaultExtensionRawDisassembly = "raw";
 
@@ -0,0 +1,380 @@
+//=============================================================================
+/// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Implementation for the persistent, content-addressed compilation cache of the CLI.
+//=============================================================================
+
+// C++.
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Infra.
+#include "external/amdt_os_wrappers/Include/osApplication.h"
+#include "external/amdt_os_wrappers/Include/osFilePath.h"
+
+// Shared.
+#include "common/rga_hash.h"
+#include "common/rga_version_info.h"
+
+// Local.
+#include "radeon_gpu_analyzer_cli/kc_compilation_cache.h"
+
+namespace fs = std::filesystem;
+
+// Name of the default cache folder, created under the system temp folder.
+static const char* kStrCacheDefaultFolderName = "rga_cache";
+
+// Prefix of the artifact file names inside a cache entry.
+static const char* kStrCacheArtifactPrefix = "artifact_";
+
+// Suffix of the folders that hold entries that are being written.
+static const char* kStrCacheTempEntrySuffix = ".tmp";
+
+// Length of a cache key string (128 bits in hexadecimal).
+static const size_t kCacheKeyLength = 32;
+
+// Size of the chunks in which files are read when added to a key.
+static const size_t kCacheFileReadChunkSize = 64 * 1024;
+
+// Age after which a partially written entry is considered abandoned.
+static const std::chrono::hours kCacheStaleTempEntryAge(24);
+
+// Constants of the second hash lane (the first lane is an FNV-1a hash).
+static const uint64_t kMixSeed       = 0x9e3779b97f4a7c15ULL;
+static const uint64_t kMixMultiplier = 0xff51afd7ed558ccdULL;
+
+// Cache state, set by KcCompilationCache::Configure().
+static bool      is_cache_enabled = false;
+static fs::path  cache_dir;
+static uintmax_t cache_size_limit = 0;
+
+// Size of the cache as tracked by this process: the size found by the last scan of the cache folder,
+// plus the entries that this process stored since. Entries stored by other processes are found by the next scan.
+static uintmax_t tracked_cache_size    = 0;
+static bool      is_cache_size_scanned = false;
+
+// Serializes the size tracking and the evictions of this process.
+static std::mutex eviction_lock;
+
+// Returns the file name of the artifact with the given index.
+static std::string GetArtifactFilename(size_t index)
+{
+    return kStrCacheArtifactPrefix + std::to_string(index);
+}
+
+// Returns true if the given folder name is a cache key (and not a folder that the cache does not own).
+static bool IsCacheEntryName(const std::string& name)
+{
+    return name.size() == kCacheKeyLength && std::all_of(name.cbegin(), name.cend(), [](char c) { return std::isxdigit(static_cast<unsigned char>(c)) != 0; });
+}
+
+// Returns a folder name for writing an entry, unique among the threads and processes that share the cache.
+static fs::path GetTempEntryPath(const std::string& key)
+{
+    const size_t thread_hash = std::hash<std::thread::id>()(std::this_thread::get_id());
+    const auto   time_stamp  = std::chrono::steady_clock::now().time_since_epoch().count();
+    return cache_dir / (key + "_" + std::to_string(thread_hash) + "_" + std::to_string(time_stamp) + kStrCacheTempEntrySuffix);
+}
+
+// Mark the given entry as the most recently used one.
+static void TouchEntry(const fs::path& entry_path)
+{
+    std::error_code ec;
+    fs::last_write_time(entry_path, fs::file_time_type::clock::now(), ec);
+}
+
+KcCompilationCacheKey::KcCompilationCacheKey(const std::string& domain)
+    : lane_fnv_(RgaFnv1a::kOffsetBasis64)
+    , lane_mix_(kMixSeed)
+{
+    AddText(KcCompilationCache::GetToolchainId());
+    AddText(domain);
+}
+
+void KcCompilationCacheKey::AddBytes(const char* data, size_t size)
+{
+    lane_fnv_ = RgaFnv1a::Update64(lane_fnv_, std::string_view(data, size));
+    for (size_t i = 0; i < size; i++)
+    {
+        const uint64_t byte = static_cast<unsigned char>(data[i]);
+        lane_mix_           = (lane_mix_ ^ byte) * kMixMultiplier;
+        lane_mix_ ^= lane_mix_ >> 29;
+    }
+}
+
+void KcCompilationCacheKey::AddText(const std::string& text)
+{
+    // Prefix every component with its size, so that the boundaries between components are part of the key.
+    const uint64_t size = text.size();
+    AddBytes(reinterpret_cast<const char*>(&size), sizeof(size));
+    AddBytes(text.data(), text.size());
+}
+
+bool KcCompilationCacheKey::AddFile(const std::string& filename)
+{
+    bool          ret = false;
+    std::ifstream file(filename, std::ios::binary);
+    if (file.is_open())
+    {
+        std::error_code ec;
+        const uint64_t  size = static_cast<uint64_t>(fs::file_size(filename, ec));
+        AddBytes(reinterpret_cast<const char*>(&size), sizeof(size));
+
+        std::vector<char> buffer(kCacheFileReadChunkSize);
+        while (file.read(buffer.data(), buffer.size()) || file.gcount() > 0)
+        {
+            AddBytes(buffer.data(), static_cast<size_t>(file.gcount()));
+        }
+        ret = !ec && file.eof();
+    }
+    return ret;
+}
+
+std::string KcCompilationCacheKey::ToString() const
+{
+    static const char* kHexDigits = "0123456789abcdef";
+    std::string        ret;
+    ret.reserve(kCacheKeyLength);
+    for (uint64_t lane : {lane_fnv_, lane_mix_})
+    {
+        for (int shift = 60; shift >= 0; shift -= 4)
+        {
+            ret.push_back(kHexDigits[(lane >> shift) & 0xf]);
+        }
+    }
+    return ret;
+}
+
+void KcCompilationCache::Configure(const Config& config)
+{
+    is_cache_enabled = !config.is_cache_disabled;
+    if (is_cache_enabled)
+    {
+        std::error_code ec;
+        cache_dir = config.cache_dir.empty() ? fs::temp_directory_path(ec) / kStrCacheDefaultFolderName : fs::path(config.cache_dir);
+        fs::create_directories(cache_dir, ec);
+        is_cache_enabled = fs::is_directory(cache_dir, ec);
+        cache_size_limit = static_cast<uintmax_t>(config.cache_size_mb) * 1024 * 1024;
+    }
+}
+
+bool KcCompilationCache::IsEnabled()
+{
+    return is_cache_enabled;
+}
+
+const std::string& KcCompilationCache::GetToolchainId()
+{
+    // The RGA version, and the size and modification time of the RGA executable: the compilers and
+    // disassemblers that RGA launches are installed with it, so a new installation invalidates the cache.
+    static const std::string kToolchainId = []() {
+        std::string ret = kStrRgaVersion;
+        osFilePath  exe_path;
+        if (osGetCurrentApplicationPath(exe_path, false))
+        {
+            const fs::path  exe(exe_path.asString().asASCIICharArray());
+            std::error_code ec;
+            const uintmax_t size = fs::file_size(exe, ec);
+            if (!ec)
+            {
+                const auto time_stamp = fs::last_write_time(exe, ec).time_since_epoch().count();
+                ret += ";" + exe.string() + ";" + std::to_string(size) + ";" + std::to_string(time_stamp);
+            }
+        }
+        return ret;
+    }();
+    return kToolchainId;
+}
+
+bool KcCompilationCache::FetchFiles(const KcCompilationCacheKey& key, const std::vector<std::string>& filenames)
+{
+    bool ret = is_cache_enabled;
+    if (ret)
+    {
+        const fs::path  entry_path = cache_dir / key.ToString();
+        std::error_code ec;
+        ret = fs::is_directory(entry_path, ec);
+        for (size_t i = 0; ret && i < filenames.size(); i++)
+        {
+            ret = fs::copy_file(entry_path / GetArtifactFilename(i), filenames[i], fs::copy_options::overwrite_existing, ec) && !ec;
+        }
+        if (ret)
+        {
+            TouchEntry(entry_path);
+        }
+    }
+    return ret;
+}
+
+void KcCompilationCache::StoreFiles(const KcCompilationCacheKey& key, const std::vector<std::string>& filenames)
+{
+    if (is_cache_enabled)
+    {
+        const std::string key_string = key.ToString();
+        const fs::path    entry_path = cache_dir / key_string;
+        std::error_code   ec;
+        if (!fs::exists(entry_path, ec))
+        {
+            // Write the entry to a temporary folder and rename it when complete, so that
+            // other threads and processes never observe a partially written entry.
+            const fs::path temp_path  = GetTempEntryPath(key_string);
+            bool           is_ok      = fs::create_directories(temp_path, ec);
+            uintmax_t      entry_size = 0;
+            for (size_t i = 0; is_ok && i < filenames.size(); i++)
+            {
+                is_ok = fs::copy_file(filenames[i], temp_path / GetArtifactFilename(i), fs::copy_options::overwrite_existing, ec) && !ec;
+                if (is_ok)
+                {
+                    const uintmax_t file_size = fs::file_size(filenames[i], ec);
+                    entry_size += (ec ? 0 : file_size);
+                }
+            }
+            if (is_ok)
+            {
+                fs::rename(temp_path, entry_path, ec);
+                is_ok = !ec;
+            }
+            if (!is_ok)
+            {
+                fs::remove_all(temp_path, ec);
+            }
+            else
+            {
+                AddEntrySize(entry_size);
+            }
+        }
+    }
+}
+
+bool KcCompilationCache::FetchText(const KcCompilationCacheKey& key, std::string& text)
+{
+    bool ret = is_cache_enabled;
+    if (ret)
+    {
+        const fs::path entry_path = cache_dir / key.ToString();
+        std::ifstream  file(entry_path / GetArtifactFilename(0), std::ios::binary);
+        ret = file.is_open();
+        if (ret)
+        {
+            text.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+            ret = !file.bad();
+        }
+        if (ret)
+        {
+            TouchEntry(entry_path);
+        }
+    }
+    return ret;
+}
+
+void KcCompilationCache::StoreText(const KcCompilationCacheKey& key, const std::string& text)
+{
+    if (is_cache_enabled)
+    {
+        const std::string key_string = key.ToString();
+        const fs::path    entry_path = cache_dir / key_string;
+        std::error_code   ec;
+        if (!fs::exists(entry_path, ec))
+        {
+            const fs::path temp_path = GetTempEntryPath(key_string);
+            bool           is_ok     = fs::create_directories(temp_path, ec);
+            if (is_ok)
+            {
+                std::ofstream file(temp_path / GetArtifactFilename(0), std::ios::binary);
+                is_ok = file.is_open() && file.write(text.data(), static_cast<std::streamsize>(text.size())).good();
+            }
+            if (is_ok)
+            {
+                fs::rename(temp_path, entry_path, ec);
+                is_ok = !ec;
+            }
+            if (!is_ok)
+            {
+                fs::remove_all(temp_path, ec);
+            }
+            else
+            {
+                AddEntrySize(text.size());
+            }
+        }
+    }
+}
+
+void KcCompilationCache::AddEntrySize(uintmax_t entry_size)
+{
+    // A size limit of 0 means that the cache is not bounded.
+    if (cache_size_limit > 0)
+    {
+        std::lock_guard<std::mutex> lock(eviction_lock);
+        tracked_cache_size += entry_size;
+
+        // The first store of the process scans the cache folder to learn its size.
+        if (!is_cache_size_scanned || tracked_cache_size > cache_size_limit)
+        {
+            tracked_cache_size    = Evict();
+            is_cache_size_scanned = true;
+        }
+    }
+}
+
+uintmax_t KcCompilationCache::Evict()
+{
+    struct CacheEntry
+    {
+        fs::path           path;
+        uintmax_t          size = 0;
+        fs::file_time_type last_use;
+    };
+
+    std::vector<CacheEntry> entries;
+    uintmax_t               total_size = 0;
+    std::error_code         ec;
+    for (fs::directory_iterator it(cache_dir, ec), end; !ec && it != end; it.increment(ec))
+    {
+        const std::string name = it->path().filename().string();
+        if (it->is_directory(ec) && IsCacheEntryName(name))
+        {
+            CacheEntry entry;
+            entry.path     = it->path();
+            entry.last_use = fs::last_write_time(entry.path, ec);
+            for (fs::directory_iterator file_it(entry.path, ec), file_end; !ec && file_it != file_end; file_it.increment(ec))
+            {
+                const uintmax_t file_size = file_it->file_size(ec);
+                entry.size += (ec ? 0 : file_size);
+            }
+            ec.clear();
+            total_size += entry.size;
+            entries.push_back(entry);
+        }
+        else if (name.size() > kCacheKeyLength && IsCacheEntryName(name.substr(0, kCacheKeyLength)) &&
+                 name.rfind(kStrCacheTempEntrySuffix) == name.size() - strlen(kStrCacheTempEntrySuffix) &&
+                 fs::last_write_time(it->path(), ec) + kCacheStaleTempEntryAge < fs::file_time_type::clock::now())
+        {
+            // Remove entries that a crashed process left partially written.
+            fs::remove_all(it->path(), ec);
+        }
+        ec.clear();
+    }
+
+    if (total_size > cache_size_limit)
+    {
+        // Evict the least recently used entries first.
+        std::sort(entries.begin(), entries.end(), [](const CacheEntry& a, const CacheEntry& b) { return a.last_use < b.last_use; });
+        for (auto it = entries.cbegin(); it != entries.cend() && total_size > cache_size_limit; ++it)
+        {
+            fs::remove_all(it->path, ec);
+            total_size -= it->size;
+        }
+    }
+
+    return total_size;
+}
@@ -0,0 +1,87 @@
+//=============================================================================
+/// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Header for the persistent, content-addressed compilation cache of the CLI.
+//=============================================================================
+#ifndef RGA_RADEONGPUANALYZERCLI_SRC_KC_COMPILATION_CACHE_H_
+#define RGA_RADEONGPUANALYZERCLI_SRC_KC_COMPILATION_CACHE_H_
+
+// C++.
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Local.
+#include "radeon_gpu_analyzer_cli/kc_config.h"
+
+// Accumulates everything that determines the result of a compilation step
+// (input contents, options, target, tool versions) into a 128-bit cache key.
+class KcCompilationCacheKey
+{
+public:
+    // "domain" names the compilation step, so that different steps never share a key.
+    explicit KcCompilationCacheKey(const std::string& domain);
+
+    // Add a string to the key.
+    void AddText(const std::string& text);
+
+    // Add the contents of a file to the key. Returns false if the file cannot be read.
+    bool AddFile(const std::string& filename);
+
+    // Returns the key as a 32-character hexadecimal string.
+    std::string ToString() const;
+
+private:
+    // Add raw bytes to the key.
+    void AddBytes(const char* data, size_t size);
+
+    // The two independent 64-bit hash lanes.
+    uint64_t lane_fnv_ = 0;
+    uint64_t lane_mix_ = 0;
+};
+
+// On-disk cache of compilation outputs, shared by all RGA invocations that use the same cache folder.
+// Every entry is a folder named after its key that holds the artifacts of one compilation step.
+// The total size of the cache is bounded: when it is exceeded, the least recently used entries are evicted.
+// All operations are best-effort: a cache failure never fails the build, it only results in a cache miss.
+class KcCompilationCache
+{
+public:
+    // Set up the cache according to the --cache-dir, --cache-size and --no-cache options.
+    // Must be called before any other function, and before any concurrent jobs are started.
+    static void Configure(const Config& config);
+
+    // Returns true if the cache is enabled.
+    static bool IsEnabled();
+
+    // Copy the artifacts of the given entry to the given files. Returns true on a cache hit.
+    static bool FetchFiles(const KcCompilationCacheKey& key, const std::vector<std::string>& filenames);
+
+    // Store the given files as the artifacts of the given entry.
+    static void StoreFiles(const KcCompilationCacheKey& key, const std::vector<std::string>& filenames);
+
+    // Read the text artifact of the given entry. Returns true on a cache hit.
+    static bool FetchText(const KcCompilationCacheKey& key, std::string& text);
+
+    // Store the given text as the artifact of the given entry.
+    static void StoreText(const KcCompilationCacheKey& key, const std::string& text);
+
+    // Returns a string that identifies the running RGA build and the tools bundled with it.
+    static const std::string& GetToolchainId();
+
+private:
+    // Add a new entry of the given size to the tracked size of the cache. The cache folder is scanned (and entries evicted)
+    // at the first store of the process, to learn the size of the cache, and then only when the tracked size exceeds the size limit.
+    static void AddEntrySize(uintmax_t entry_size);
+
+    // Evict the least recently used entries until the cache fits its size limit.
+    // Returns the size of the cache after the eviction.
+    static uintmax_t Evict();
+
+    // This is a static class (no instances).
+    KcCompilationCache()  = delete;
+    ~KcCompilationCache() = delete;
+};
+
+#endif  // RGA_RADEONGPUANALYZERCLI_SRC_KC_COMPILATION_CACHE_H_
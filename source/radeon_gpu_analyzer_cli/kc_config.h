@@ -58,6 +58,7 @@ public:
     std::string              sgpr_livereg_analysis_file;        ///< SGPR Live register analysis output file.
     std::string              block_cfg_file;                    ///< Output file for per-block control flow graph.
     std::string              inst_cfg_file;                     ///< Output file for per-instruction control flow graph.
+    std::string              cycle_estimate_file;               ///< Output file for the static estimate of cycles per wavefront.
     std::string              inference_analysis_file;           ///< Output file for SPP inference (text).
     std::string              inference_image_file;              ///< Output file for SPP inference (image).
     std::string              inference_bottleneck_threshold;    ///< The number of cycles that defines a bottleneck for SPP.
@@ -199,6 +200,13 @@ public:
     bool                     is_line_numbers_required;          ///< True to generate source lines in the ISA disassembly.
     bool                     is_warnings_required;              ///< True to print warnings reported by the compiler.
     bool                     print_process_cmd_line;            ///< True to print command lines that RGA uses to launch external processes.
+    unsigned                 jobs = 1;                          ///< Maximum number of targets to compile concurrently (0 for all hardware threads).
+
+    // Compilation cache.
+    std::string              cache_dir;                         ///< Path to the compilation cache folder (empty for the default folder).
+    unsigned                 cache_size_mb = 1024;              ///< Maximum size of the compilation cache in MB (0 for unlimited).
+    bool                     is_cache_disabled = false;         ///< True to disable the compilation cache.
+    bool                     is_isa_analysis_engine_enabled = false; ///< True to run live register analysis and CFG generation in-process.
 };
 
 #endif // RGA_RADEONGPUANALYZERCLI_SRC_KC_CONFIG_H_
@@ -0,0 +1,197 @@
+//=============================================================================
+/// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Implementation for a bounded worker pool that runs CLI compilation jobs concurrently.
+//=============================================================================
+
+// C++.
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <iostream>
+#include <mutex>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Shared.
+#include "common/rg_log.h"
+
+// Local.
+#include "radeon_gpu_analyzer_cli/kc_job_pool.h"
+
+// The console buffer of the job that is running on the current thread (null if the thread does not run a job).
+static thread_local std::string* job_console_buffer = nullptr;
+
+// Stream buffer that is installed on std::cout while jobs are running in parallel.
+// Output written by a thread that runs a job is appended to that job's buffer.
+// Output written by any other thread goes straight to the original stream buffer.
+// Completed job buffers are released to the original stream buffer in job order.
+class KcOrderedConsoleBuffer : public std::streambuf
+{
+public:
+    KcOrderedConsoleBuffer(std::streambuf* target, size_t job_count)
+        : target_(target)
+        , job_buffers_(job_count)
+        , is_job_done_(job_count, false)
+    {
+    }
+
+    // Returns the buffer that collects the output of the given job.
+    std::string& GetJobBuffer(size_t job_index)
+    {
+        return job_buffers_[job_index];
+    }
+
+    // Mark the given job as completed and print the output of all completed jobs
+    // that are not preceded by a job that is still running.
+    void CompleteJob(size_t job_index)
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        is_job_done_[job_index] = true;
+        while (next_job_to_print_ < job_buffers_.size() && is_job_done_[next_job_to_print_])
+        {
+            std::string& output = job_buffers_[next_job_to_print_];
+            if (!output.empty())
+            {
+                target_->sputn(output.data(), static_cast<std::streamsize>(output.size()));
+                target_->pubsync();
+                std::string().swap(output);
+            }
+            ++next_job_to_print_;
+        }
+    }
+
+protected:
+    int_type overflow(int_type c) override
+    {
+        if (!traits_type::eq_int_type(c, traits_type::eof()))
+        {
+            const char ch = traits_type::to_char_type(c);
+            xsputn(&ch, 1);
+        }
+        return traits_type::not_eof(c);
+    }
+
+    std::streamsize xsputn(const char* s, std::streamsize count) override
+    {
+        if (job_console_buffer != nullptr)
+        {
+            job_console_buffer->append(s, static_cast<size_t>(count));
+        }
+        else
+        {
+            std::lock_guard<std::mutex> lock(lock_);
+            target_->sputn(s, count);
+        }
+        return count;
+    }
+
+    int sync() override
+    {
+        int ret = 0;
+        if (job_console_buffer == nullptr)
+        {
+            std::lock_guard<std::mutex> lock(lock_);
+            ret = target_->pubsync();
+        }
+        return ret;
+    }
+
+private:
+    // The stream buffer that std::cout used before this buffer was installed.
+    std::streambuf* target_ = nullptr;
+
+    // Per-job console output.
+    std::vector<std::string> job_buffers_;
+
+    // Per-job completion flags.
+    std::vector<bool> is_job_done_;
+
+    // Index of the first job whose output was not printed yet.
+    size_t next_job_to_print_ = 0;
+
+    // Guards the target stream buffer and the completion state.
+    std::mutex lock_;
+};
+
+unsigned KcJobPool::ResolveWorkerCount(unsigned requested_jobs, size_t job_count)
+{
+    unsigned ret = requested_jobs;
+    if (ret == 0)
+    {
+        ret = std::thread::hardware_concurrency();
+    }
+    ret = static_cast<unsigned>(std::min<size_t>(std::max(ret, 1u), std::max<size_t>(job_count, 1)));
+    return ret;
+}
+
+void KcJobPool::Run(size_t job_count, unsigned max_workers, const JobFunction& job)
+{
+    const unsigned worker_count = ResolveWorkerCount(max_workers, job_count);
+    if (worker_count <= 1)
+    {
+        for (size_t i = 0; i < job_count; i++)
+        {
+            job(i);
+        }
+    }
+    else
+    {
+        // Redirect the console output so that it can be reordered.
+        KcOrderedConsoleBuffer console_buffer(std::cout.rdbuf(), job_count);
+        std::cout.flush();
+        std::streambuf* original_buffer = std::cout.rdbuf(&console_buffer);
+
+        std::atomic<size_t> next_job(0);
+        std::exception_ptr  first_exception;
+        std::mutex          exception_lock;
+
+        auto worker = [&]() {
+            size_t job_index = 0;
+            while ((job_index = next_job.fetch_add(1)) < job_count)
+            {
+                job_console_buffer = &console_buffer.GetJobBuffer(job_index);
+                try
+                {
+                    job(job_index);
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock(exception_lock);
+                    if (first_exception == nullptr)
+                    {
+                        first_exception = std::current_exception();
+                    }
+                }
+                job_console_buffer = nullptr;
+                console_buffer.CompleteJob(job_index);
+            }
+
+            // Release the log stream slot that this worker thread may have used.
+            RgLog::CloseThreadLog();
+        };
+
+        std::vector<std::thread> workers;
+        workers.reserve(worker_count);
+        for (unsigned i = 0; i < worker_count; i++)
+        {
+            workers.emplace_back(worker);
+        }
+        for (std::thread& t : workers)
+        {
+            t.join();
+        }
+
+        // Restore the original console buffer.
+        std::cout.rdbuf(original_buffer);
+        std::cout.flush();
+
+        if (first_exception != nullptr)
+        {
+            std::rethrow_exception(first_exception);
+        }
+    }
+}
@@ -0,0 +1,39 @@
+//=============================================================================
+/// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Header for a bounded worker pool that runs CLI compilation jobs concurrently.
+//=============================================================================
+#ifndef RGA_RADEONGPUANALYZERCLI_SRC_KC_JOB_POOL_H_
+#define RGA_RADEONGPUANALYZERCLI_SRC_KC_JOB_POOL_H_
+
+// C++.
+#include <cstddef>
+#include <functional>
+
+// Runs independent jobs (typically one per target device) on a bounded set of worker threads.
+// Console output that a job produces through std::cout (including RgLog::stdOut) is buffered
+// per job and printed in job order, so the console output of a parallel run is identical to
+// the output of a sequential run.
+class KcJobPool
+{
+public:
+    // Job function: receives the index of the job to execute.
+    typedef std::function<void(size_t job_index)> JobFunction;
+
+    // Returns the number of worker threads to use for "job_count" jobs when the user requested "requested_jobs".
+    // A request of 0 means "use all hardware threads". The result is in the range [1, job_count].
+    static unsigned ResolveWorkerCount(unsigned requested_jobs, size_t job_count);
+
+    // Execute jobs [0, job_count) using at most "max_workers" threads (0 means "use all hardware threads").
+    // If a single worker is used, the jobs are executed sequentially on the calling thread.
+    // Returns after all jobs completed. If any job throws, the first exception is rethrown after all workers finished.
+    static void Run(size_t job_count, unsigned max_workers, const JobFunction& job);
+
+private:
+    // This is a static class (no instances).
+    KcJobPool()  = delete;
+    ~KcJobPool() = delete;
+};
+
+#endif  // RGA_RADEONGPUANALYZERCLI_SRC_KC_JOB_POOL_H_
@@ -18,6 +18,7 @@
 
 // Backend.
 #include "radeon_gpu_analyzer_backend/be_program_builder_opencl.h"
+#include "radeon_gpu_analyzer_backend/be_static_isa_analyzer.h"
 // Local.
 #include "radeon_gpu_analyzer_cli/kc_config.h"
 #include "radeon_gpu_analyzer_cli/kc_parse_cmd_line.h"
@@ -29,6 +30,7 @@
 #include "radeon_gpu_analyzer_cli/kc_cli_commander_binary.h"
 #include "radeon_gpu_analyzer_cli/kc_utils.h"
 #include "radeon_gpu_analyzer_cli/kc_cli_commander_lightning.h"
+#include "radeon_gpu_analyzer_cli/kc_compilation_cache.h"
 #ifdef _WIN32
 #include "radeon_gpu_analyzer_cli/kc_cli_commander_dx11.h"
 #include "radeon_gpu_analyzer_cli/kc_cli_commander_dx12.h"
@@ -77,6 +79,12 @@ int main(int argc, char* argv[])
     status = status && ParseCmdLine(argc, argv, config);
     status = status && KcUtils::InitCLILogFile(config);
 
+    if (status)
+    {
+        KcCompilationCache::Configure(config);
+        BeStaticIsaAnalyzer::SetInProcessEngineEnabled(config.is_isa_analysis_engine_enabled);
+    }
+
     // Create corresponding Commander object.
     std::shared_ptr<KcCliCommander> commander = nullptr;
     if (status)
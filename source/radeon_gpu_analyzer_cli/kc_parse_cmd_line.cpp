@@ -104,6 +104,19 @@ static const char* kStrDescriptionCO       = "Full path to the code object input
 static const char* kStrOptionDisTxt        = "disassemble";
 static const char* kStrDescriptionDisTxt   = "Path to output text file where text disassembly of the binary would be saved.";
 static const char* kStrOptionIl            = "il";
+static const char* kStrOptionJobs          = "j,jobs";
+static const char* kStrDescriptionJobs     = "Maximum number of target GPUs (or input code objects in Binary Analysis mode) to process in parallel, and of ISA files to run the live register and control flow analyses on in parallel. Use 0 to run as many jobs as there are hardware threads. Default is 1.";
+static const char* kStrOptionCacheDir      = "cache-dir";
+static const char* kStrDescriptionCacheDir = "Path to the folder of the compilation cache, which keeps compilation outputs for reuse by later RGA runs. "
+                                             "Default is the \"rga_cache\" folder under the system temp folder.";
+static const char* kStrOptionCacheSize      = "cache-size";
+static const char* kStrDescriptionCacheSize = "Maximum size of the compilation cache in MB. Least recently used entries are evicted when the cache grows beyond it. "
+                                              "Use 0 for an unlimited cache. Default is 1024.";
+static const char* kStrOptionNoCache       = "no-cache";
+static const char* kStrDescriptionNoCache  = "Do not use the compilation cache: always compile from scratch.";
+static const char* kStrOptionIsaAnalysisEngine      = "isa-analysis-engine";
+static const char* kStrDescriptionIsaAnalysisEngine = "Perform live register analysis and control flow graph generation with the built-in ISA analysis engine "
+                                                      "instead of the external analyzer. The external analyzer is still used for ISA that the engine cannot analyze.";
 
 static const char* kStrVulkanStageVertexFullPath                 = "Full path to vertex shader input file.";
 static const char* kStrVulkanStageTessellationControlFullPath    = "Full path to tessellation control shader input file.";
@@ -148,6 +161,11 @@ bool ParseCmdLine(int argc, char* argv[], Config& config)
             (kStrOptionSourceKind, kStrDescriptionSourceKind, po::value<std::string>(config.source_kind))
             (kStrOptionUpdates, kStrDescriptionUpdates)
             (kStrOptionVerbose, kStrDescriptionVerbose)
+            (kStrOptionJobs, kStrDescriptionJobs, po::value<unsigned>(config.jobs))
+            (kStrOptionCacheDir, kStrDescriptionCacheDir, po::value<std::string>(config.cache_dir))
+            (kStrOptionCacheSize, kStrDescriptionCacheSize, po::value<unsigned>(config.cache_size_mb))
+            (kStrOptionNoCache, kStrDescriptionNoCache)
+            (kStrOptionIsaAnalysisEngine, kStrDescriptionIsaAnalysisEngine)
             ;
 
         // DX Options
@@ -191,6 +209,9 @@ bool ParseCmdLine(int argc, char* argv[], Config& config)
                 "a Code Object type binary, the ISA would be generated for the entire program, since the binary has no per-kernel code sections.\n",
               po::value<std::string>(config.function))
             ("OpenCLoption", "OpenCL compiler options.  Repeatable.", po::value<std::vector<std::string>>(config.opencl_options))
+            ("cycles", "Path to output cycle estimate file(s). For each target GPU, a CSV file lists the kernels ranked by their estimated "
+                "number of cycles per wavefront (minimum, typical and maximum), as statically computed from the ISA control flow and "
+                "the per-instruction cycle counts, without running on hardware.", po::value<std::string>(config.cycle_estimate_file))
             ;
 
         // Vulkan shader type.
@@ -522,6 +543,16 @@ bool ParseCmdLine(int argc, char* argv[], Config& config)
             config.print_process_cmd_line = true;
         }
 
+        if (result.count(kStrOptionNoCache))
+        {
+            config.is_cache_disabled = true;
+        }
+
+        if (result.count(kStrOptionIsaAnalysisEngine))
+        {
+            config.is_isa_analysis_engine_enabled = true;
+        }
+
         if (result.count("debug-layer"))
         {
             config.dx12_debug_layer_enabled = true;
@@ -613,6 +644,7 @@ bool ParseCmdLine(int argc, char* argv[], Config& config)
                  !config.metadata_file.empty() || 
                  !config.block_cfg_file.empty() ||
                  !config.inst_cfg_file.empty() || 
+                 !config.cycle_estimate_file.empty() ||
                  !config.spv_txt.empty() || 
                  !config.spv_bin.empty() ||
                  !config.parsed_spv.empty())
@@ -1086,6 +1118,11 @@ bool ParseCmdLine(int argc, char* argv[], Config& config)
                 (kStrOptionSourceKind, kStrDescriptionSourceKind, po::value<std::string>())
                 (kStrOptionUpdates, kStrDescriptionUpdates)
                 (kStrOptionVerbose, kStrDescriptionVerbose)
+                (kStrOptionJobs, kStrDescriptionJobs, po::value<unsigned>())
+                (kStrOptionCacheDir, kStrDescriptionCacheDir, po::value<std::string>())
+                (kStrOptionCacheSize, kStrDescriptionCacheSize, po::value<unsigned>())
+                (kStrOptionNoCache, kStrDescriptionNoCache)
+                (kStrOptionIsaAnalysisEngine, kStrDescriptionIsaAnalysisEngine)
                 ;
             binary_opts.add_options(binary_opt)
                 (kStrOptionCO, kStrDescriptionCO)
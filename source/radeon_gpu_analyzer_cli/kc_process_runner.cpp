@@ -0,0 +1,451 @@
+//=============================================================================
+/// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Implementation for a pipe-based runner of external processes.
+//=============================================================================
+
+#ifndef _WIN32
+
+// C++.
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <csignal>
+
+// Linux.
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// Local.
+#include "radeon_gpu_analyzer_cli/kc_process_runner.h"
+
+// Size of the chunks in which process output is read from the pipes.
+static const size_t kProcessReadChunkSize = 64 * 1024;
+
+// Poll interval used to detect the termination of a process that closed its output streams,
+// on systems that do not provide process file descriptors.
+static const int kProcessReapPollIntervalMs = 10;
+
+// Poll interval used to check the cancel signal of a process.
+static const int kProcessCancelPollIntervalMs = 100;
+
+// Exit code reported by the child if the executable cannot be started.
+static const int kProcessExecFailedExitCode = 127;
+
+typedef std::chrono::steady_clock Clock;
+
+// The state of a launched process.
+struct KcRunningProcess
+{
+    // The process description and results.
+    KcProcess* process = nullptr;
+
+    // The process id.
+    pid_t pid = -1;
+
+    // Read ends of the stdout and stderr pipes (-1 when closed).
+    int out_fd = -1;
+    int err_fd = -1;
+
+    // Process file descriptor that becomes readable when the process terminates (-1 if not available).
+    int pid_fd = -1;
+
+    // True if the process time out is enforced, and the point in time when it expires.
+    bool              has_deadline = false;
+    Clock::time_point deadline;
+
+    // True after the process was reaped.
+    bool is_reaped = false;
+};
+
+// Close a file descriptor and mark it as closed.
+static void CloseFd(int& fd)
+{
+    if (fd != -1)
+    {
+        close(fd);
+        fd = -1;
+    }
+}
+
+// Split a command line into arguments: arguments are separated by white space, and quotes
+// (single or double) group the text between them into the current argument.
+static std::vector<std::string> SplitArguments(const std::string& args)
+{
+    std::vector<std::string> ret;
+    std::string              current;
+    bool                     is_in_argument = false;
+    char                     quote          = 0;
+    for (char c : args)
+    {
+        if (quote != 0)
+        {
+            if (c == quote)
+            {
+                quote = 0;
+            }
+            else
+            {
+                current.push_back(c);
+            }
+        }
+        else if (c == '"' || c == '\'')
+        {
+            quote          = c;
+            is_in_argument = true;
+        }
+        else if (c == ' ' || c == '\t' || c == '\n' || c == '\r')
+        {
+            if (is_in_argument)
+            {
+                ret.push_back(current);
+                current.clear();
+                is_in_argument = false;
+            }
+        }
+        else
+        {
+            current.push_back(c);
+            is_in_argument = true;
+        }
+    }
+    if (is_in_argument)
+    {
+        ret.push_back(current);
+    }
+    return ret;
+}
+
+// Open a process file descriptor for the given process. Returns -1 if not supported.
+static int OpenPidFd(pid_t pid)
+{
+    int ret = -1;
+#ifdef SYS_pidfd_open
+    ret = static_cast<int>(syscall(SYS_pidfd_open, pid, 0));
+#else
+    (void)pid;
+#endif
+    return ret;
+}
+
+// Launch the given process with its stdout and stderr redirected to pipes.
+// Returns false if the process could not be started.
+static bool StartProcess(KcProcess& process, KcRunningProcess& running)
+{
+    bool ret = false;
+    running.process = &process;
+
+    // Prepare the argument vector before forking: the child must not allocate memory.
+    std::vector<std::string> args = SplitArguments(process.args);
+    args.insert(args.begin(), process.exec_path);
+    std::vector<char*> argv;
+    argv.reserve(args.size() + 1);
+    for (std::string& arg : args)
+    {
+        argv.push_back(&arg[0]);
+    }
+    argv.push_back(nullptr);
+    const char* dir = process.dir.empty() ? nullptr : process.dir.c_str();
+
+    // The exec pipe is closed by a successful exec (close-on-exec), or receives errno if exec fails.
+    int out_pipe[2]  = {-1, -1};
+    int err_pipe[2]  = {-1, -1};
+    int exec_pipe[2] = {-1, -1};
+    if (pipe2(out_pipe, O_CLOEXEC) == 0 && pipe2(err_pipe, O_CLOEXEC) == 0 && pipe2(exec_pipe, O_CLOEXEC) == 0)
+    {
+        running.pid = fork();
+        if (running.pid == 0)
+        {
+            // Child process: only async-signal-safe calls from here on.
+            int null_fd = open("/dev/null", O_RDONLY);
+            if (null_fd != -1)
+            {
+                dup2(null_fd, STDIN_FILENO);
+            }
+            dup2(out_pipe[1], STDOUT_FILENO);
+            dup2(err_pipe[1], STDERR_FILENO);
+            if (dir == nullptr || chdir(dir) == 0)
+            {
+                execvp(argv[0], argv.data());
+            }
+            int error = errno;
+            ssize_t written = write(exec_pipe[1], &error, sizeof(error));
+            (void)written;
+            _exit(kProcessExecFailedExitCode);
+        }
+        else if (running.pid > 0)
+        {
+            CloseFd(out_pipe[1]);
+            CloseFd(err_pipe[1]);
+            CloseFd(exec_pipe[1]);
+
+            // Wait for the exec to complete or to fail.
+            int     error      = 0;
+            ssize_t bytes_read = 0;
+            do
+            {
+                bytes_read = read(exec_pipe[0], &error, sizeof(error));
+            } while (bytes_read == -1 && errno == EINTR);
+
+            ret = (bytes_read == 0);
+            if (ret)
+            {
+                running.out_fd = out_pipe[0];
+                running.err_fd = err_pipe[0];
+                out_pipe[0] = err_pipe[0] = -1;
+                fcntl(running.out_fd, F_SETFL, fcntl(running.out_fd, F_GETFL) | O_NONBLOCK);
+                fcntl(running.err_fd, F_SETFL, fcntl(running.err_fd, F_GETFL) | O_NONBLOCK);
+                running.pid_fd = OpenPidFd(running.pid);
+
+                running.has_deadline = (process.time_out != kProcessWaitInfinite);
+                if (running.has_deadline)
+                {
+                    running.deadline = Clock::now() + std::chrono::milliseconds(process.time_out);
+                }
+            }
+            else
+            {
+                int status = 0;
+                waitpid(running.pid, &status, 0);
+                running.is_reaped = true;
+            }
+        }
+    }
+
+    for (int fd : {out_pipe[0], out_pipe[1], err_pipe[0], err_pipe[1], exec_pipe[0], exec_pipe[1]})
+    {
+        if (fd != -1)
+        {
+            close(fd);
+        }
+    }
+
+    return ret;
+}
+
+// Read everything that is currently available from the given pipe into the given buffer.
+// Closes the pipe at end of stream.
+static void DrainPipe(int& fd, std::string& buffer)
+{
+    char chunk[kProcessReadChunkSize];
+    bool is_done = false;
+    while (!is_done)
+    {
+        ssize_t bytes_read = read(fd, chunk, sizeof(chunk));
+        if (bytes_read > 0)
+        {
+            buffer.append(chunk, static_cast<size_t>(bytes_read));
+        }
+        else if (bytes_read == -1 && errno == EINTR)
+        {
+            continue;
+        }
+        else
+        {
+            // End of stream, or an error other than "no data available yet".
+            if (bytes_read == 0 || (errno != EAGAIN && errno != EWOULDBLOCK))
+            {
+                CloseFd(fd);
+            }
+            is_done = true;
+        }
+    }
+}
+
+// Reap the given process if it terminated. If "should_block" is true, wait for it to terminate.
+static void ReapProcess(KcRunningProcess& running, bool should_block)
+{
+    int   status = 0;
+    pid_t result = 0;
+    do
+    {
+        result = waitpid(running.pid, &status, should_block ? 0 : WNOHANG);
+    } while (result == -1 && errno == EINTR);
+
+    if (result == running.pid)
+    {
+        running.is_reaped = true;
+        if (WIFEXITED(status))
+        {
+            running.process->exit_code = WEXITSTATUS(status);
+        }
+        else if (WIFSIGNALED(status))
+        {
+            running.process->exit_code = 128 + WTERMSIG(status);
+        }
+    }
+    else if (result == -1)
+    {
+        // The process cannot be waited for (should not happen): consider it terminated.
+        running.is_reaped = true;
+    }
+
+    if (running.is_reaped)
+    {
+        CloseFd(running.pid_fd);
+    }
+}
+
+// Kill the given process, reap it and stop reading its output.
+static void KillProcess(KcRunningProcess& running, KcUtils::ProcessStatus status)
+{
+    if (!running.is_reaped)
+    {
+        kill(running.pid, SIGKILL);
+        ReapProcess(running, true);
+    }
+    CloseFd(running.out_fd);
+    CloseFd(running.err_fd);
+    running.process->status = status;
+}
+
+// Returns true if the given process terminated and its output was fully read.
+static bool IsProcessDone(const KcRunningProcess& running)
+{
+    return running.is_reaped && running.out_fd == -1 && running.err_fd == -1;
+}
+
+void KcProcessRunner::Run(std::vector<KcProcess>& processes)
+{
+    // Launch all processes.
+    std::vector<KcRunningProcess> running_processes;
+    running_processes.reserve(processes.size());
+    for (KcProcess& process : processes)
+    {
+        process.std_out.clear();
+        process.std_err.clear();
+        process.exit_code = 0;
+
+        KcRunningProcess running;
+        if (StartProcess(process, running))
+        {
+            process.status = KcUtils::ProcessStatus::kSuccess;
+            running_processes.push_back(running);
+        }
+        else
+        {
+            process.status = KcUtils::ProcessStatus::kLaunchFailed;
+        }
+    }
+
+    // Drain the output streams of all processes and reap them as they terminate.
+    std::vector<pollfd>            poll_fds;
+    std::vector<KcRunningProcess*> poll_owners;
+    while (!running_processes.empty())
+    {
+        poll_fds.clear();
+        poll_owners.clear();
+        int        timeout_ms = -1;
+        const auto now        = Clock::now();
+        for (KcRunningProcess& running : running_processes)
+        {
+            for (int fd : {running.out_fd, running.err_fd, running.pid_fd})
+            {
+                if (fd != -1)
+                {
+                    poll_fds.push_back({fd, POLLIN, 0});
+                    poll_owners.push_back(&running);
+                }
+            }
+
+            // Without a process file descriptor, termination after the streams were closed is detected by polling.
+            if (!running.is_reaped && running.pid_fd == -1 && running.out_fd == -1 && running.err_fd == -1)
+            {
+                timeout_ms = (timeout_ms == -1 ? kProcessReapPollIntervalMs : std::min(timeout_ms, kProcessReapPollIntervalMs));
+            }
+
+            if (running.process->cancel_signal != nullptr)
+            {
+                timeout_ms = (timeout_ms == -1 ? kProcessCancelPollIntervalMs : std::min(timeout_ms, kProcessCancelPollIntervalMs));
+            }
+
+            if (running.has_deadline)
+            {
+                const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(running.deadline - now).count() + 1;
+                const int  remaining_ms = static_cast<int>(std::clamp<long long>(remaining, 0, INT_MAX));
+                timeout_ms              = (timeout_ms == -1 ? remaining_ms : std::min(timeout_ms, remaining_ms));
+            }
+        }
+
+        int ready_count = poll(poll_fds.data(), poll_fds.size(), timeout_ms);
+        if (ready_count > 0)
+        {
+            for (size_t i = 0; i < poll_fds.size(); i++)
+            {
+                if (poll_fds[i].revents != 0)
+                {
+                    KcRunningProcess& running = *poll_owners[i];
+                    if (poll_fds[i].fd == running.out_fd)
+                    {
+                        DrainPipe(running.out_fd, running.process->std_out);
+                    }
+                    else if (poll_fds[i].fd == running.err_fd)
+                    {
+                        DrainPipe(running.err_fd, running.process->std_err);
+                    }
+                    else if (poll_fds[i].fd == running.pid_fd)
+                    {
+                        ReapProcess(running, false);
+                    }
+                }
+            }
+        }
+        else if (ready_count == -1 && errno != EINTR)
+        {
+            // Polling failed (should not happen): drain whatever is available from every pipe, and check
+            // for termination, at a fixed interval. The pipes stay non-blocking, so neither stream can
+            // stall the other.
+            for (KcRunningProcess& running : running_processes)
+            {
+                if (running.out_fd != -1)
+                {
+                    DrainPipe(running.out_fd, running.process->std_out);
+                }
+                if (running.err_fd != -1)
+                {
+                    DrainPipe(running.err_fd, running.process->std_err);
+                }
+                if (!running.is_reaped)
+                {
+                    ReapProcess(running, false);
+                }
+            }
+            usleep(kProcessReapPollIntervalMs * 1000);
+        }
+
+        // Handle terminated and timed out processes.
+        const auto check_time = Clock::now();
+        for (KcRunningProcess& running : running_processes)
+        {
+            if (!running.is_reaped && running.pid_fd == -1 && running.out_fd == -1 && running.err_fd == -1)
+            {
+                ReapProcess(running, false);
+            }
+
+            if (!IsProcessDone(running) && running.process->cancel_signal != nullptr && *running.process->cancel_signal)
+            {
+                KillProcess(running, KcUtils::ProcessStatus::kLaunchFailed);
+            }
+            else if (!IsProcessDone(running) && running.has_deadline && check_time >= running.deadline)
+            {
+                KillProcess(running, KcUtils::ProcessStatus::kTimeOut);
+            }
+        }
+        running_processes.erase(std::remove_if(running_processes.begin(), running_processes.end(), IsProcessDone), running_processes.end());
+    }
+}
+
+void KcProcessRunner::Run(KcProcess& process)
+{
+    std::vector<KcProcess> processes(1);
+    processes[0] = std::move(process);
+    Run(processes);
+    process = std::move(processes[0]);
+}
+
+#endif  // !_WIN32
@@ -0,0 +1,66 @@
+//=============================================================================
+/// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief Header for a pipe-based runner of external processes.
+//=============================================================================
+#ifndef RGA_RADEONGPUANALYZERCLI_SRC_KC_PROCESS_RUNNER_H_
+#define RGA_RADEONGPUANALYZERCLI_SRC_KC_PROCESS_RUNNER_H_
+
+// C++.
+#include <string>
+#include <vector>
+
+// Local.
+#include "radeon_gpu_analyzer_cli/kc_utils.h"
+
+// An external process to be launched by KcProcessRunner, and the results of its execution.
+struct KcProcess
+{
+    // The executable path (searched in PATH if it does not contain a slash).
+    std::string exec_path;
+
+    // Command line arguments. Arguments are separated by white space, and quoted substrings are not split.
+    std::string args;
+
+    // Working directory for the process. If empty, the current directory is used.
+    std::string dir;
+
+    // Process time out in milliseconds (kProcessWaitInfinite for no time out).
+    unsigned long time_out = kProcessWaitInfinite;
+
+    // If not null, the process is killed once the pointed flag is set, and reported as kLaunchFailed.
+    bool* cancel_signal = nullptr;
+
+    // The status of the process launch.
+    KcUtils::ProcessStatus status = KcUtils::ProcessStatus::kSuccess;
+
+    // The content of the stdout and stderr streams dumped by the process.
+    std::string std_out;
+    std::string std_err;
+
+    // The exit code returned by the process.
+    long exit_code = 0;
+};
+
+// Launches external processes and collects their output through pipes.
+// The stdout and stderr streams of all processes in flight are drained concurrently into growable
+// buffers by a single poll() loop, so a process never blocks on a full pipe and no temporary files are used.
+// Process termination is detected through the poll() loop as well, and time outs and cancel signals are enforced.
+// This class is only available on Linux.
+class KcProcessRunner
+{
+public:
+    // Launch all given processes and wait until every one of them terminated or timed out.
+    static void Run(std::vector<KcProcess>& processes);
+
+    // Launch the given process and wait until it terminated or timed out.
+    static void Run(KcProcess& process);
+
+private:
+    // This is a static class (no instances).
+    KcProcessRunner()  = delete;
+    ~KcProcessRunner() = delete;
+};
+
+#endif  // RGA_RADEONGPUANALYZERCLI_SRC_KC_PROCESS_RUNNER_H_
@@ -4,6 +4,11 @@
 /// @file
 /// @brief Implementation for CLI utility functions.
 //=============================================================================
+// C++.
+#include <iterator>
+#include <mutex>
+#include <set>
+
 // XML.
 #include "tinyxml2.h"
 
@@ -32,6 +37,8 @@
 #include "radeon_gpu_analyzer_cli/kc_utils.h"
 #include "radeon_gpu_analyzer_cli/kc_cli_string_constants.h"
 #include "radeon_gpu_analyzer_cli/kc_cli_commander.h"
+#include "radeon_gpu_analyzer_cli/kc_job_pool.h"
+#include "radeon_gpu_analyzer_cli/kc_process_runner.h"
 #include "common/rga_xml_constants.h"
 #include "common/rga_shared_utils.h"
 #include "common/rg_log.h"
@@ -49,10 +56,6 @@ using namespace beKA;
 static const gtString  kRgaCliLogFileName           = L"rga_cli";
 static const gtString  kRgaCliLogFileExt            = L"log";
 static const gtString  kRgaCliParsedIsaFileExt      = L"csv";
-static const gtString  kRgaCliTempStdoutFilename    = L"rga_stdout";
-static const gtString  kRgaCliTempStdoutFileExt     = L"txt";
-static const gtString  kRgaCliTempStderrFilename    = L"rga_stderr";
-static const gtString  kRgaCliTempStderrFileExt     = L"txt";
 static const char*     kStrFopenModeAppend          = "a";
 
 // Constants: error messages.
@@ -573,11 +576,10 @@ bool KcUtils::PerformLiveRegisterAnalysis(const std::string&      isa_filename,
     return PerformLiveRegisterAnalysis(isa_name_gtstr, target_gtstr, output_filename_gtstr, callback, print_cmd, is_reg_type_sgpr);
 }
 
-bool KcUtils::GenerateControlFlowGraph(const gtString& isa_file_name, const gtString& target, const gtString& output_filename,
-                                       LoggingCallbackFunction callback, bool per_inst_cfg, bool printCmd)
+// Evaluates the result of a backend CFG generation. Prints the relevant message.
+// Returns true if the CFG was generated, false otherwise.
+static bool EvaluateCfgResult(beStatus rc, LoggingCallbackFunction callback)
 {
-    // Call the backend.
-    beStatus rc = BeStaticIsaAnalyzer::GenerateControlFlowGraph(isa_file_name, target, output_filename, per_inst_cfg, printCmd);
     if (rc != kBeStatusSuccess && callback != nullptr)
     {
         // Inform the user in case of an error.
@@ -621,6 +623,14 @@ bool KcUtils::GenerateControlFlowGraph(const gtString& isa_file_name, const gtSt
     return (rc == kBeStatusSuccess);
 }
 
+bool KcUtils::GenerateControlFlowGraph(const gtString& isa_file_name, const gtString& target, const gtString& output_filename,
+                                       LoggingCallbackFunction callback, bool per_inst_cfg, bool printCmd)
+{
+    // Call the backend.
+    beStatus rc = BeStaticIsaAnalyzer::GenerateControlFlowGraph(isa_file_name, target, output_filename, per_inst_cfg, printCmd);
+    return EvaluateCfgResult(rc, callback);
+}
+
 bool KcUtils::GenerateControlFlowGraph(const std::string& isa_filename, const std::string& target, const std::string& output_filename,
     LoggingCallbackFunction pCallback, bool per_inst_cfg, bool print_cmd)
 {
@@ -636,6 +646,23 @@ bool KcUtils::GenerateControlFlowGraph(const std::string& isa_filename, const st
     return GenerateControlFlowGraph(isa_name_gtstr, target_gtstr, output_filename_gtstr, pCallback, per_inst_cfg, print_cmd);
 }
 
+void KcUtils::PerformStaticIsaAnalyses(std::vector<beKA::BeStaticIsaAnalysisRequest>& requests, const Config& config)
+{
+    // Analyze the ISA files on the job pool, up to config.jobs files at a time. All the analyses of a file run in the same job.
+    std::vector<std::vector<size_t>> file_requests;
+    BeStaticIsaAnalyzer::GroupRequestsByFile(requests, file_requests);
+    KcJobPool::Run(file_requests.size(), config.jobs, [&](size_t file_index) {
+        BeStaticIsaAnalyzer::PerformFileAnalyses(requests, file_requests[file_index], config.print_process_cmd_line);
+    });
+}
+
+bool KcUtils::ReportStaticIsaAnalysisResult(const beKA::BeStaticIsaAnalysisRequest& request, LoggingCallbackFunction callback)
+{
+    const bool is_cfg = (request.type == beKA::BeStaticIsaAnalysisType::kCfgPerBlock ||
+                         request.type == beKA::BeStaticIsaAnalysisType::kCfgPerInstruction);
+    return (is_cfg ? EvaluateCfgResult(request.status, callback) : EvaluateAnalysisResult(request.status, callback));
+}
+
 void KcUtils::ConstructOutputFileName(const std::string& base_output_filename, const std::string& default_suffix,
                                       const std::string& default_extension, const std::string& kernel_name,
                                       const std::string& device_name, gtString& generated_filename)
@@ -807,10 +834,23 @@ gtString KcUtils::ConstructTempFileName(const gtString& prefix, const gtString &
         temp_file_path.setFileName(temp_filename);
 
         // Ensure that the file name is unique for any invocation by the existing CLI process.
-        static unsigned unique_suffix = 0;
+        // Compilation jobs may run concurrently, so names that were handed out but not yet created
+        // on disk are also considered taken.
+        static unsigned              unique_suffix = 0;
+        static std::set<std::string> reserved_names;
+        static std::mutex            reserved_names_lock;
+        std::lock_guard<std::mutex>  lock(reserved_names_lock);
+
+        // Release the names whose files were created: the existence check covers them from now on.
+        for (auto reserved_name = reserved_names.begin(); reserved_name != reserved_names.end();)
+        {
+            gtString reserved_name_gtstr;
+            reserved_name_gtstr << reserved_name->c_str();
+            reserved_name = osFilePath(reserved_name_gtstr).exists() ? reserved_names.erase(reserved_name) : std::next(reserved_name);
+        }
 
         uint32_t suffix_num = 0;
-        while (temp_file_path.exists() && suffix_num < kMAX_ATTEMPTS)
+        while ((temp_file_path.exists() || reserved_names.count(temp_file_path.asString().asASCIICharArray()) > 0) && suffix_num < kMAX_ATTEMPTS)
         {
             temp_filename = temp_file_base_name;
             temp_filename.appendUnsignedIntNumber(suffix_num++);
@@ -821,6 +861,10 @@ gtString KcUtils::ConstructTempFileName(const gtString& prefix, const gtString &
         }
 
         ret = suffix_num < kMAX_ATTEMPTS ? temp_file_path.asString() : L"";
+        if (!ret.isEmpty())
+        {
+            reserved_names.insert(ret.asASCIICharArray());
+        }
     }
 
     return ret;
@@ -1158,7 +1202,7 @@ void KcUtils::PrintRgaVersion()
 
 #ifdef _WIN32
 KcUtils::ProcessStatus KcUtils::LaunchProcess(const std::string& exec_path, const std::string& args, const std::string& dir,
-    unsigned long, bool print_cmd, std::string& std_out, std::string& std_err, long& exit_code)
+    unsigned long, bool print_cmd, std::string& std_out, std::string& std_err, long& exit_code, bool* cancel_signal)
 {
     ProcessStatus status = ProcessStatus::kSuccess;
     exit_code = 0;
@@ -1196,7 +1240,7 @@ KcUtils::ProcessStatus KcUtils::LaunchProcess(const std::string& exec_path, cons
     gtString working_dir = work_dir.asString();
     gtString cmd_output;
     gtString cmd_output_err;
-    bool is_launch_success = osExecAndGrabOutputAndError(cmd.str().c_str(), should_cancel,
+    bool is_launch_success = osExecAndGrabOutputAndError(cmd.str().c_str(), cancel_signal != nullptr ? *cancel_signal : should_cancel,
         working_dir, cmd_output, cmd_output_err);
 
     // Read stdout and stderr.
@@ -1289,106 +1333,32 @@ KcUtils::ProcessStatus KcUtils::LaunchProcess(const std::string& exec_path,
 
 #else
 KcUtils::ProcessStatus KcUtils::LaunchProcess(const std::string& exec_path, const std::string& args, const std::string& dir,
-    unsigned long time_out, bool print_cmd, std::string& std_out, std::string& std_err, long& exit_code)
+    unsigned long time_out, bool print_cmd, std::string& std_out, std::string& std_err, long& exit_code, bool* cancel_signal)
 {
-    osProcessId      compiler_proc_id;
-    osProcessHandle  compiler_proc_handle;
-    osThreadHandle   compiler_thread_handle;
-    ProcessStatus    status = ProcessStatus::kSuccess;
-
-    // Set working directory, executable and arguments.
-    osFilePath  work_dir;
-    if (dir == "")
-    {
-        work_dir.setPath(osFilePath::OS_CURRENT_DIRECTORY);
-    }
-    else
-    {
-        gtString  dir_gtstr;
-        dir_gtstr << dir.c_str();
-        work_dir.setFileDirectory(dir_gtstr);
-    }
-
-    gtString exec_path_gtstr, args_gtstr;
-    exec_path_gtstr << exec_path.c_str();
-    args_gtstr << args.c_str();
+    std::stringstream msg;
+    msg << kStrLaunchingExternalProcess << exec_path << " " << args;
 
-    // Create temporary files for stdout/stderr.
-    gtString  out_filename = KcUtils::ConstructTempFileName(kRgaCliTempStdoutFilename, kRgaCliTempStdoutFileExt);
-    gtString  err_filename = KcUtils::ConstructTempFileName(kRgaCliTempStderrFilename, kRgaCliTempStderrFileExt);
+    RgLog::file << msg.str() << std::endl;
 
-    if (out_filename.isEmpty() || err_filename.isEmpty())
-    {
-        status = ProcessStatus::kCreateTempFileFailed;
-    }
-    else
+    if (print_cmd)
     {
-        std::stringstream msg;
-        msg << kStrLaunchingExternalProcess << exec_path_gtstr.asASCIICharArray()
-            << " " << args_gtstr.asASCIICharArray();
-
-        RgLog::file << msg.str() << std::endl;
-
-        if (print_cmd)
-        {
-            RgLog::stdOut << msg.str() << std::endl;
-        }
-
-        args_gtstr += L" >";
-        args_gtstr += out_filename;
-        args_gtstr += L" 2>";
-        args_gtstr += err_filename;
-
-        // Launch a process.
-        bool  proc_status = osLaunchSuspendedProcess(exec_path_gtstr,
-            args_gtstr,
-            work_dir,
-            compiler_proc_id,
-            compiler_proc_handle,
-            compiler_thread_handle,
-            false,  // Don't create a window
-            true);  // Redirect stdout & stderr
-
-        if (proc_status && osResumeSuspendedProcess(compiler_proc_id, compiler_proc_handle, compiler_thread_handle, false))
-        {
-            proc_status = osWaitForProcessToTerminate(compiler_proc_id, time_out, &exit_code);
-
-            if (!proc_status)
-            {
-                osTerminateProcess(compiler_proc_id);
-                status = ProcessStatus::kTimeOut;
-            }
-        }
-        else
-        {
-            status = ProcessStatus::kLaunchFailed;
-        }
+        RgLog::stdOut << msg.str() << std::endl;
     }
 
-    // Read the content of stderr and stdout files.
-    std_out = std_err = "";
-    if (status == ProcessStatus::kSuccess)
-    {
-        if (FileNotEmpty(out_filename.asASCIICharArray()))
-        {
-            if (!KcUtils::ReadTextFile(out_filename.asASCIICharArray(), std_out, nullptr))
-            {
-                status = ProcessStatus::kReadTempFileFailed;
-            }
-            std::remove(out_filename.asASCIICharArray());
-        }
+    // Launch the process. Its stdout and stderr are collected through pipes while it runs.
+    KcProcess process;
+    process.exec_path = exec_path;
+    process.args      = args;
+    process.dir       = dir;
+    process.time_out      = time_out;
+    process.cancel_signal = cancel_signal;
+    KcProcessRunner::Run(process);
 
-        if (FileNotEmpty(err_filename.asASCIICharArray()))
-        {
-            if (!KcUtils::ReadTextFile(err_filename.asASCIICharArray(), std_err, nullptr))
-            {
-                status = ProcessStatus::kReadTempFileFailed;
-            }
-            std::remove(err_filename.asASCIICharArray());
-        }
-    }
+    std_out   = std::move(process.std_out);
+    std_err   = std::move(process.std_err);
+    exit_code = process.exit_code;
 
-    return status;
+    return process.status;
 }
 #endif
 
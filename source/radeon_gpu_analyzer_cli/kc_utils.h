@@ -11,6 +11,7 @@
 #include <string>
 #include <sstream>
 #include <map>
+#include <vector>
 
 // Infra.
 #include "external/amdt_base_tools/Include/gtString.h"
@@ -18,6 +19,7 @@
 // Backend.
 #include "radeon_gpu_analyzer_backend/be_data_types.h"
 #include "radeon_gpu_analyzer_backend/be_include.h"
+#include "radeon_gpu_analyzer_backend/be_static_isa_analyzer.h"
 
 // Local.
 #include "radeon_gpu_analyzer_cli/kc_data_types.h"
@@ -156,6 +158,18 @@ public:
     static bool GenerateControlFlowGraph(const std::string& isa_file_name, const std::string& target, const std::string& outputFileName,
         LoggingCallbackFunction callback, bool perInstCfg, bool print_cmd);
 
+    // Performs a batch of live register analyses and CFG generations in one backend request.
+    // The ISA files are analyzed on up to config.jobs threads. The status of each analysis is stored in its request.
+    // requests - the analyses to perform
+    // config - the CLI configuration
+    static void PerformStaticIsaAnalyses(std::vector<beKA::BeStaticIsaAnalysisRequest>& requests, const Config& config);
+
+    // Reports the result of an analysis of a batch, the same way PerformLiveRegisterAnalysis() and GenerateControlFlowGraph() do.
+    // request - the analysis, after the batch was performed
+    // callback - callback to log messages
+    // Returns true if the analysis succeeded.
+    static bool ReportStaticIsaAnalysisResult(const beKA::BeStaticIsaAnalysisRequest& request, LoggingCallbackFunction callback);
+
     // Generates an output file name in the Analyzer CLI format.
     // base_output_filename - the base output file name as configured by the user's command
     // default_extension - default extension to use if user did not specify an extension for the output file
@@ -275,9 +289,11 @@ public:
     // \param[out] std_out     the content of stdout stream dumped by launched process
     // \param[out] std_err     the content of stderr stream dumped by launched process
     // \param[out] exit_code   the exit code returned by launched process
+    // \param[in]  cancel_signal  if not null, the process is terminated once the flag is set (reported as kLaunchFailed)
     // Returns status of process launch.
     static ProcessStatus LaunchProcess(const std::string& exec_path, const std::string& args, const std::string& dir,
-                                       unsigned long time_out, bool print_cmd, std::string& std_out, std::string& std_err, long& exit_code);
+                                       unsigned long time_out, bool print_cmd, std::string& std_out, std::string& std_err, long& exit_code,
+                                       bool* cancel_signal = nullptr);
 
 #ifdef _WIN32
     // Launch a process with provided executable name and command line arguments.
@@ -117,26 +117,14 @@ void ComputeBinaryWorkflowStrategy::RunPostProcessingSteps(const Config& config,
         util.ExtractStatistics(config);
     }
 
-    // Block post-processing until quality of analysis engine improves when processing llvm disassembly.
-    bool is_livereg_required = !config.livereg_analysis_file.empty();
-    if (is_livereg_required && (status == beKA::beStatus::kBeStatusSuccess))
-    {
-        // Perform Live Registers analysis if required.
-        util.PerformLiveVgprAnalysis(config);
-    }
-
+    // Perform the live register analyses and extract the Control Flow Graphs if required.
+    // All analyses of all kernels are submitted as a single batch.
+    bool is_livereg_required      = !config.livereg_analysis_file.empty();
     bool is_sgpr_livereg_required = !config.sgpr_livereg_analysis_file.empty();
-    if (is_sgpr_livereg_required && (status == beKA::beStatus::kBeStatusSuccess))
-    {
-        // Perform Live Registers analysis if required.
-        util.PerformLiveSgprAnalysis(config);
-    }
-
-    bool is_cfg_required = (!config.block_cfg_file.empty() || !config.inst_cfg_file.empty());
-    if (is_cfg_required && (status == beKA::beStatus::kBeStatusSuccess))
+    bool is_cfg_required          = (!config.block_cfg_file.empty() || !config.inst_cfg_file.empty());
+    if ((is_livereg_required || is_sgpr_livereg_required || is_cfg_required) && (status == beKA::beStatus::kBeStatusSuccess))
     {
-        // Extract Control Flow Graph.
-        util.ExtractCFG(config);
+        util.PerformStaticIsaAnalyses(config);
     }
 
     // Extract CodeObj metadata if required.
@@ -56,24 +56,22 @@ bool KcUtilsDxr::ParseIsaFilesToCSV(bool line_numbers) const
         if (output_md_item.second.status)
         {
             const RgOutputFiles& output_files = output_md_item.second;
-            std::string          isa, parsed_isa, parsed_isa_filename;
+            std::string          parsed_isa_filename;
             const std::string&   device = output_md_item.first.first;
             const std::string&   entry  = output_md_item.first.second;
 
-            bool status = KcUtils::ReadTextFile(output_files.isa_file, isa, nullptr);
+            bool status = KcUtils::FileNotEmpty(output_files.isa_file);
             if (status)
             {
-                if ((status = KcUtilsVulkan::GetParsedIsaCsvText(isa, device, line_numbers, parsed_isa)) == true)
+                status = (KcUtils::GetParsedISAFileName(output_files.isa_file, parsed_isa_filename) == beKA::kBeStatusSuccess);
+                if (status)
                 {
-                    status = (KcUtils::GetParsedISAFileName(output_files.isa_file, parsed_isa_filename) == beKA::kBeStatusSuccess);
-                    if (status)
-                    {
-                        status = (KcUtilsVulkan::WriteIsaToFile(parsed_isa_filename, parsed_isa, log_callback_) == beKA::kBeStatusSuccess);
-                    }
-                    if (status)
-                    {
-                        output_metadata_[{device, entry}].isa_csv_file = parsed_isa_filename;
-                    }
+                    // Stream the CSV rows straight to the output file.
+                    status = KcUtilsVulkan::WriteParsedIsaCsvFile(output_files.isa_file, device, line_numbers, parsed_isa_filename);
+                }
+                if (status)
+                {
+                    output_metadata_[{device, entry}].isa_csv_file = parsed_isa_filename;
                 }
 
                 if (!status)
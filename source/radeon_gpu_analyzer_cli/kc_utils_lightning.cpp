@@ -5,7 +5,11 @@
 /// @brief Implementation for OpenCL helper functions.
 //=============================================================================
 // C++
+#include <algorithm>
+#include <map>
+#include <mutex>
 #include <sstream>
+#include <vector>
 
 // External.
 #include "external/amdt_os_wrappers/Include/osFilePath.h"
@@ -102,24 +106,22 @@ bool KcUtilsLightning::ParseIsaFilesToCSV(bool line_numbers) const
         if (output_md_item.second.status)
         {
             const RgOutputFiles& output_files = output_md_item.second;
-            std::string          isa, parsed_isa, parsed_isa_filename;
+            std::string          parsed_isa_filename;
             const std::string&   device = output_md_item.first.first;
             const std::string&   entry  = output_md_item.first.second;
 
-            bool status = KcUtils::ReadTextFile(output_files.isa_file, isa, nullptr);
+            bool status = KcUtils::FileNotEmpty(output_files.isa_file);
             if (status)
             {
-                if ((status = KcUtilsLightning::GetParsedIsaCsvText(isa, device, line_numbers, parsed_isa)) == true)
+                status = (KcUtils::GetParsedISAFileName(output_files.isa_file, parsed_isa_filename) == beKA::kBeStatusSuccess);
+                if (status)
                 {
-                    status = (KcUtils::GetParsedISAFileName(output_files.isa_file, parsed_isa_filename) == beKA::kBeStatusSuccess);
-                    if (status)
-                    {
-                        status = (KcUtilsLightning::WriteIsaToFile(parsed_isa_filename, parsed_isa, log_callback_) == beKA::kBeStatusSuccess);
-                    }
-                    if (status)
-                    {
-                        output_metadata_[{device, entry}].isa_csv_file = parsed_isa_filename;
-                    }
+                    // Stream the CSV rows straight to the output file.
+                    status = KcUtilsLightning::WriteParsedIsaCsvFile(output_files.isa_file, device, line_numbers, parsed_isa_filename);
+                }
+                if (status)
+                {
+                    output_metadata_[{device, entry}].isa_csv_file = parsed_isa_filename;
                 }
 
                 if (!status)
@@ -134,210 +136,174 @@ bool KcUtilsLightning::ParseIsaFilesToCSV(bool line_numbers) const
     return ret;
 }
 
-bool KcUtilsLightning::PerformLiveVgprAnalysis(const Config& config) const
+// An analysis of a kernel in the batch of static ISA analyses.
+struct KcLightningAnalysisItem
 {
-    bool              ret = true;
-    std::stringstream error_msg;
+    // The analysis.
+    beKA::BeStaticIsaAnalysisType type;
 
-    for (auto& output_md_item : output_metadata_)
-    {
-        RgOutputFiles& output_files = output_md_item.second;
-        if (output_files.status)
-        {
-            const std::string& device               = output_md_item.first.first;
-            const std::string& entry_name           = output_md_item.first.second;
-            const std::string& entry_abbrivation    = output_md_item.second.entry_abbreviation;
-            gtString           livereg_out_filename = L"";
-            gtString           isa_filename;
-            isa_filename << output_files.isa_file.c_str();
-            gtString device_gtstr;
-            device_gtstr << device.c_str();
-
-            // Inform the user.
-            std::cout << kStrInfoPerformingLiveregAnalysisVgpr << device << kStrInfoOpenclOfflineKernelForKernel << entry_name << "... ";
-
-            // Construct a name for the output livereg file.
-            if (entry_abbrivation.empty())
-            {
-                KcUtils::ConstructOutputFileName(
-                    config.livereg_analysis_file, kStrDefaultExtensionLivereg, kStrDefaultExtensionText, entry_name, device, livereg_out_filename);
-            }
-            else
-            {
-                KcUtils::ConstructOutputFileName(
-                    config.livereg_analysis_file, kStrDefaultExtensionLivereg, kStrDefaultExtensionText, entry_abbrivation, device, livereg_out_filename);
-            }
+    // The output files of the analyzed kernel.
+    RgOutputFiles* output_files;
 
-            if (!livereg_out_filename.isEmpty())
-            {
-                // Perform live VGPR analysis and force wave 64 for OpenCL kernels. Currently the wave size information
-                // is missing from LLVM disassembly, therefore Shae is not able to deduce the value from the disassembly.
-                // Therefore we will use a default of wave64 (this would be ignored by Shae for pre-RDNA targets).
-                KcUtils::PerformLiveRegisterAnalysis(
-                    isa_filename, device_gtstr, livereg_out_filename, log_callback_, config.print_process_cmd_line, false, output_files.wave_size);
-                if (BeProgramBuilderLightning::VerifyOutputFile(livereg_out_filename.asASCIICharArray()))
-                {
-                    // Store the name of livereg output file in the RGA output files metadata.
-                    output_files.livereg_file = livereg_out_filename.asASCIICharArray();
-                    std::cout << kStrInfoSuccess << std::endl;
-                }
-                else
-                {
-                    error_msg << kStrErrorCannotPerformLiveregAnalysis << " " << kStrKernelName << entry_name << std::endl;
-                    std::cout << kStrInfoFailed << std::endl;
-                    ret = false;
-                }
-            }
-            else
-            {
-                error_msg << kStrErrorOpenclOfflineFailedToCreateOutputFilenameForKernel << entry_name << std::endl;
-                ret = false;
-            }
-        }
-    }
+    // The target device.
+    std::string device;
 
-    if (!ret)
+    // The kernel name.
+    std::string entry_name;
+
+    // Index of the analysis in the batch, or -1 if the output file name could not be constructed.
+    int request_index;
+};
+
+// Print the console message that announces the given analysis.
+static void LogAnalysisPreStep(const KcLightningAnalysisItem& item)
+{
+    switch (item.type)
     {
-        log_callback_(error_msg.str());
+    case beKA::BeStaticIsaAnalysisType::kLiveVgpr:
+        std::cout << kStrInfoPerformingLiveregAnalysisVgpr;
+        break;
+    case beKA::BeStaticIsaAnalysisType::kLiveSgpr:
+        std::cout << kStrInfoPerformingLiveregAnalysisSgpr;
+        break;
+    case beKA::BeStaticIsaAnalysisType::kCfgPerBlock:
+        std::cout << kStrInfoContructingPerBlockCfg1;
+        break;
+    default:
+        std::cout << kStrInfoContructingPerInstructionCfg1;
+        break;
     }
-
-    return ret;
+    std::cout << item.device << kStrInfoOpenclOfflineKernelForKernel << item.entry_name << "... ";
 }
 
-bool KcUtilsLightning::PerformLiveSgprAnalysis(const Config& config) const
+bool KcUtilsLightning::PerformStaticIsaAnalyses(const Config& config) const
 {
     bool              ret = true;
     std::stringstream error_msg;
 
-    for (auto& output_md_item : output_metadata_)
+    // The requested analyses, in the order in which they are reported.
+    std::vector<beKA::BeStaticIsaAnalysisType> analysis_types;
+    if (!config.livereg_analysis_file.empty())
     {
-        RgOutputFiles& output_files = output_md_item.second;
-        if (output_files.status)
-        {
-            const std::string& device               = output_md_item.first.first;
-            const std::string& entry_name           = output_md_item.first.second;
-            const std::string& entry_abbrivation    = output_md_item.second.entry_abbreviation;
-            gtString           livereg_out_filename = L"";
-            gtString           isa_filename;
-            isa_filename << output_files.isa_file.c_str();
-            gtString device_gtstr;
-            device_gtstr << device.c_str();
-
-            // Inform the user.
-            std::cout << kStrInfoPerformingLiveregAnalysisSgpr << device << kStrInfoOpenclOfflineKernelForKernel << entry_name << "... ";
-
-            // Construct a name for the output livereg file.
-            if (entry_abbrivation.empty())
-            {
-                KcUtils::ConstructOutputFileName(config.sgpr_livereg_analysis_file,
-                                                 kStrDefaultExtensionLiveregSgpr,
-                                                 kStrDefaultExtensionText, 
-                                                 entry_name,
-                                                 device,
-                                                 livereg_out_filename);
-            }
-            else
-            {
-                KcUtils::ConstructOutputFileName(config.sgpr_livereg_analysis_file,
-                                                 kStrDefaultExtensionLiveregSgpr,
-                                                 kStrDefaultExtensionText,
-                                                 entry_abbrivation,
-                                                 device,
-                                                 livereg_out_filename);
-            }
+        analysis_types.push_back(beKA::BeStaticIsaAnalysisType::kLiveVgpr);
+    }
+    if (!config.sgpr_livereg_analysis_file.empty())
+    {
+        analysis_types.push_back(beKA::BeStaticIsaAnalysisType::kLiveSgpr);
+    }
+    if (!config.block_cfg_file.empty() || !config.inst_cfg_file.empty())
+    {
+        analysis_types.push_back(config.inst_cfg_file.empty() ? beKA::BeStaticIsaAnalysisType::kCfgPerBlock
+                                                               : beKA::BeStaticIsaAnalysisType::kCfgPerInstruction);
+    }
 
-            if (!livereg_out_filename.isEmpty())
+    // Collect the analyses of all kernels on all devices.
+    std::vector<beKA::BeStaticIsaAnalysisRequest> requests;
+    std::vector<KcLightningAnalysisItem>          items;
+    for (beKA::BeStaticIsaAnalysisType type : analysis_types)
+    {
+        for (auto& output_md_item : output_metadata_)
+        {
+            RgOutputFiles& output_files = output_md_item.second;
+            if (output_files.status)
             {
-                // Perform live SGPR analysis and force wave 64 for OpenCL kernels. Currently the wave size information
-                // is missing from LLVM disassembly, therefore Shae is not able to deduce the value from the disassembly.
-                // Therefore we will use a default of wave64 (this would be ignored by Shae for pre-RDNA targets).
-                KcUtils::PerformLiveRegisterAnalysis(
-                    isa_filename, device_gtstr, livereg_out_filename, log_callback_, config.print_process_cmd_line, true, output_files.wave_size);
-                if (BeProgramBuilderLightning::VerifyOutputFile(livereg_out_filename.asASCIICharArray()))
+                const std::string& device            = output_md_item.first.first;
+                const std::string& entry_name        = output_md_item.first.second;
+                const std::string& entry_abbrivation = output_md_item.second.entry_abbreviation;
+                const std::string& entry_file_name   = (entry_abbrivation.empty() ? entry_name : entry_abbrivation);
+                gtString           out_filename      = L"";
+
+                // Construct a name for the output file.
+                if (type == beKA::BeStaticIsaAnalysisType::kLiveVgpr)
                 {
-                    // Store the name of livereg output file in the RGA output files metadata.
-                    output_files.livereg_sgpr_file = livereg_out_filename.asASCIICharArray();
-                    std::cout << kStrInfoSuccess << std::endl;
+                    KcUtils::ConstructOutputFileName(
+                        config.livereg_analysis_file, kStrDefaultExtensionLivereg, kStrDefaultExtensionText, entry_file_name, device, out_filename);
+                }
+                else if (type == beKA::BeStaticIsaAnalysisType::kLiveSgpr)
+                {
+                    KcUtils::ConstructOutputFileName(config.sgpr_livereg_analysis_file,
+                                                     kStrDefaultExtensionLiveregSgpr,
+                                                     kStrDefaultExtensionText,
+                                                     entry_file_name,
+                                                     device,
+                                                     out_filename);
                 }
                 else
                 {
-                    error_msg << kStrErrorCannotPerformLiveregAnalysisSgpr << " " << kStrKernelName << entry_name << std::endl;
-                    std::cout << kStrInfoFailed << std::endl;
-                    ret = false;
+                    const std::string& base_file = (!config.block_cfg_file.empty() ? config.block_cfg_file : config.inst_cfg_file);
+                    KcUtils::ConstructOutputFileName(base_file, KC_STR_DEFAULT_CFG_SUFFIX, kStrDefaultExtensionDot, entry_file_name, device, out_filename);
                 }
-            }
-            else
-            {
-                error_msg << kStrErrorOpenclOfflineFailedToCreateOutputFilenameForKernel << entry_name << std::endl;
-                ret = false;
+
+                KcLightningAnalysisItem item = {type, &output_files, device, entry_name, -1};
+                if (!out_filename.isEmpty())
+                {
+                    // Currently the wave size information is missing from LLVM disassembly, so the wave size
+                    // that was recorded for the kernel is forwarded (this is ignored for pre-RDNA targets).
+                    beKA::BeStaticIsaAnalysisRequest request;
+                    request.type            = type;
+                    request.isa_filename    = output_files.isa_file;
+                    request.target          = device;
+                    request.output_filename = out_filename.asASCIICharArray();
+                    request.wave_size       = output_files.wave_size;
+                    item.request_index      = static_cast<int>(requests.size());
+                    requests.push_back(request);
+                }
+                items.push_back(item);
             }
         }
     }
 
-    if (!ret)
+    // Submit all analyses in a single batch.
+    if (!requests.empty())
     {
-        log_callback_(error_msg.str());
+        KcUtils::PerformStaticIsaAnalyses(requests, config);
     }
 
-    return ret;
-}
-
-bool KcUtilsLightning::ExtractCFG(const Config& config) const
-{
-    bool              ret = true;
-    std::stringstream error_msg;
-
-    for (auto& output_md_item : output_metadata_)
+    // Report the results in order.
+    for (const KcLightningAnalysisItem& item : items)
     {
-        RgOutputFiles& outputFiles = output_md_item.second;
-
-        if (outputFiles.status)
+        LogAnalysisPreStep(item);
+        if (item.request_index >= 0)
         {
-            const std::string& device            = output_md_item.first.first;
-            const std::string& entry_name        = output_md_item.first.second;
-            const std::string& entry_abbrivation = output_md_item.second.entry_abbreviation;
-            gtString           cfg_out_filename = L"";
-            gtString           isa_filename;
-            isa_filename << outputFiles.isa_file.c_str();
-            gtString device_gtstr;
-            device_gtstr << device.c_str();
-
-            bool is_per_basic_block_cfg = !config.block_cfg_file.empty();
-            std::cout << (is_per_basic_block_cfg ? kStrInfoContructingPerBlockCfg1 : kStrInfoContructingPerInstructionCfg1) << device
-                      << kStrInfoOpenclOfflineKernelForKernel << entry_name << "... ";
-
-            // Construct a name for the output CFG file.
-            std::string base_file = (is_per_basic_block_cfg ? config.block_cfg_file : config.inst_cfg_file);
-            if (entry_abbrivation.empty())
+            const std::string& out_filename = requests[item.request_index].output_filename;
+            KcUtils::ReportStaticIsaAnalysisResult(requests[item.request_index], log_callback_);
+            if (BeProgramBuilderLightning::VerifyOutputFile(out_filename))
             {
-                KcUtils::ConstructOutputFileName(base_file, KC_STR_DEFAULT_CFG_SUFFIX, kStrDefaultExtensionDot, entry_name, device, cfg_out_filename);
+                // Store the name of livereg output file in the RGA output files metadata.
+                if (item.type == beKA::BeStaticIsaAnalysisType::kLiveVgpr)
+                {
+                    item.output_files->livereg_file = out_filename;
+                }
+                else if (item.type == beKA::BeStaticIsaAnalysisType::kLiveSgpr)
+                {
+                    item.output_files->livereg_sgpr_file = out_filename;
+                }
+                std::cout << kStrInfoSuccess << std::endl;
             }
             else
             {
-                KcUtils::ConstructOutputFileName(base_file, KC_STR_DEFAULT_CFG_SUFFIX, kStrDefaultExtensionDot, entry_abbrivation, device, cfg_out_filename);
-            }
-            if (!cfg_out_filename.isEmpty())
-            {
-                KcUtils::GenerateControlFlowGraph(
-                    isa_filename, device_gtstr, cfg_out_filename, log_callback_, !config.inst_cfg_file.empty(), config.print_process_cmd_line);
-
-                if (!BeProgramBuilderLightning::VerifyOutputFile(cfg_out_filename.asASCIICharArray()))
+                if (item.type == beKA::BeStaticIsaAnalysisType::kLiveVgpr)
+                {
+                    error_msg << kStrErrorCannotPerformLiveregAnalysis;
+                }
+                else if (item.type == beKA::BeStaticIsaAnalysisType::kLiveSgpr)
                 {
-                    error_msg << kStrErrorCannotGenerateCfg << " " << kStrKernelName << entry_name << std::endl;
-                    std::cout << kStrInfoFailed << std::endl;
-                    ret = false;
+                    error_msg << kStrErrorCannotPerformLiveregAnalysisSgpr;
                 }
                 else
                 {
-                    std::cout << kStrInfoSuccess << std::endl;
+                    error_msg << kStrErrorCannotGenerateCfg;
                 }
-            }
-            else
-            {
-                error_msg << kStrErrorOpenclOfflineFailedToCreateOutputFilenameForKernel << entry_name << std::endl;
+                error_msg << " " << kStrKernelName << item.entry_name << std::endl;
+                std::cout << kStrInfoFailed << std::endl;
                 ret = false;
             }
         }
+        else
+        {
+            error_msg << kStrErrorOpenclOfflineFailedToCreateOutputFilenameForKernel << item.entry_name << std::endl;
+            ret = false;
+        }
     }
 
     if (!ret)
@@ -372,7 +338,23 @@ beKA::beStatus KcUtilsLightning::ExtractMetadata(const CmpilerPaths& compiler_pa
                 KcUtils::ConstructOutputFileName(metadata_filename, "", kStrDefaultExtensionMd, kStrDefaultExtensionText, device, out_filename);
                 if (!out_filename.isEmpty())
                 {
-                    current_status = BeProgramBuilderLightning::ExtractMetadata(compiler_paths.bin, bin_filename, should_print_cmd_, metadata_text);
+                    // Extract the metadata, or fetch it from the compilation cache.
+                    KcCompilationCacheKey cache_key("opencl-metadata");
+                    const bool            is_cacheable = KcCompilationCache::IsEnabled() &&
+                                                         AddCompilerToCacheKey(compiler_paths.bin, should_print_cmd_, cache_key) &&
+                                                         cache_key.AddFile(bin_filename);
+                    if (is_cacheable && KcCompilationCache::FetchText(cache_key, metadata_text))
+                    {
+                        current_status = beKA::beStatus::kBeStatusSuccess;
+                    }
+                    else
+                    {
+                        current_status = BeProgramBuilderLightning::ExtractMetadata(compiler_paths.bin, bin_filename, should_print_cmd_, metadata_text);
+                        if (is_cacheable && current_status == beKA::beStatus::kBeStatusSuccess)
+                        {
+                            KcCompilationCache::StoreText(cache_key, metadata_text);
+                        }
+                    }
                     if (current_status == beKA::beStatus::kBeStatusSuccess && !metadata_text.empty())
                     {
                         current_status = KcUtils::WriteTextFile(out_filename.asASCIICharArray(), metadata_text, log_callback_)
@@ -575,11 +557,98 @@ beKA::beStatus KcUtilsLightning::ExtractStatistics(const Config& config) const
     return status;
 }
 
-bool KcUtilsLightning::GetParsedIsaCsvText(const std::string& isaText, const std::string& device, bool add_line_numbers, std::string& csv_text)
+// Header of the cycle estimate CSV files.
+static std::string GetCycleEstimateCsvHeaderString(char separator)
 {
-    static const char* kStrCsvParsedIsaHeader            = "Address, Opcode, Operands, Functional Unit, Cycles, Binary Encoding\n";
-    static const char* kStrCsvParsedIsaHeaderLineNumbers = "Address, Source Line Number, Opcode, Operands, Functional Unit, Cycles, Binary Encoding\n";
+    static const char* kStrInfoCsvHeaderKernel        = "KERNEL";
+    static const char* kStrInfoCsvHeaderMinCycles     = "MIN_CYCLES";
+    static const char* kStrInfoCsvHeaderTypicalCycles = "TYPICAL_CYCLES";
+    static const char* kStrInfoCsvHeaderMaxCycles     = "MAX_CYCLES";
+
+    std::stringstream output;
+    output << kStrInfoCsvHeaderKernel << separator << kStrInfoCsvHeaderMinCycles << separator;
+    output << kStrInfoCsvHeaderTypicalCycles << separator << kStrInfoCsvHeaderMaxCycles;
+    return output.str();
+}
+
+// Rank the kernels of a device by their estimated cycles and store them to a CSV file.
+static bool StoreCycleEstimates(const Config&                                              config,
+                                const std::string&                                         device,
+                                std::vector<std::pair<std::string, beKA::CycleEstimate>>& kernel_estimates)
+{
+    bool        ret = false;
+    std::string estimate_filename;
+    KcUtils::ConstructOutputFileName(config.cycle_estimate_file, kStrDefaultExtensionCycles, kStrDefaultExtensionCsv, "", device, estimate_filename);
+
+    if (!estimate_filename.empty())
+    {
+        // The most expensive kernels first.
+        std::stable_sort(kernel_estimates.begin(), kernel_estimates.end(), [](const auto& a, const auto& b) {
+            return a.second.typical_cycles > b.second.typical_cycles;
+        });
+
+        std::stringstream estimate_text;
+        char              separator = KcUtils::GetCsvSeparator(config);
+        estimate_text << GetCycleEstimateCsvHeaderString(separator) << std::endl;
+        for (const auto& kernel_estimate : kernel_estimates)
+        {
+            estimate_text << kernel_estimate.first << separator;
+            estimate_text << kernel_estimate.second.min_cycles << separator;
+            estimate_text << kernel_estimate.second.typical_cycles << separator;
+            estimate_text << kernel_estimate.second.max_cycles << std::endl;
+        }
+
+        ret = KcUtils::WriteTextFile(estimate_filename, estimate_text.str(), nullptr);
+    }
+
+    return ret;
+}
+
+beKA::beStatus KcUtilsLightning::EstimateCycles(const Config& config) const
+{
+    beKA::beStatus status = beKA::beStatus::kBeStatusSuccess;
+    LogPreStep(kStrInfoEstimatingCycles);
+
+    // The output metadata is ordered by device, so the kernels of every device are adjacent.
+    auto it = output_metadata_.cbegin();
+    while (it != output_metadata_.cend())
+    {
+        const std::string                                        device = it->first.first;
+        std::vector<std::pair<std::string, beKA::CycleEstimate>> kernel_estimates;
+        for (; it != output_metadata_.cend() && it->first.first == device; ++it)
+        {
+            const RgOutputFiles& output_files = it->second;
+            if (output_files.status && KcUtils::FileNotEmpty(output_files.isa_file))
+            {
+                beKA::CycleEstimate estimate;
+                if (BeProgramBuilder::EstimateIsaFileCycles(output_files.isa_file, estimate, true) == beKA::kBeStatusSuccess)
+                {
+                    kernel_estimates.push_back({it->first.second, estimate});
+                }
+                else
+                {
+                    status = beKA::kBeStatusGeneralFailed;
+                }
+            }
+        }
+
+        if (!kernel_estimates.empty() && !StoreCycleEstimates(config, device, kernel_estimates))
+        {
+            status = beKA::kBeStatusWriteToFileFailed;
+        }
+    }
+
+    LogResult(status == beKA::beStatus::kBeStatusSuccess);
+
+    return status;
+}
+
+// Headers of the parsed ISA CSV files.
+static const char* kStrCsvParsedIsaHeader            = "Address, Opcode, Operands, Functional Unit, Cycles, Binary Encoding\n";
+static const char* kStrCsvParsedIsaHeaderLineNumbers = "Address, Source Line Number, Opcode, Operands, Functional Unit, Cycles, Binary Encoding\n";
 
+bool KcUtilsLightning::GetParsedIsaCsvText(const std::string& isaText, const std::string& device, bool add_line_numbers, std::string& csv_text)
+{
     bool        ret = false;
     std::string parsed_isa;
     if (BeProgramBuilder::ParseIsaToCsv(isaText, device, parsed_isa, add_line_numbers, true) == beKA::kBeStatusSuccess)
@@ -590,6 +659,12 @@ bool KcUtilsLightning::GetParsedIsaCsvText(const std::string& isaText, const std
     return ret;
 }
 
+bool KcUtilsLightning::WriteParsedIsaCsvFile(const std::string& isa_filename, const std::string& device, bool add_line_numbers, const std::string& csv_filename)
+{
+    const std::string csv_header = (add_line_numbers ? kStrCsvParsedIsaHeaderLineNumbers : kStrCsvParsedIsaHeader);
+    return BeProgramBuilder::ParseIsaFileToCsv(isa_filename, csv_filename, device, csv_header, add_line_numbers, true) == beKA::kBeStatusSuccess;
+}
+
 beKA::beStatus KcUtilsLightning::WriteIsaToFile(const std::string&      file_name,
                                                 const std::string&      isa_text,
                                                 LoggingCallbackFunction log_callback)
@@ -903,3 +978,70 @@ std::string KcUtilsLightning::PrefixWithISAHeader(const std::string& kernel_name
     kernel_isa_text_ss << kernel_isa_text;
     return kernel_isa_text_ss.str();
 }
+
+bool KcUtilsLightning::AddCompilerToCacheKey(const std::string& compiler_bin_dir, bool should_print_cmd, KcCompilationCacheKey& key)
+{
+    // Compiler folder --> compiler version.
+    static std::map<std::string, std::string> compiler_versions;
+    static std::mutex                         compiler_versions_lock;
+
+    bool        ret = true;
+    std::string version;
+    {
+        std::lock_guard<std::mutex> lock(compiler_versions_lock);
+        auto                        found = compiler_versions.find(compiler_bin_dir);
+        if (found != compiler_versions.end())
+        {
+            version = found->second;
+        }
+        else
+        {
+            ret = BeProgramBuilderLightning::GetCompilerVersion(beKA::RgaMode::kModeOpenclOffline, compiler_bin_dir, should_print_cmd, version) ==
+                  beKA::beStatus::kBeStatusSuccess;
+            if (ret)
+            {
+                compiler_versions[compiler_bin_dir] = version;
+            }
+        }
+    }
+
+    if (ret)
+    {
+        key.AddText(compiler_bin_dir);
+        key.AddText(version);
+    }
+
+    return ret;
+}
+
+bool KcUtilsLightning::AddSourcesToCacheKey(const Config& config, const CmpilerPaths& compiler_paths, KcCompilationCacheKey& key)
+{
+    bool ret = true;
+
+    // Options that affect the compilation.
+    const std::string options = GatherOCLOptions(config);
+    key.AddText(options);
+    key.AddText(compiler_paths.inc);
+    key.AddText(compiler_paths.lib);
+    for (const std::string& option : config.opencl_options)
+    {
+        key.AddText(option);
+    }
+    key.AddText(std::to_string(config.opt_level));
+    key.AddText(config.is_line_numbers_required ? "1" : "0");
+
+    // The source files and their preprocessed text.
+    for (auto it = config.input_files.cbegin(); ret && it != config.input_files.cend(); ++it)
+    {
+        std::string prep_src;
+        ret = key.AddFile(*it) &&
+              BeProgramBuilderLightning::PreprocessOpencl(compiler_paths, *it, options, config.print_process_cmd_line, prep_src) ==
+                  beKA::beStatus::kBeStatusSuccess;
+        if (ret)
+        {
+            key.AddText(prep_src);
+        }
+    }
+
+    return ret;
+}
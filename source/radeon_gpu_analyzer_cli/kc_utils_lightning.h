@@ -16,6 +16,7 @@
 
 // Local.
 #include "source/radeon_gpu_analyzer_cli/kc_data_types.h"
+#include "radeon_gpu_analyzer_cli/kc_compilation_cache.h"
 #include "radeon_gpu_analyzer_cli/kc_config.h"
 
 // Kernel Header Strings.
@@ -40,14 +41,9 @@ public:
     // Parse ISA files and generate separate files that contain parsed ISA in CSV format.
     bool ParseIsaFilesToCSV(bool add_line_numbers) const;
 
-    // Perform live VGPR analysis.
-    bool PerformLiveVgprAnalysis(const Config& config) const;
-
-    // Perform live VGPR analysis.
-    bool PerformLiveSgprAnalysis(const Config& config) const;
-
-    // Extract program Control Flow Graph.
-    bool ExtractCFG(const Config& config) const;
+    // Perform the requested live VGPR analysis, live SGPR analysis and Control Flow Graph extraction
+    // of all kernels as a single batch.
+    bool PerformStaticIsaAnalyses(const Config& config) const;
 
     // Get the AMD GPU metadata from the binary.
     beKA::beStatus ExtractMetadata(const CmpilerPaths& compiler_paths, const std::string& metadata_filename) const;
@@ -55,9 +51,17 @@ public:
     // Extract Resource Usage (statistics) data.
     beKA::beStatus ExtractStatistics(const Config& config) const;
 
+    // Estimate the cycles per wavefront of every kernel, and store them to a CSV file per device
+    // where the kernels are ranked from the most expensive to the cheapest one.
+    beKA::beStatus EstimateCycles(const Config& config) const;
+
     // Convert ISA text to CSV form with additional data.
     static bool GetParsedIsaCsvText(const std::string& isaText, const std::string& device, bool add_line_numbers, std::string& csvText);
 
+    // Convert the ISA file to CSV form with additional data and write it to "csv_filename".
+    // The ISA file is mapped to memory and the CSV rows are streamed to the output file.
+    static bool WriteParsedIsaCsvFile(const std::string& isa_filename, const std::string& device, bool add_line_numbers, const std::string& csv_filename);
+
     // Store ISA text in the file.
     static beKA::beStatus WriteIsaToFile(const std::string& file_name, const std::string& isa_text, LoggingCallbackFunction log_callback);
 
@@ -70,6 +74,14 @@ public:
     // Delete all temporary files created by RGA.
     static void DeleteTempFiles(const RgClOutputMetadata& output_metadata);
 
+    // Add the folder and the version of the Lightning Compiler to a compilation cache key.
+    // The version is retrieved once per compiler folder. Returns false if it cannot be retrieved.
+    static bool AddCompilerToCacheKey(const std::string& compiler_bin_dir, bool should_print_cmd, KcCompilationCacheKey& key);
+
+    // Add the OpenCL source files and the options that affect their compilation to a compilation cache key.
+    // Both the contents of the files and their preprocessed text (which covers the included headers) are added.
+    static bool AddSourcesToCacheKey(const Config& config, const CmpilerPaths& compiler_paths, KcCompilationCacheKey& key);
+
 private:
     // ---- DATA ----
 
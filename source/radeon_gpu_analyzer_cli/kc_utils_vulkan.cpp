@@ -6,6 +6,7 @@
 //=============================================================================
 // C++.
 #include <sstream>
+#include <vector>
 
 // External.
 #include "external/amdt_os_wrappers/Include/osFilePath.h"
@@ -41,24 +42,20 @@ bool KcUtilsVulkan::ParseIsaFilesToCSV(bool line_numbers, const std::string& dev
     {
         if (!output_file.isa_file.empty())
         {
-            std::string isa, parsed_isa, parsed_isa_filename;
-            bool        status = KcUtils::ReadTextFile(output_file.isa_file, isa, nullptr);
+            std::string parsed_isa_filename;
+            bool        status = KcUtils::FileNotEmpty(output_file.isa_file);
 
             if (status)
             {
-                // Convert the ISA text to CSV format.
-                if ((status = KcUtilsVulkan::GetParsedIsaCsvText(isa, device_string, line_numbers, parsed_isa)) == true)
+                status = (KcUtils::GetParsedISAFileName(output_file.isa_file, parsed_isa_filename) == beKA::kBeStatusSuccess);
+                if (status)
                 {
-                    status = (KcUtils::GetParsedISAFileName(output_file.isa_file, parsed_isa_filename) == beKA::kBeStatusSuccess);
+                    // Convert the ISA file to CSV format, streaming the CSV rows straight to disk.
+                    status = KcUtilsVulkan::WriteParsedIsaCsvFile(output_file.isa_file, device_string, line_numbers, parsed_isa_filename);
                     if (status)
                     {
-                        // Attempt to write the ISA CSV to disk.
-                        status = (KcUtilsVulkan::WriteIsaToFile(parsed_isa_filename, parsed_isa, log_callback_) == beKA::kBeStatusSuccess);
-                        if (status)
-                        {
-                            // Update the session metadata output to include the path to the ISA CSV.
-                            output_file.isa_csv_file = parsed_isa_filename;
-                        }
+                        // Update the session metadata output to include the path to the ISA CSV.
+                        output_file.isa_csv_file = parsed_isa_filename;
                     }
                 }
 
@@ -74,64 +71,65 @@ bool KcUtilsVulkan::ParseIsaFilesToCSV(bool line_numbers, const std::string& dev
     return ret;
 }
 
-bool KcUtilsVulkan::PerformLiveVgprAnalysis(const Config& conf, const std::string& device, RgVkOutputMetadata& device_md) const
+// A static ISA analysis of a pipeline stage in the batch of analyses.
+struct KcVulkanAnalysisItem
 {
-    bool ret = true;
-
-    const std::string& device_suffix = (conf.asics.empty() && !physical_adapter_name_.empty() ? "" : device);
-    gtString           device_gtstr;
-    device_gtstr << device.c_str();
-
-    std::cout << kStrInfoPerformingLiveregAnalysisVgpr << device << "... " << std::endl;
-
-    std::size_t stage = 0;
-    for (auto& stage_md : device_md)
-    {
-        if (!stage_md.isa_file.empty() && ret)
-        {
-            std::string out_file_name;
-            gtString    out_filename_gtstr, isa_filename_gtstr;
-
-            // Construct a name for the livereg output file.
-            ret = KcUtils::ConstructOutFileName(conf.livereg_analysis_file,
-                                                vulkan_stage_file_suffix_[stage],
-                                                device_suffix,
-                                                kStrDefaultExtensionLivereg,
-                                                out_file_name,
-                                                !KcUtils::IsDirectory(conf.livereg_analysis_file));
-
-            if (ret && !out_file_name.empty())
-            {
-                out_filename_gtstr << out_file_name.c_str();
-                isa_filename_gtstr << stage_md.isa_file.c_str();
+    // The analysis.
+    beKA::BeStaticIsaAnalysisType type;
 
-                KcUtils::PerformLiveRegisterAnalysis(
-                    isa_filename_gtstr, device_gtstr, out_filename_gtstr, log_callback_, conf.print_process_cmd_line, false, stage_md.wave_size);
-                ret                   = BeUtils::IsFilePresent(out_file_name);
-                stage_md.livereg_file = out_file_name;
-            }
-            else
-            {
-                RgLog::stdOut << kStrErrorFailedCreateOutputFilename << std::endl;
-            }
-        }
-        ++stage;
-    }
-
-    LogResult(ret);
+    // The output files of the analyzed stage.
+    RgOutputFiles* stage_md;
 
-    return ret;
-}
+    // Index of the analysis in the batch, or -1 if the output file name could not be constructed.
+    int request_index;
+};
 
-bool KcUtilsVulkan::PerformLiveSgprAnalysis(const Config& conf, const std::string& device, RgVkOutputMetadata& device_md) const
+// The static ISA analyses of a single type for all pipeline stages of a device.
+struct KcVulkanDeviceAnalysis
+{
+    // The target device.
+    std::string device;
+
+    // The analysis.
+    beKA::BeStaticIsaAnalysisType type;
+
+    // The analyses of the device's stages.
+    std::vector<KcVulkanAnalysisItem> items;
+};
+
+bool KcUtilsVulkan::AddStaticIsaAnalysisRequests(const Config&                                  config,
+                                                 const std::string&                             device,
+                                                 beKA::BeStaticIsaAnalysisType                  type,
+                                                 RgVkOutputMetadata&                            device_md,
+                                                 std::vector<beKA::BeStaticIsaAnalysisRequest>& requests,
+                                                 std::vector<KcVulkanAnalysisItem>&             items) const
 {
     bool ret = true;
 
-    const std::string& device_suffix = (conf.asics.empty() && !physical_adapter_name_.empty() ? "" : device);
-    gtString           device_gtstr;
-    device_gtstr << device.c_str();
+    const std::string& device_suffix = (config.asics.empty() && !physical_adapter_name_.empty() ? "" : device);
 
-    std::cout << kStrInfoPerformingLiveregAnalysisSgpr << device << "... " << std::endl;
+    // The base output file name and the default extension of the analysis.
+    std::string base_output_file;
+    std::string default_extension;
+    switch (type)
+    {
+    case beKA::BeStaticIsaAnalysisType::kLiveVgpr:
+        base_output_file  = config.livereg_analysis_file;
+        default_extension = kStrDefaultExtensionLivereg;
+        break;
+    case beKA::BeStaticIsaAnalysisType::kLiveSgpr:
+        base_output_file  = config.sgpr_livereg_analysis_file;
+        default_extension = kStrDefaultExtensionLiveregSgpr;
+        break;
+    case beKA::BeStaticIsaAnalysisType::kCfgPerInstruction:
+        base_output_file  = config.inst_cfg_file;
+        default_extension = kStrDefaultExtensionDot;
+        break;
+    default:
+        base_output_file  = config.block_cfg_file;
+        default_extension = kStrDefaultExtensionDot;
+        break;
+    }
 
     std::size_t stage = 0;
     for (auto& stage_md : device_md)
@@ -139,83 +137,80 @@ bool KcUtilsVulkan::PerformLiveSgprAnalysis(const Config& conf, const std::strin
         if (!stage_md.isa_file.empty() && ret)
         {
             std::string out_file_name;
-            gtString    out_filename_gtstr, isa_filename_gtstr;
 
-            // Construct a name for the livereg output file.
-            ret = KcUtils::ConstructOutFileName(conf.sgpr_livereg_analysis_file,
+            // Construct a name for the output file.
+            ret = KcUtils::ConstructOutFileName(base_output_file,
                                                 vulkan_stage_file_suffix_[stage],
                                                 device_suffix,
-                                                kStrDefaultExtensionLiveregSgpr,
+                                                default_extension,
                                                 out_file_name,
-                                                !KcUtils::IsDirectory(conf.sgpr_livereg_analysis_file));
+                                                !KcUtils::IsDirectory(base_output_file));
 
+            KcVulkanAnalysisItem item = {type, &stage_md, -1};
             if (ret && !out_file_name.empty())
             {
-                out_filename_gtstr << out_file_name.c_str();
-                isa_filename_gtstr << stage_md.isa_file.c_str();
-
-                KcUtils::PerformLiveRegisterAnalysis(
-                    isa_filename_gtstr, device_gtstr, out_filename_gtstr, log_callback_, conf.print_process_cmd_line, stage_md.wave_size);
-                ret                        = BeUtils::IsFilePresent(out_file_name);
-                stage_md.livereg_sgpr_file = out_file_name;
-            }
-            else
-            {
-                RgLog::stdOut << kStrErrorFailedCreateOutputFilename << std::endl;
+                beKA::BeStaticIsaAnalysisRequest request;
+                request.type            = type;
+                request.isa_filename    = stage_md.isa_file;
+                request.target          = device;
+                request.output_filename = out_file_name;
+                request.wave_size       = stage_md.wave_size;
+                item.request_index      = static_cast<int>(requests.size());
+                requests.push_back(request);
             }
+            items.push_back(item);
         }
         ++stage;
     }
 
-    LogResult(ret);
-
     return ret;
 }
 
-bool KcUtilsVulkan::ExtractCFG(const Config& config, const std::string& device, const RgVkOutputMetadata& device_md) const
+bool KcUtilsVulkan::ReportStaticIsaAnalysisResults(const std::string&                                   device,
+                                                   beKA::BeStaticIsaAnalysisType                        type,
+                                                   const std::vector<beKA::BeStaticIsaAnalysisRequest>& requests,
+                                                   const std::vector<KcVulkanAnalysisItem>&             items) const
 {
     bool ret = true;
 
-    const std::string& device_suffix = (config.asics.empty() && !physical_adapter_name_.empty() ? "" : device);
-    bool               per_inst_cfg  = (!config.inst_cfg_file.empty());
-    gtString           device_gtstr;
-    device_gtstr << device.c_str();
-
-    std::cout << (per_inst_cfg ? kStrInfoContructingPerInstructionCfg1 : kStrInfoContructingPerBlockCfg1) << device << "..." << std::endl;
+    switch (type)
+    {
+    case beKA::BeStaticIsaAnalysisType::kLiveVgpr:
+        std::cout << kStrInfoPerformingLiveregAnalysisVgpr << device << "... " << std::endl;
+        break;
+    case beKA::BeStaticIsaAnalysisType::kLiveSgpr:
+        std::cout << kStrInfoPerformingLiveregAnalysisSgpr << device << "... " << std::endl;
+        break;
+    case beKA::BeStaticIsaAnalysisType::kCfgPerInstruction:
+        std::cout << kStrInfoContructingPerInstructionCfg1 << device << "..." << std::endl;
+        break;
+    default:
+        std::cout << kStrInfoContructingPerBlockCfg1 << device << "..." << std::endl;
+        break;
+    }
 
-    std::size_t stage = 0;
-    for (const auto& stage_md : device_md)
+    for (auto iter = items.begin(); iter != items.end() && ret; ++iter)
     {
-        if (!stage_md.isa_file.empty() && ret)
+        const KcVulkanAnalysisItem& item = *iter;
+        if (item.request_index >= 0)
         {
-            std::string out_filename;
-            gtString    out_filename_gtstr, isa_filename_gtstr;
-
-            // Construct a name for the CFG output file.
-            const std::string cfg_output_file = (per_inst_cfg ? config.inst_cfg_file : config.block_cfg_file);
-            ret                               = KcUtils::ConstructOutFileName(cfg_output_file, 
-                                                    vulkan_stage_file_suffix_[stage], 
-                                                    device_suffix, 
-                                                    kStrDefaultExtensionDot,
-                                                    out_filename, 
-                                                    !KcUtils::IsDirectory(cfg_output_file));
-
-            if (ret && !out_filename.empty())
+            const std::string& out_file_name = requests[item.request_index].output_filename;
+            KcUtils::ReportStaticIsaAnalysisResult(requests[item.request_index], log_callback_);
+            ret = BeUtils::IsFilePresent(out_file_name);
+            if (type == beKA::BeStaticIsaAnalysisType::kLiveVgpr)
             {
-                out_filename_gtstr << out_filename.c_str();
-                isa_filename_gtstr << stage_md.isa_file.c_str();
-
-                KcUtils::GenerateControlFlowGraph(
-                    isa_filename_gtstr, device_gtstr, out_filename_gtstr, log_callback_, per_inst_cfg, config.print_process_cmd_line);
-                ret = BeUtils::IsFilePresent(out_filename);
+                item.stage_md->livereg_file = out_file_name;
             }
-            else
+            else if (type == beKA::BeStaticIsaAnalysisType::kLiveSgpr)
             {
-                RgLog::stdOut << kStrErrorFailedCreateOutputFilename << std::endl;
+                item.stage_md->livereg_sgpr_file = out_file_name;
             }
         }
-
-        ++stage;
+        else
+        {
+            RgLog::stdOut << kStrErrorFailedCreateOutputFilename << std::endl;
+            ret = false;
+        }
     }
 
     LogResult(ret);
@@ -225,9 +220,27 @@ bool KcUtilsVulkan::ExtractCFG(const Config& config, const std::string& device,
 
 void KcUtilsVulkan::RunPostProcessingSteps(const Config& config) const
 {
+    // The requested analyses, in the order in which they are reported.
+    std::vector<beKA::BeStaticIsaAnalysisType> analysis_types;
+    if (!config.livereg_analysis_file.empty())
+    {
+        analysis_types.push_back(beKA::BeStaticIsaAnalysisType::kLiveVgpr);
+    }
+    if (!config.sgpr_livereg_analysis_file.empty())
+    {
+        analysis_types.push_back(beKA::BeStaticIsaAnalysisType::kLiveSgpr);
+    }
+    if (!config.block_cfg_file.empty() || !config.inst_cfg_file.empty())
+    {
+        analysis_types.push_back(config.inst_cfg_file.empty() ? beKA::BeStaticIsaAnalysisType::kCfgPerBlock
+                                                               : beKA::BeStaticIsaAnalysisType::kCfgPerInstruction);
+    }
+
     // *****************************
     // Post-process for all devices.
     // *****************************
+    std::vector<beKA::BeStaticIsaAnalysisRequest> requests;
+    std::vector<KcVulkanDeviceAnalysis>           device_analyses;
     for (auto& device_md_node : output_metadata_)
     {
         bool               is_ok         = true;
@@ -240,23 +253,27 @@ void KcUtilsVulkan::RunPostProcessingSteps(const Config& config) const
             is_ok = ParseIsaFilesToCSV(true, device_string, device_md);
         }
 
-        // Analyze live registers (vgpr) if requested.
-        if (is_ok && !config.livereg_analysis_file.empty())
+        // Collect the live register analyses (vgpr, sgpr) and the CFG generation if requested.
+        for (beKA::BeStaticIsaAnalysisType type : analysis_types)
         {
-            is_ok = PerformLiveVgprAnalysis(config, device_string, device_md);
+            if (is_ok)
+            {
+                device_analyses.push_back({device_string, type, {}});
+                AddStaticIsaAnalysisRequests(config, device_string, type, device_md, requests, device_analyses.back().items);
+            }
         }
+    }
 
-        // Analyze live registers (sgpr) if requested.
-        if (is_ok && !config.sgpr_livereg_analysis_file.empty())
-        {
-            is_ok = PerformLiveSgprAnalysis(config, device_string, device_md);
-        }
+    // Submit the analyses of all devices in a single batch.
+    if (!requests.empty())
+    {
+        KcUtils::PerformStaticIsaAnalyses(requests, config);
+    }
 
-        // Generate CFG if requested.
-        if (is_ok && (!config.block_cfg_file.empty() || !config.inst_cfg_file.empty()))
-        {
-            is_ok = ExtractCFG(config, device_string, device_md);
-        }
+    // Report the results in device order.
+    for (const KcVulkanDeviceAnalysis& device_analysis : device_analyses)
+    {
+        ReportStaticIsaAnalysisResults(device_analysis.device, device_analysis.type, requests, device_analysis.items);
     }
 }
 
@@ -393,11 +410,12 @@ beKA::beStatus KcUtilsVulkan::WriteIsaToFile(const std::string& file_name, const
     return ret;
 }
 
+// Headers of the parsed ISA CSV files.
+static const char* kStrCsvParsedIsaHeader            = "Address, Opcode, Operands, Functional Unit, Cycles, Binary Encoding\n";
+static const char* kStrCsvParsedIsaHeaderLineNumbers = "Address, Source Line Number, Opcode, Operands, Functional Unit, Cycles, Binary Encoding\n";
+
 bool KcUtilsVulkan::GetParsedIsaCsvText(const std::string& isaText, const std::string& device, bool add_line_numbers, std::string& csv_text)
 {
-    static const char* kStrCsvParsedIsaHeader            = "Address, Opcode, Operands, Functional Unit, Cycles, Binary Encoding\n";
-    static const char* kStrCsvParsedIsaHeaderLineNumbers = "Address, Source Line Number, Opcode, Operands, Functional Unit, Cycles, Binary Encoding\n";
-
     bool        ret = false;
     std::string parsed_isa;
     if (BeProgramBuilder::ParseIsaToCsv(isaText, device, parsed_isa, add_line_numbers, true) == beKA::kBeStatusSuccess)
@@ -408,6 +426,12 @@ bool KcUtilsVulkan::GetParsedIsaCsvText(const std::string& isaText, const std::s
     return ret;
 }
 
+bool KcUtilsVulkan::WriteParsedIsaCsvFile(const std::string& isa_filename, const std::string& device, bool add_line_numbers, const std::string& csv_filename)
+{
+    const std::string csv_header = (add_line_numbers ? kStrCsvParsedIsaHeaderLineNumbers : kStrCsvParsedIsaHeader);
+    return BeProgramBuilder::ParseIsaFileToCsv(isa_filename, csv_filename, device, csv_header, add_line_numbers, true) == beKA::kBeStatusSuccess;
+}
+
 static std::string GetHardwareStageDotTokenStr(const std::string& hardware_stage_suffix)
 {
     std::stringstream hardwareStageDotToken;
@@ -13,6 +13,7 @@
 
 // Backend.
 #include "radeon_gpu_analyzer_backend/be_program_builder_vulkan.h"
+#include "radeon_gpu_analyzer_backend/be_static_isa_analyzer.h"
 
 // Local.
 #include "source/radeon_gpu_analyzer_cli/kc_data_types.h"
@@ -28,6 +29,9 @@ static const std::string kStrVulkanStatsFileExtension          = "csv";
 static const std::string kStrVulkanValidationInfoFileExtension = "txt";
 static const std::string kStrVulkanHlslFileExtension           = "hlsl";
 
+// A static ISA analysis of a pipeline stage.
+struct KcVulkanAnalysisItem;
+
 // Class for Vulkan mode utility functions for ISA Dissassembly and post-processing.
 class KcUtilsVulkan
 {
@@ -66,6 +70,10 @@ public:
     // Convert ISA text to CSV form with additional data.
     static bool GetParsedIsaCsvText(const std::string& isaText, const std::string& device, bool add_line_numbers, std::string& csvText);
 
+    // Convert the ISA file to CSV form with additional data and write it to "csv_filename".
+    // The ISA file is mapped to memory and the CSV rows are streamed to the output file.
+    static bool WriteParsedIsaCsvFile(const std::string& isa_filename, const std::string& device, bool add_line_numbers, const std::string& csv_filename);
+
     // Store ISA text in the file.
     static beKA::beStatus WriteIsaToFile(const std::string& file_name, const std::string& isa_text, LoggingCallbackFunction log_callback);
 
@@ -90,14 +98,20 @@ private:
     // Parse ISA files and generate separate files that contain parsed ISA in CSV format.
     bool ParseIsaFilesToCSV(bool add_line_numbers, const std::string& device_string, RgVkOutputMetadata& metadata) const;
 
-    // Perform the live registers analysis.
-    bool PerformLiveVgprAnalysis(const Config& config, const std::string& device_string, RgVkOutputMetadata& metadata) const;
-
-    // Perform the live registers analysis.
-    bool PerformLiveSgprAnalysis(const Config& config, const std::string& device_string, RgVkOutputMetadata& metadata) const;
-
-    // Generate the per-block or per-instruction Control Flow Graph.
-    bool ExtractCFG(const Config& config, const std::string& device_string, const RgVkOutputMetadata& metadata) const;
+    // Add the given static ISA analysis (live registers or Control Flow Graph) of the device's stages to the batch of analyses.
+    // Returns false if an output file name could not be constructed.
+    bool AddStaticIsaAnalysisRequests(const Config&                                  config,
+                                      const std::string&                             device_string,
+                                      beKA::BeStaticIsaAnalysisType                  type,
+                                      RgVkOutputMetadata&                            metadata,
+                                      std::vector<beKA::BeStaticIsaAnalysisRequest>& requests,
+                                      std::vector<KcVulkanAnalysisItem>&             items) const;
+
+    // Report the results of the given static ISA analysis of the device's stages and update the stages' output metadata.
+    bool ReportStaticIsaAnalysisResults(const std::string&                                   device_string,
+                                        beKA::BeStaticIsaAnalysisType                        type,
+                                        const std::vector<beKA::BeStaticIsaAnalysisRequest>& requests,
+                                        const std::vector<KcVulkanAnalysisItem>&             items) const;
 
     // Log result to stdout based on passed bool.
     void LogResult(bool result) const
@@ -7,11 +7,14 @@
 
 // C++
 #include <cassert>
+#include <filesystem>
+#include <fstream>
 #include <set>
 #include <vector>
 
 // Shared.
 #include "common/rga_entry_type.h"
+#include "common/rga_session_metadata_binary.h"
 #include "common/rga_shared_utils.h"
 #include "common/rga_sorting_utils.h"
 #include "common/rga_version_info.h"
@@ -24,9 +27,17 @@
 #include "radeon_gpu_analyzer_cli/kc_cli_config_file.h"
 #include "radeon_gpu_analyzer_cli/kc_xml_writer.h"
 
+namespace fs = std::filesystem;
+
 // Static constants.
 static const char* kStrFopenModeAppend = "a";
 
+// Map: kernel_name --> vector{pair{device, out_files}}.
+typedef std::map<std::string, std::vector<std::pair<std::string, RgOutputFiles>>> KernelOutputFilesMap;
+
+// Map: input_file_name --> KernelOutputFilesMap.
+typedef std::map<std::string, KernelOutputFilesMap> InputFileOutputFilesMap;
+
 // Creates an element that has value of any primitive type.
 template <typename T>
 static void AppendXMLElement(tinyxml2::XMLDocument &xml_doc, tinyxml2::XMLElement* parent, const char* elem_name, T elem_value)
@@ -402,9 +413,93 @@ static bool AddOutputFiles(tinyxml2::XMLDocument& doc, tinyxml2::XMLElement* ent
     return ret;
 }
 
+// Add the output files to a binary session metadata record, as AddOutputFiles() adds them to the XML document.
+static void EncodeOutputFiles(RgaSessionMetadataBinary::Encoder& encoder, const std::string& target, const RgOutputFiles& out_files)
+{
+    typedef RgaSessionMetadataBinary::FileType FileType;
+    const std::pair<FileType, const std::string*> files[] = {{FileType::kIsa, out_files.is_isa_file_temp ? nullptr : &out_files.isa_file},
+                                                             {FileType::kCsvIsa, &out_files.isa_csv_file},
+                                                             {FileType::kResUsage, &out_files.stats_file},
+                                                             {FileType::kLivereg, &out_files.livereg_file},
+                                                             {FileType::kLiveregSgpr, &out_files.livereg_sgpr_file},
+                                                             {FileType::kCfg, &out_files.cfg_file}};
+
+    uint32_t file_count = 0;
+    for (const auto& file : files)
+    {
+        file_count += (file.second != nullptr && !file.second->empty() ? 1 : 0);
+    }
+
+    encoder.AppendString(target);
+    encoder.AppendUint32(file_count);
+    for (const auto& file : files)
+    {
+        if (file.second != nullptr && !file.second->empty())
+        {
+            encoder.AppendUint8(static_cast<uint8_t>(file.first));
+            encoder.AppendString(*file.second);
+        }
+    }
+}
+
+// Add a record to the binary session metadata file of the given session metadata XML file, after the record was added to the XML file.
+// A new binary file is started with a new XML file. Otherwise, the record is only appended if the binary file matched the XML file
+// before the record was added to it, as identified by the given signature of the previous XML file. If the binary file cannot be kept
+// in sync with the XML file, it is removed, and readers use the XML file.
+static void WriteBinarySessionMetadataRecord(const std::string&                            xml_filename,
+                                             bool                                          is_new_xml_file,
+                                             const RgaSessionMetadataBinary::XmlSignature& previous_xml_signature,
+                                             RgaSessionMetadataBinary::Kind                kind,
+                                             const std::string&                            payload)
+{
+    const fs::path  binary_file_path(RgaSessionMetadataBinary::GetFilePath(xml_filename));
+    std::error_code ec;
+    bool            is_ok = false;
+
+    if (is_new_xml_file)
+    {
+        std::ofstream                    new_file(binary_file_path, std::ios::binary | std::ios::trunc);
+        RgaSessionMetadataBinary::Header header = RgaSessionMetadataBinary::CreateHeader(kind, {});
+        new_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        is_ok = new_file.good();
+    }
+    else if (fs::exists(binary_file_path, ec))
+    {
+        std::ifstream                    existing_file(binary_file_path, std::ios::binary);
+        RgaSessionMetadataBinary::Header header = {};
+        existing_file.read(reinterpret_cast<char*>(&header), sizeof(header));
+        is_ok = existing_file.good() &&
+                RgaSessionMetadataBinary::IsHeaderValid(reinterpret_cast<const char*>(&header), sizeof(header), kind, previous_xml_signature);
+    }
+
+    if (is_ok)
+    {
+        // Append the record, then update the XML file signature in the header.
+        std::fstream   file(binary_file_path, std::ios::binary | std::ios::in | std::ios::out);
+        const uint32_t payload_size = static_cast<uint32_t>(payload.size());
+        file.seekp(0, std::ios::end);
+        file.write(reinterpret_cast<const char*>(&payload_size), sizeof(payload_size));
+        file.write(payload.data(), payload.size());
+
+        RgaSessionMetadataBinary::XmlSignature xml_signature;
+        is_ok = RgaSessionMetadataBinary::GetXmlFileSignature(xml_filename, xml_signature);
+
+        RgaSessionMetadataBinary::Header header = RgaSessionMetadataBinary::CreateHeader(kind, xml_signature);
+        file.seekp(0, std::ios::beg);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        is_ok = is_ok && file.good();
+    }
+
+    if (!is_ok)
+    {
+        fs::remove(binary_file_path, ec);
+    }
+}
+
 bool KcXmlWriter::GenerateClSessionMetadataFile(const std::string& filename, const RgFileEntryData& file_entry_data, const RgClOutputMetadata& out_files)
 {
-    if (!BeUtils::IsFilePresent(filename))
+    const bool is_new_xml_file = !BeUtils::IsFilePresent(filename);
+    if (is_new_xml_file)
     {
         bool                  ret = true;
         tinyxml2::XMLDocument init;
@@ -429,11 +524,21 @@ bool KcXmlWriter::GenerateClSessionMetadataFile(const std::string& filename, con
     tinyxml2::XMLDocument doc;
     std::string           current_device = "";
 
+    RgaSessionMetadataBinary::XmlSignature previous_xml_signature;
+    if (!is_new_xml_file)
+    {
+        RgaSessionMetadataBinary::GetXmlFileSignature(filename, previous_xml_signature);
+    }
+
     tinyxml2::XMLElement* metadata = doc.NewElement(kStrXmlNodeMetadata);
     bool ret                       = (metadata != nullptr && doc.LinkEndChild(metadata) != nullptr);
 
+    // Map: input_file_name --> outFilesMap.
+    InputFileOutputFilesMap metadata_table;
+
     // Add binary name.
-    if (!out_files.empty() && !out_files.begin()->second.is_bin_file_temp)
+    const bool has_binary = !out_files.empty() && !out_files.begin()->second.is_bin_file_temp;
+    if (has_binary)
     {
         tinyxml2::XMLElement* binary_elem = doc.NewElement(kStrXmlNodeBinary);
         ret = ret && (binary_elem != nullptr && metadata->LinkEndChild(binary_elem) != nullptr);
@@ -446,10 +551,7 @@ bool KcXmlWriter::GenerateClSessionMetadataFile(const std::string& filename, con
     if (ret)
     {
         // Map: kernel_name --> vector{pair{device, out_files}}.
-        std::map<std::string, std::vector<std::pair<std::string, RgOutputFiles>>> out_files_map;
-
-        // Map: input_file_name --> outFilesMap.
-        std::map<std::string, decltype(out_files_map)> metadata_table;
+        KernelOutputFilesMap out_files_map;
 
         // Reorder the output file metadata in "kernel-first" order.
         for (const auto& out_file_set : out_files)
@@ -544,6 +646,48 @@ bool KcXmlWriter::GenerateClSessionMetadataFile(const std::string& filename, con
 
     ret = ret && WriteXMLDocToFile(doc, filename);
 
+    // Add the same metadata to the binary session metadata file.
+    if (ret && !filename.empty())
+    {
+        RgaSessionMetadataBinary::Encoder encoder;
+        encoder.AppendUint8(has_binary ? 1 : 0);
+        if (has_binary)
+        {
+            encoder.AppendString(out_files.begin()->second.bin_file);
+        }
+
+        encoder.AppendUint32(static_cast<uint32_t>(metadata_table.size()));
+        for (const auto& input_file_data : metadata_table)
+        {
+            encoder.AppendString(input_file_data.first);
+            encoder.AppendUint32(static_cast<uint32_t>(input_file_data.second.size()));
+            for (const auto& entry_data : input_file_data.second)
+            {
+                // The entry type was validated when it was added to the XML document.
+                const RgOutputFiles& first_out_files = entry_data.second[0].second;
+                const bool           abbreviation    = !first_out_files.entry_abbreviation.empty();
+                std::string          entry_type_str;
+                RgaEntryTypeUtils::GetEntryTypeStr(first_out_files.entry_type, entry_type_str);
+
+                encoder.AppendString(abbreviation ? first_out_files.entry_abbreviation : entry_data.first);
+                encoder.AppendString(entry_type_str);
+                encoder.AppendUint8(abbreviation ? 1 : 0);
+                if (abbreviation)
+                {
+                    encoder.AppendString(entry_data.first);
+                }
+
+                encoder.AppendUint32(static_cast<uint32_t>(entry_data.second.size()));
+                for (const std::pair<std::string, RgOutputFiles>& device_and_out_files : entry_data.second)
+                {
+                    EncodeOutputFiles(encoder, device_and_out_files.first, device_and_out_files.second);
+                }
+            }
+        }
+
+        WriteBinarySessionMetadataRecord(filename, is_new_xml_file, previous_xml_signature, RgaSessionMetadataBinary::Kind::kOpencl, encoder.GetBuffer());
+    }
+
     return ret;
 }
 
@@ -630,5 +774,46 @@ bool KcXmlWriter::GenerateVulkanSessionMetadataFile(const std::string&
 
     ret = ret && (doc.SaveFile(filename.c_str()) == tinyxml2::XML_SUCCESS);
 
+    // Write the same metadata to the binary session metadata file.
+    if (ret)
+    {
+        RgaSessionMetadataBinary::Encoder encoder;
+        uint32_t                          pipeline_count = 0;
+        for (const auto& output_metadata_for_device : output_metadata)
+        {
+            pipeline_count += (output_metadata_for_device.second.empty() ? 0 : 1);
+        }
+
+        encoder.AppendUint32(pipeline_count);
+        for (const auto& output_metadata_for_device : output_metadata)
+        {
+            const RgVkOutputMetadata& out_files_for_device = output_metadata_for_device.second;
+            if (!out_files_for_device.empty())
+            {
+                uint32_t stage_count = 0;
+                for (const RgOutputFiles& out_files : out_files_for_device)
+                {
+                    stage_count += (out_files.input_file.empty() ? 0 : 1);
+                }
+
+                encoder.AppendUint8(RgaEntryTypeUtils::IsComputeBitSet(out_files_for_device[0].entry_type) ? 1 : 0);
+                encoder.AppendUint32(stage_count);
+                for (const RgOutputFiles& out_files : out_files_for_device)
+                {
+                    if (!out_files.input_file.empty())
+                    {
+                        std::string entry_type_str;
+                        RgaEntryTypeUtils::GetEntryTypeStr(out_files.entry_type, entry_type_str);
+                        encoder.AppendString(entry_type_str);
+                        encoder.AppendString(out_files.input_file);
+                        EncodeOutputFiles(encoder, out_files.device, out_files);
+                    }
+                }
+            }
+        }
+
+        WriteBinarySessionMetadataRecord(filename, true, {}, RgaSessionMetadataBinary::Kind::kPipeline, encoder.GetBuffer());
+    }
+
     return ret;
 }
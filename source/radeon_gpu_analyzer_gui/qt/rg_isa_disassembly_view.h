@@ -205,6 +205,9 @@ protected slots:
     // Handler to open the GPU list widget.
     void HandleOpenGpuListWidget();
 
+    // Handler invoked when the rows of the selected entry are loaded into the isa item model.
+    void HandleIsaDataLoaded();
+
 protected:
     // A map that associates an GPU name to a list of program build outputs.
     typedef std::map<std::string, std::vector<RgEntryOutput>> GpuToEntryVector;
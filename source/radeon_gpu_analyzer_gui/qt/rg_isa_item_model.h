@@ -9,12 +9,19 @@
 #define RGA_RADEONGPUANALYZERGUI_INCLUDE_QT_RG_ISA_ITEM_MODEL_H_
 
 // C++.
+#include <atomic>
+#include <functional>
+#include <list>
+#include <memory>
 #include <set>
+#include <thread>
+#include <unordered_map>
 
 // Qt.
 #include <QWidget>
 
 // Infra.
+#include "amdisa/isa_decoder.h"
 #include "qt_isa_gui/widgets/isa_item_model.h"
 
 // Local.
@@ -82,25 +89,20 @@ public:
 
     } EntryData;
 
-    typedef struct RgIndexData
+    // Index data for the rows of a block, stored one column at a time.
+    // The vgpr column text and tooltip are built from these values when the view asks for them.
+    typedef struct RgBlockIndexData
     {
-        // Number of live registers units for the row.
-        std::string num_live_registers;
-        // Opcode for the row.
-        std::string opcode;
-        // Flag for max vgpr row.
-        bool is_max_vgpr_row = false;
-        // Input src line index correlated to the row.
-        int input_source_line_index = kInvalidCorrelationLineIndex;
-        // Flag for if the the row is correlated to the higlighted src row.
-        bool is_active_correlation = false;
-        // Tooltip for the vgpr column for the row.
-        std::string vgpr_tooltip;
-    } RgIndexData;
+        // Number of live VGPRs for each row, kLiveVgprsNotAvailable if the row does not match the livereg analysis, or kLiveVgprsNotAnalyzed.
+        std::vector<int> live_vgprs;
+        // Input src line index correlated to each row.
+        std::vector<int> input_source_line_indices;
+    } RgBlockIndexData;
 
     explicit RgIsaItemModel(QObject* parent = nullptr);
 
-    virtual ~RgIsaItemModel() = default;
+    // Destructor; cancels the file that is being read, if any.
+    virtual ~RgIsaItemModel();
 
     // Override column count to add columns specific to RGA.
     int columnCount(const QModelIndex& parent = QModelIndex()) const Q_DECL_OVERRIDE;
@@ -120,18 +122,30 @@ public:
     // Get the first isa row index for the given input source line number.
     QModelIndex GetFirstLineCorrelatedIndex(int input_source_line_index) const;
 
+    // Get the input source line whose isa rows are highlighted, or kInvalidCorrelationLineIndex if there is none.
+    int GetCorrelatedSourceLineIndex() const;
+
     // Get the isa row index for the current max vgpr.
     QModelIndex GetMaxVgprIndex() const;
 
-    // Set target gpu asic for the model.
+    // Set target gpu asic for the model, and start loading its isa spec.
     bool SetArchitecture(const std::string target_gpu);
 
     // Cache the sizes of columns based on the isa text that is currently in this model.
     void CacheSizeHints() override;
 
+    // Set the memory budget, in bytes, of the entries that are kept cached after they are loaded. 0 means no limit.
+    // The least recently shown entries are evicted when the budget is exceeded.
+    void SetCacheByteBudget(size_t byte_budget);
+
     // Get the cached column size for the requested column index and tree.
     QSize ColumnSizeHint(int column_index, IsaTreeView* tree) const override;
 
+signals:
+    // Emitted when the rows of the loaded entry become available: once the first batch of a file that is
+    // read in the background has been added, once the whole entry has been loaded, and after a load from the cache.
+    void IsaDataLoaded();
+
 protected:
     // Columns in the Parsed CSV file.
     enum CsvFileColumns
@@ -169,14 +183,70 @@ protected:
         RgIsaItemModel* isa_item_model_;
     };
 
+    // A range of consecutive rows of a block.
+    struct RowRange
+    {
+        int block;
+        int first_row;
+        int last_row;
+    };
+
+    // The rows correlated with each input src line, as ranges in row order.
+    typedef std::unordered_map<int, std::vector<RowRange>> SourceLineRowIndex;
+
+    // The data of an entry that was loaded. It is not modified once the entry is loaded, so it is shared
+    // by the cache and the model: switching to a cached entry does not copy it.
+    struct EntrySnapshot
+    {
+        // The isa blocks of the entry.
+        std::vector<std::shared_ptr<IsaItemModel::Block>> blocks;
+        // Index data for the rows of the blocks.
+        std::vector<RgBlockIndexData> index_data;
+        // The rows of the blocks correlated with each input src line.
+        SourceLineRowIndex source_line_rows;
+        // Livereg analysis data for the entry.
+        RgLiveregData livereg_data{};
+        // True if the livereg file of the entry was read, so that the live VGPRs of the rows come with the allocation granularity.
+        bool is_livereg_data_valid = false;
+        // The estimated memory used by the entry, in bytes.
+        size_t byte_size = 0;
+    };
+
     // Cached column widths.
     std::array<uint32_t, kColumnCount - IsaItemModel::kColumnCount> column_widths_ = {0, 0};
 
-    // Index data for the entry.
-    std::vector<std::vector<RgIndexData>> current_index_data_;
+    // The entry shown by the model, null while the entry is being loaded.
+    std::shared_ptr<const EntrySnapshot> current_entry_;
+
+    // Index data for the rows added so far, while the entry is being loaded.
+    std::vector<RgBlockIndexData> loading_index_data_;
+
+    // The rows added so far correlated with each input src line, while the entry is being loaded.
+    SourceLineRowIndex loading_source_line_rows_;
+
+    // The highlighted max vgpr row, as an index into the max vgpr line numbers of the entry, or -1 if none.
+    int current_max_vgpr_index_ = -1;
+
+    // The input src line whose isa rows are highlighted, if is_line_correlation_set_ is set.
+    int  correlated_source_line_index_ = kInvalidCorrelationLineIndex;
+    bool is_line_correlation_set_      = false;
 
-    // Livereg analysis data for the entry.
-    RgLiveregData current_livereg_data_;
+    // Index data for the rows of the entry shown by the model.
+    const std::vector<RgBlockIndexData>& GetCurrentIndexData() const;
+
+    // Livereg analysis data for the entry shown by the model.
+    const RgLiveregData& GetCurrentLiveregData() const;
+
+    // The rows correlated with each input src line for the entry shown by the model.
+    const SourceLineRowIndex& GetCurrentSourceLineRows() const;
+
+    // Add the rows of the given blocks to the input src line index. first_block is the position of the first given block in the entry.
+    // Rows without an input src line are not indexed.
+    static void IndexSourceLines(const std::vector<RgBlockIndexData>& index_data, int first_block, SourceLineRowIndex& source_line_rows);
+
+    // Notify the views that the rows correlated with the given input src line changed their highlight.
+    // Nothing is emitted for kInvalidCorrelationLineIndex: its rows are spread over the whole disassembly, so the views repaint instead.
+    void EmitSourceLineRowsChanged(int input_source_line_index);
 
     // Parses a single line of isa in the form of string into the list of strings, one for each column and a list of operands.
     // isa_line           A single line of isa in the form of a std::string that needs to be parsed.
@@ -184,40 +254,112 @@ protected:
     // operand_tokens_str Will contain the operands parsed out into their own string. Does not parse operands into 2 dimensional vector.
     void ParseCsvLine(QString isa_line, std::vector<std::string>& line_tokens, std::vector<std::string>& operand_tokens_str);
 
+    // Callback invoked by ReadIsaCsvFile with a range of blocks that are complete: the first block index and the block count.
+    typedef std::function<void(size_t, size_t)> PublishBlocksCallback;
+
     // Reads the csv file at the given path and uses its contents to populate a vector of SharedIsaItemModel blocks.
+    // This function does not access the state of the model, so that it can run on a worker thread.
     // csv_file_full_path The full path and file name of the csv file containng the isa.
+    // character_width    The width of a character of the fixed font, used to measure the label tokens.
+    // is_canceled        Reading stops when this flag is set.
+    // publish_blocks     Invoked with every batch of complete blocks, and with the remaining blocks at the end of the file.
     // blocks             Will contain the shared isa blocks require to populate the blocks_ structure and populate the tree.
-    void ReadIsaCsvFile(std::string                                        csv_file_full_path,
+    void ReadIsaCsvFile(const std::string&                                 csv_file_full_path,
+                        qreal                                              character_width,
+                        const std::atomic<bool>&                           is_canceled,
+                        const PublishBlocksCallback&                       publish_blocks,
                         std::vector<std::shared_ptr<IsaItemModel::Block>>& blocks,
-                        std::vector<std::vector<RgIndexData>>&             index_data);
+                        std::vector<RgBlockIndexData>&                     index_data);
 
-    // Reads the csv file at the given path and uses its contents to populate a vector of SharedIsaItemModel blocks.
-    bool ParseLiveVgprsData(const std::string&                                 live_vgpr_file_full_path,
-                            std::vector<std::shared_ptr<IsaItemModel::Block>>& blocks,
-                            std::vector<std::vector<RgIndexData>>&             index_data,
-                            RgLiveregData&                                     livereg_data);
+    // Reads the live VGPR file at the given path and uses its contents to populate the index data of the given blocks.
+    // The blocks are not modified: the label of the first block found in the file is returned in first_block_label.
+    bool ParseLiveVgprsData(const std::string&                                       live_vgpr_file_full_path,
+                            const std::vector<std::shared_ptr<IsaItemModel::Block>>& blocks,
+                            std::vector<RgBlockIndexData>&                           index_data,
+                            RgLiveregData&                                           livereg_data,
+                            std::string&                                             first_block_label);
 
     // Calculate the maximum number of VGPRs for the entry.
-    int CalculateMaxVgprs(std::vector<std::vector<RgIndexData>>&             index_data,
-                          std::vector<std::pair<int, int>>&                  max_line_numbers,
-                          std::vector<std::shared_ptr<IsaItemModel::Block>>& blocks);
+    static int CalculateMaxVgprs(const std::vector<RgBlockIndexData>&                     index_data,
+                                 std::vector<std::pair<int, int>>&                        max_line_numbers,
+                                 const std::vector<std::shared_ptr<IsaItemModel::Block>>& blocks);
 
     // Set the next/prev max vgpr line update.
     bool SetCurrentMaxVgprLine(EntryData::Operation op);
 
-    // Updates higlighted isa rows for the input source line number.
+    // Updates higlighted isa rows for the input source line number. Only the rows of the previous and the new line are updated.
     void SetLineCorrelatedIndices(int input_source_line_index);
 
+    // Helper function to create the vgpr column text of a row: the live VGPRs and the allocation granularity, "N/A", or empty.
+    QString CreateVgprText(int live_vgprs) const;
+
     // Helper function to create vgpr column tooltip.
-    void CreateVgprTooltip(std::string& tooltip, const std::string& num_live_registers) const;
+    static QString CreateVgprTooltip(int live_vgprs, int vgprs_granularity, int total_vgprs);
+
+    // Read the isa and livereg files of the given entry on a worker thread, and add the blocks to the model in batches.
+    void StartLoad(const EntryData& entry_data);
+
+    // Estimate the memory used by an entry, in bytes, from its blocks, its index data and the size of its isa file.
+    static size_t EstimateEntryByteSize(const EntrySnapshot& entry, qint64 isa_file_size);
+
+    // Stop the worker thread, if any. Batches that it already posted are discarded.
+    void CancelLoad();
+
+    // Wait for the isa spec of the architecture set by SetArchitecture() and use it to decode the instructions.
+    void ApplyArchitecture();
+
+    // Add a batch of blocks read by the worker thread to the model.
+    void AppendBlocks(uint64_t                                                 load_id,
+                      const std::vector<std::shared_ptr<IsaItemModel::Block>>& blocks,
+                      const std::vector<RgBlockIndexData>&                     index_data);
+
+    // Show the entry loaded by the worker thread, with its livereg data, and cache it.
+    void FinishLoad(uint64_t                             load_id,
+                    const std::string&                   csv_file_full_path,
+                    std::shared_ptr<const EntrySnapshot> entry,
+                    const std::string&                   first_block_label);
+
+    // Returns the cached entry for the given isa file and marks it as the most recently used, or null if it is not cached.
+    std::shared_ptr<const EntrySnapshot> FindCachedEntry(const std::string& csv_file_full_path);
+
+    // Add an entry to the cache as the most recently used, and evict the least recently used entries if the budget is exceeded.
+    void CacheEntry(const std::string& csv_file_full_path, std::shared_ptr<const EntrySnapshot> entry);
+
+    // Remove the entry for the given isa file from the cache, if it is cached.
+    void EvictCachedEntry(const std::string& csv_file_full_path);
+
+    // Evict the least recently used entries until the cached entries fit the budget. The most recently used entry is always kept.
+    void TrimCache();
+
+    // Remove the rows of the entry shown by the model and reset its highlighted rows.
+    void ClearCurrentEntry();
+
+    // Cached entries with their isa file paths, the most recently used first.
+    typedef std::list<std::pair<std::string, std::shared_ptr<const EntrySnapshot>>> EntryCacheList;
+    EntryCacheList cached_entries_;
+
+    // The cached entries by isa file path.
+    std::unordered_map<std::string, EntryCacheList::iterator> cached_entry_lookup_;
+
+    // The estimated memory used by the cached entries, in bytes.
+    size_t cached_entries_byte_size_ = 0;
+
+    // The memory budget of the cached entries, in bytes. 0 means no limit.
+    size_t cache_byte_budget_ = static_cast<size_t>(kDefaultDisassemblyCacheSizeMb) * 1024 * 1024;
+
+    // The worker thread that reads the files of the entry that is being loaded.
+    std::thread load_thread_;
+
+    // Set to stop the worker thread.
+    std::atomic<bool> is_load_canceled_{false};
 
-    // Cached Parsed csv data for all entries.
-    std::unordered_map<std::string, std::vector<std::shared_ptr<IsaItemModel::Block>>> cached_isa_;
+    // Identifies the current load, so that batches posted by a canceled load are discarded.
+    uint64_t load_id_ = 0;
 
-    // Cached index data for all entries.
-    std::unordered_map<std::string, std::vector<std::vector<RgIndexData>>> cached_index_data_;
+    // Path to the isa file that is being read by the worker thread, empty if none.
+    std::string loading_isa_file_path_;
 
-    // Cached livereg data for all entries.
-    std::unordered_map<std::string, RgLiveregData> cached_livereg_data_;
+    // The architecture of the target gpu asic.
+    amdisa::GpuArchitecture target_architecture_ = amdisa::GpuArchitecture::kUnknown;
 };
 #endif  // RGA_RADEONGPUANALYZERGUI_INCLUDE_QT_RG_ISA_ITEM_MODEL_H_
@@ -18,23 +18,15 @@ public:
     // Parse the live VGPR ISA line.
     static void ParseLiveVgprIsaLine(const QString& livereg_line, std::vector<std::shared_ptr<RgIsaLineInstruction>>& vgpr_isa_lines, bool is_label);
 
-    // Get the architecture specific information.
-    static bool GetArchInformation(RgLiveregData& livereg_data,
-                                   std::vector<QString>& vgpr_file_lines);
-
     // Calculate the maximum number of VGPRs for this shader.
     static int CalculateMaxVgprs(const std::vector<std::shared_ptr<RgIsaLineInstruction>>& vgpr_isa_lines,
                                  std::vector<int>& max_line_number,
                                  std::vector<std::shared_ptr<RgIsaLine>>& disassembled_isa_lines);
 
-    // Find out if this is a valid line.
-    static bool IsValidLine(const QString& livereg_line);
-
-    // Find out is this is a label line.
-    static bool IsLabelLine(const QString& livereg_line);
-
-    // Read the live VGPR output file.
-    static bool ReadLiveVgprsFile(const std::string& live_vgpr_file_full_path, std::vector<QString>& vgpr_file_lines);
+    // Read the live VGPR output file in a single pass over the memory mapped file.
+    // Fills vgpr_lines with the instruction lines and livereg_data with the architecture specific information.
+    // Returns true if the architecture specific information was found.
+    static bool ReadLiveVgprsFile(const std::string& live_vgpr_file_full_path, RgLiveVgprLines& vgpr_lines, RgLiveregData& livereg_data);
 
 private:
     RgOutputFileUtils()  = delete;
@@ -6,8 +6,15 @@
 //=============================================================================
 
 // C++.
-#include <sstream>
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <thread>
 
 // Qt
 #include <QtWidgets/QApplication>
@@ -140,6 +147,164 @@ void BuildOutputViewCommandHeader(std::shared_ptr<RgProject> project, const std:
     invocation_text = cmd_line_output_stream.str();
 }
 
+// A single CLI invocation that builds a project clone for one target GPU.
+struct RgCliInvocation
+{
+    // The target GPU.
+    std::string target_gpu;
+
+    // The full CLI command, including the target GPU.
+    std::string command;
+
+    // The text that is sent to the output window before the CLI output.
+    std::string header_text;
+};
+
+// Executes the given CLI invocations concurrently, up to the maximum number of parallel builds in the global settings.
+// The output of each invocation is sent to the output window in the order of the invocations,
+// so the output of a GPU is sent once the output of the GPUs before it was sent.
+// Setting cancel_signal terminates all running invocations and skips the ones that were not started.
+// Returns true if at least one invocation succeeded (its GPU is added to gpus_built), false otherwise.
+static bool ExecuteCliInvocations(const std::vector<RgCliInvocation>&     invocations,
+                                  std::function<void(const std::string&)> cli_output_handling_callback,
+                                  std::vector<std::string>&               gpus_built,
+                                  std::stringstream&                      full_cli_output,
+                                  bool&                                   cancel_signal)
+{
+    enum class InvocationState
+    {
+        kPending,
+        kRunning,
+        kSkipped,
+        kDone
+    };
+
+    bool ret = false;
+
+    // Determine the number of invocations that run concurrently.
+    size_t                                  max_parallel_builds = 0;
+    const std::shared_ptr<RgGlobalSettings> global_settings     = RgConfigManager::Instance().GetGlobalConfig();
+    if (global_settings != nullptr)
+    {
+        max_parallel_builds = global_settings->max_parallel_builds;
+    }
+    if (max_parallel_builds == 0)
+    {
+        max_parallel_builds = std::thread::hardware_concurrency();
+    }
+    const size_t worker_count = std::max<size_t>(1, std::min(max_parallel_builds, invocations.size()));
+
+    std::vector<InvocationState> states(invocations.size(), InvocationState::kPending);
+    std::vector<gtString>        outputs(invocations.size());
+    std::vector<bool>            results(invocations.size(), false);
+    size_t                       next_invocation = 0;
+    bool                         is_canceled     = false;
+    std::mutex                   state_lock;
+    std::condition_variable      state_changed;
+
+    // The cancel flag of each invocation, polled by its process launch outside of state_lock, hence atomic. Only this thread
+    // reads cancel_signal: it copies a cancellation to is_canceled and to the flags of the invocations while it waits for the workers.
+    std::unique_ptr<std::atomic<bool>[]> invocation_cancel_signals = std::make_unique<std::atomic<bool>[]>(invocations.size());
+
+    // Each worker executes the next pending invocation until none is left. After a cancellation, the remaining invocations are skipped.
+    auto worker = [&]() {
+        std::unique_lock<std::mutex> lock(state_lock);
+        while (next_invocation < invocations.size())
+        {
+            const size_t index = next_invocation++;
+            if (is_canceled)
+            {
+                states[index] = InvocationState::kSkipped;
+                state_changed.notify_all();
+            }
+            else
+            {
+                states[index] = InvocationState::kRunning;
+                state_changed.notify_all();
+                lock.unlock();
+
+                gtString   cmd_line_output_as_gt_str;
+                const bool is_succeeded =
+                    osExecAndGrabOutput(invocations[index].command.c_str(), invocation_cancel_signals[index], cmd_line_output_as_gt_str);
+
+                lock.lock();
+                outputs[index] = cmd_line_output_as_gt_str;
+                results[index] = is_succeeded;
+                states[index]  = InvocationState::kDone;
+                state_changed.notify_all();
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i < worker_count; i++)
+    {
+        workers.emplace_back(worker);
+    }
+
+    // Wait until the given invocation reaches a state, and forward a cancellation to the workers in the meantime.
+    const std::chrono::milliseconds kCancelPollInterval(50);
+    auto                            wait_for_invocation = [&](std::unique_lock<std::mutex>& lock, std::function<bool()> is_ready) {
+        while (!state_changed.wait_for(lock, kCancelPollInterval, is_ready))
+        {
+            if (cancel_signal && !is_canceled)
+            {
+                is_canceled = true;
+                std::fill(invocation_cancel_signals.get(), invocation_cancel_signals.get() + invocations.size(), true);
+            }
+        }
+    };
+
+    // Send the output of each invocation to the output window, in order.
+    for (size_t i = 0; i < invocations.size(); i++)
+    {
+        std::unique_lock<std::mutex> lock(state_lock);
+        wait_for_invocation(lock, [&]() { return states[i] != InvocationState::kPending; });
+        if (states[i] == InvocationState::kSkipped)
+        {
+            // Stop the process if build is canceled.
+            break;
+        }
+        lock.unlock();
+
+        // Send the header and the command text to the output window.
+        if (cli_output_handling_callback != nullptr)
+        {
+            cli_output_handling_callback(invocations[i].header_text);
+        }
+        RgLog::file << kStrLogLaunchingCli << RgLog::noflush << std::endl << invocations[i].command << std::endl << RgLog::flush;
+
+        lock.lock();
+        wait_for_invocation(lock, [&]() { return states[i] == InvocationState::kDone; });
+        const bool is_succeeded = results[i];
+        lock.unlock();
+
+        assert(is_succeeded);
+        if (is_succeeded)
+        {
+            // Add the GPU to the output list if it was built successfully.
+            gpus_built.push_back(invocations[i].target_gpu);
+            ret = true;
+        }
+
+        // Append the CLI's output to the string containing the entire execution output.
+        full_cli_output << outputs[i].asASCIICharArray();
+
+        // Invoke the callback used to send new CLI output to the GUI.
+        if (cli_output_handling_callback != nullptr)
+        {
+            cli_output_handling_callback(outputs[i].asASCIICharArray());
+        }
+    }
+
+    for (std::thread& worker_thread : workers)
+    {
+        worker_thread.join();
+    }
+
+    return ret;
+}
+
 bool RgCliLauncher::BuildProjectCloneOpencl(std::shared_ptr<RgProject>              project,
                                             int                                     clone_index,
                                             const std::string&                      output_path,
@@ -181,74 +346,45 @@ bool RgCliLauncher::BuildProjectCloneOpencl(std::shared_ptr<RgProject>
                 cmd << build_settings << " ";
             }
 
-            // Execute the CLI for each target GPU, appending the GPU to the command.
+            // Build the CLI command for each target GPU, appending the GPU to the command.
+            std::vector<RgCliInvocation> invocations;
             for (const std::string& target_gpu : target_clone->build_settings->target_gpus)
             {
-                if (!cancel_signal)
-                {
-                    // Print the command string that's about to be used to invoke the RGA CLI build process.
-                    std::string cli_invocation_command_string;
-                    BuildOutputViewCommandHeader(project, target_gpu, cli_invocation_command_string);
-
-                    // Append the command string header text to the output string.
-                    std::stringstream cmd_line_output_stream;
-                    cmd_line_output_stream << cli_invocation_command_string;
-
-                    // Construct the full CLI command string including the current target GPU.
-                    std::stringstream full_cmd_with_gpu;
-                    full_cmd_with_gpu << cmd.str();
-
-                    // Specify the Metadata file path.
-                    full_cmd_with_gpu << kStrCliOptSessionMetadata << " \"" << output_path << target_gpu << "_" << kStrSessionMetadataFilename << "\" ";
-
-                    // Specify which GPU to build outputs for.
-                    full_cmd_with_gpu << kStrCliOptAsic << " " << target_gpu << " ";
-
-                    // Append each input file to the end of the CLI command.
-                    for (const RgSourceFileInfo& file_info : target_clone->source_files)
-                    {
-                        // Surround the path to the input file with quotes to prevent breaking the CLI parser.
-                        full_cmd_with_gpu << "\"";
-                        full_cmd_with_gpu << file_info.file_path;
-                        full_cmd_with_gpu << "\" ";
-                    }
-
-                    // Add the full CLI execution string to the output window's log.
-                    cmd_line_output_stream << full_cmd_with_gpu.str();
+                // Print the command string that's about to be used to invoke the RGA CLI build process.
+                std::string cli_invocation_command_string;
+                BuildOutputViewCommandHeader(project, target_gpu, cli_invocation_command_string);
 
-                    // Send the new output text to the output window.
-                    if (cli_output_handling_callback != nullptr)
-                    {
-                        cli_output_handling_callback(cmd_line_output_stream.str());
-                    }
+                // Append the command string header text to the output string.
+                std::stringstream cmd_line_output_stream;
+                cmd_line_output_stream << cli_invocation_command_string;
 
-                    // Execute the command and grab the output.
-                    RgLog::file << kStrLogLaunchingCli << RgLog::noflush << std::endl << full_cmd_with_gpu.str() << std::endl << RgLog::flush;
-                    gtString cmd_line_output_as_gt_str;
-                    ret = osExecAndGrabOutput(full_cmd_with_gpu.str().c_str(), cancel_signal, cmd_line_output_as_gt_str);
+                // Construct the full CLI command string including the current target GPU.
+                std::stringstream full_cmd_with_gpu;
+                full_cmd_with_gpu << cmd.str();
 
-                    assert(ret);
-                    if (ret)
-                    {
-                        // Add the GPU to the output list if it was built successfully.
-                        gpu_built.push_back(target_gpu);
-                    }
+                // Specify the Metadata file path.
+                full_cmd_with_gpu << kStrCliOptSessionMetadata << " \"" << output_path << target_gpu << "_" << kStrSessionMetadataFilename << "\" ";
 
-                    // Append the CLI's output to the string containing the entire execution output.
-                    full_cli_output << cmd_line_output_as_gt_str.asASCIICharArray();
+                // Specify which GPU to build outputs for.
+                full_cmd_with_gpu << kStrCliOptAsic << " " << target_gpu << " ";
 
-                    // Invoke the callback used to send new CLI output to the GUI.
-                    if (cli_output_handling_callback != nullptr)
-                    {
-                        cli_output_handling_callback(cmd_line_output_as_gt_str.asASCIICharArray());
-                    }
-                }
-                else
+                // Append each input file to the end of the CLI command.
+                for (const RgSourceFileInfo& file_info : target_clone->source_files)
                 {
-                    // Stop the process if build is canceled.
-                    break;
+                    // Surround the path to the input file with quotes to prevent breaking the CLI parser.
+                    full_cmd_with_gpu << "\"";
+                    full_cmd_with_gpu << file_info.file_path;
+                    full_cmd_with_gpu << "\" ";
                 }
+
+                // Add the full CLI execution string to the output window's log.
+                cmd_line_output_stream << full_cmd_with_gpu.str();
+
+                invocations.push_back({target_gpu, full_cmd_with_gpu.str(), cmd_line_output_stream.str()});
             }
+
+            // Execute the CLI for all target GPUs.
+            ret = ExecuteCliInvocations(invocations, cli_output_handling_callback, gpu_built, full_cli_output, cancel_signal);
         }
         else
         {
@@ -322,151 +458,125 @@ bool RgCliLauncher::BuildProjectCloneVulkan(std::shared_ptr<RgProject>
                     assert(vulkan_util != nullptr);
                     if (vulkan_util != nullptr)
                     {
-                        // Execute the CLI for each target GPU, appending the GPU to the command.
+                        // Build the CLI command for each target GPU, appending the GPU to the command.
+                        std::vector<RgCliInvocation> invocations;
                         for (const std::string& target_gpu : target_clone->build_settings->target_gpus)
                         {
-                            if (!cancel_signal)
-                            {
-                                // Print the command string that's about to be used to invoke the RGA CLI build process.
-                                std::string cli_invocation_command_string;
-                                BuildOutputViewCommandHeader(project, target_gpu, cli_invocation_command_string);
+                            // Print the command string that's about to be used to invoke the RGA CLI build process.
+                            std::string cli_invocation_command_string;
+                            BuildOutputViewCommandHeader(project, target_gpu, cli_invocation_command_string);
 
-                                // Append the command string header text to the output string.
-                                std::stringstream cmd_line_output_stream;
-                                cmd_line_output_stream << cli_invocation_command_string;
+                            // Append the command string header text to the output string.
+                            std::stringstream cmd_line_output_stream;
+                            cmd_line_output_stream << cli_invocation_command_string;
 
-                                // Construct the full CLI command string including the current target GPU.
-                                std::stringstream full_cmd_with_gpu;
-                                full_cmd_with_gpu << cmd.str();
+                            // Construct the full CLI command string including the current target GPU.
+                            std::stringstream full_cmd_with_gpu;
+                            full_cmd_with_gpu << cmd.str();
 
-                                // Specify the Metadata file path.
-                                full_cmd_with_gpu << kStrCliOptSessionMetadata << " \"" << output_path << target_gpu << "_" << kStrSessionMetadataFilename
-                                                  << "\" ";
+                            // Specify the Metadata file path.
+                            full_cmd_with_gpu << kStrCliOptSessionMetadata << " \"" << output_path << target_gpu << "_" << kStrSessionMetadataFilename
+                                              << "\" ";
 
-                                // Specify which GPU to build outputs for.
-                                full_cmd_with_gpu << kStrCliOptAsic << " " << target_gpu << " ";
+                            // Specify which GPU to build outputs for.
+                            full_cmd_with_gpu << kStrCliOptAsic << " " << target_gpu << " ";
 
-                                // Provide the pipeline state object configuration file.
-                                for (auto pso_state_file : vulkan_clone->pso_states)
+                            // Provide the pipeline state object configuration file.
+                            for (auto pso_state_file : vulkan_clone->pso_states)
+                            {
+                                // Only append the path for the active PSO config.
+                                if (pso_state_file.is_active)
                                 {
-                                    // Only append the path for the active PSO config.
-                                    if (pso_state_file.is_active)
-                                    {
-                                        // Append the pipeline's state file path.
-                                        full_cmd_with_gpu << kStrCliOptPso << " \"" << pso_state_file.pipeline_state_file_path << "\" ";
-                                        break;
-                                    }
+                                    // Append the pipeline's state file path.
+                                    full_cmd_with_gpu << kStrCliOptPso << " \"" << pso_state_file.pipeline_state_file_path << "\" ";
+                                    break;
                                 }
+                            }
 
-                                // Append each active pipeline stage's input file to the command line.
-                                if (vulkan_clone->pipeline.type == RgPipelineType::kGraphics)
-                                {
-                                    size_t first_stage = static_cast<size_t>(RgPipelineStage::kVertex);
-                                    size_t last_stage  = static_cast<size_t>(RgPipelineStage::kFragment);
-
-                                    // Step through each stage in a graphics pipeline. If the project's
-                                    // stage is not empty, append the stage's shader file to the cmdline.
-                                    for (size_t stage_index = first_stage; stage_index <= last_stage; ++stage_index)
-                                    {
-                                        RgPipelineStage current_stage = static_cast<RgPipelineStage>(stage_index);
+                            // Append each active pipeline stage's input file to the command line.
+                            if (vulkan_clone->pipeline.type == RgPipelineType::kGraphics)
+                            {
+                                size_t first_stage = static_cast<size_t>(RgPipelineStage::kVertex);
+                                size_t last_stage  = static_cast<size_t>(RgPipelineStage::kFragment);
 
-                                        // Try to find the given stage within the pipeline's stage map.
-                                        const auto& stage_input_file = vulkan_clone->pipeline.shader_stages[stage_index];
-                                        if (!stage_input_file.empty())
-                                        {
-                                            // A source file exists in this stage. Append it to the command line.
-                                            std::string stage_abbreviation = vulkan_util->PipelineStageToAbbreviation(current_stage);
-
-                                            // Check to see if the file has txt extension.
-                                            if (RgUtils::IsSpvasTextFile(stage_input_file, stage_abbreviation))
-                                            {
-                                                // Append "-spvas" to stage abbreviation.
-                                                stage_abbreviation += kStrCliOptSpvasTextFile;
-                                            }
-
-                                            // Append the stage type and shader file path to the command line.
-                                            full_cmd_with_gpu << "--" << stage_abbreviation << " \"" << stage_input_file << "\" ";
-                                        }
-                                    }
-                                }
-                                else if (vulkan_clone->pipeline.type == RgPipelineType::kCompute)
+                                // Step through each stage in a graphics pipeline. If the project's
+                                // stage is not empty, append the stage's shader file to the cmdline.
+                                for (size_t stage_index = first_stage; stage_index <= last_stage; ++stage_index)
                                 {
-                                    RgPipelineStage current_stage = RgPipelineStage::kCompute;
+                                    RgPipelineStage current_stage = static_cast<RgPipelineStage>(stage_index);
 
-                                    // Does the pipeline have a compute shader source file?
-                                    const auto& compute_shader_input_source_file_path =
-                                        vulkan_clone->pipeline.shader_stages[static_cast<size_t>(current_stage)];
-                                    if (!compute_shader_input_source_file_path.empty())
+                                    // Try to find the given stage within the pipeline's stage map.
+                                    const auto& stage_input_file = vulkan_clone->pipeline.shader_stages[stage_index];
+                                    if (!stage_input_file.empty())
                                     {
                                         // A source file exists in this stage. Append it to the command line.
                                         std::string stage_abbreviation = vulkan_util->PipelineStageToAbbreviation(current_stage);
 
                                         // Check to see if the file has txt extension.
-                                        if (RgUtils::IsSpvasTextFile(compute_shader_input_source_file_path, stage_abbreviation))
+                                        if (RgUtils::IsSpvasTextFile(stage_input_file, stage_abbreviation))
                                         {
                                             // Append "-spvas" to stage abbreviation.
                                             stage_abbreviation += kStrCliOptSpvasTextFile;
                                         }
 
                                         // Append the stage type and shader file path to the command line.
-                                        full_cmd_with_gpu << "--" << stage_abbreviation << " \"" << compute_shader_input_source_file_path << "\" ";
+                                        full_cmd_with_gpu << "--" << stage_abbreviation << " \"" << stage_input_file << "\" ";
                                     }
                                 }
-                                else
-                                {
-                                    // The pipeline type can only be graphics or compute.
-                                    // If we get here something is wrong with the project clone.
-                                    assert(false);
-                                    ret = false;
-                                }
+                            }
+                            else if (vulkan_clone->pipeline.type == RgPipelineType::kCompute)
+                            {
+                                RgPipelineStage current_stage = RgPipelineStage::kCompute;
 
-                                // Verify that all operations up to this point were successful.
-                                assert(ret);
-                                if (ret)
+                                // Does the pipeline have a compute shader source file?
+                                const auto& compute_shader_input_source_file_path =
+                                    vulkan_clone->pipeline.shader_stages[static_cast<size_t>(current_stage)];
+                                if (!compute_shader_input_source_file_path.empty())
                                 {
-                                    // Add the full CLI execution string to the output window's log.
-                                    cmd_line_output_stream << full_cmd_with_gpu.str();
+                                    // A source file exists in this stage. Append it to the command line.
+                                    std::string stage_abbreviation = vulkan_util->PipelineStageToAbbreviation(current_stage);
 
-                                    // Send the new output text to the output window.
-                                    if (cli_output_handling_callback != nullptr)
+                                    // Check to see if the file has txt extension.
+                                    if (RgUtils::IsSpvasTextFile(compute_shader_input_source_file_path, stage_abbreviation))
                                     {
-                                        cli_output_handling_callback(cmd_line_output_stream.str());
+                                        // Append "-spvas" to stage abbreviation.
+                                        stage_abbreviation += kStrCliOptSpvasTextFile;
                                     }
 
-                                    // Execute the command and grab the output.
-                                    RgLog::file << kStrLogLaunchingCli << RgLog::noflush << std::endl << full_cmd_with_gpu.str() << std::endl << RgLog::flush;
-                                    gtString cmd_line_output_as_gt_str;
-                                    ret = osExecAndGrabOutput(full_cmd_with_gpu.str().c_str(), cancel_signal, cmd_line_output_as_gt_str);
-
-                                    assert(ret);
-                                    if (ret)
-                                    {
-                                        // Add the GPU to the output list if it was built successfully.
-                                        gpus_built.push_back(target_gpu);
-                                    }
-
-                                    // Append the CLI's output to the string containing the entire execution output.
-                                    full_cli_output << cmd_line_output_as_gt_str.asASCIICharArray();
-
-                                    // Invoke the callback used to send new CLI output to the GUI.
-                                    if (cli_output_handling_callback != nullptr)
-                                    {
-                                        cli_output_handling_callback(cmd_line_output_as_gt_str.asASCIICharArray());
-                                    }
-                                }
-                                else
-                                {
-                                    // Send a failure error message to the output window.
-                                    if (cli_output_handling_callback != nullptr)
-                                    {
-                                        cli_output_handling_callback(kStrErrFailedToGenerateBuildCommand);
-                                    }
+                                    // Append the stage type and shader file path to the command line.
+                                    full_cmd_with_gpu << "--" << stage_abbreviation << " \"" << compute_shader_input_source_file_path << "\" ";
                                 }
                             }
                             else
                             {
-                                // Stop the process if build is canceled.
-                                break;
+                                // The pipeline type can only be graphics or compute.
+                                // If we get here something is wrong with the project clone.
+                                assert(false);
+                                ret = false;
+                            }
+
+                            // Verify that all operations up to this point were successful.
+                            assert(ret);
+                            if (ret)
+                            {
+                                // Add the full CLI execution string to the output window's log.
+                                cmd_line_output_stream << full_cmd_with_gpu.str();
+
+                                invocations.push_back({target_gpu, full_cmd_with_gpu.str(), cmd_line_output_stream.str()});
+                            }
+                        }
+
+                        if (ret)
+                        {
+                            // Execute the CLI for all target GPUs.
+                            ret = ExecuteCliInvocations(invocations, cli_output_handling_callback, gpus_built, full_cli_output, cancel_signal);
+                        }
+                        else
+                        {
+                            // Send a failure error message to the output window.
+                            if (cli_output_handling_callback != nullptr)
+                            {
+                                cli_output_handling_callback(kStrErrFailedToGenerateBuildCommand);
                             }
                         }
                     }
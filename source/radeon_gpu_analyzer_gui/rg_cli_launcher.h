@@ -25,6 +25,7 @@ class RgCliLauncher
 {
 public:
     // Runs RGA CLI to compile the given Offline OpenCL project clone.
+    // The CLI is launched for the target GPUs concurrently, and its output is sent to the GUI in the order of the target GPUs.
     // project is the project containing the clone to be built.
     // clone_index is the index of the clone to be built.
     // outputPath is where the output files will be generated.
@@ -35,6 +36,7 @@ public:
         std::function<void(const std::string&)> cli_output_handling_callback, std::vector<std::string>& gpus_built, bool& cancel_signal);
 
     // Runs RGA CLI to compile the given Vulkan pipeline project clone.
+    // The CLI is launched for the target GPUs concurrently, and its output is sent to the GUI in the order of the target GPUs.
     // project is the project containing the clone to be built.
     // clone_index is the index of the clone to be built.
     // outputPath is where the output files will be generated.
@@ -1042,6 +1042,10 @@ bool RgXmlConfigFile::WriteGlobalSettings(std::shared_ptr<RgGlobalSettings> glob
 
             RgXMLUtils::AppendXMLElement(doc, global_settings_elem, kXmlNodeGlobalDefaultSrcLang, (uint32_t)global_settings->default_lang);
 
+            RgXMLUtils::AppendXMLElement(doc, global_settings_elem, kXmlNodeGlobalMaxParallelBuilds, global_settings->max_parallel_builds);
+
+            RgXMLUtils::AppendXMLElement(doc, global_settings_elem, kXmlNodeGlobalDisassemblyCacheSizeMb, global_settings->disassembly_cache_size_mb);
+
             // Create "GUI" element.
             tinyxml2::XMLElement* gui_element = doc.NewElement(kXmlNodeGlobalGui);
             assert(gui_element != nullptr);
@@ -1881,6 +1885,26 @@ static bool ExtractGlobalSettings_2_3(tinyxml2::XMLNode* global_settings_node, s
         ret = ret && RgXMLUtils::ReadNodeTextUnsigned(elem, (uint32_t&)global_settings->default_lang);
     }
     if (ret)
+    {
+        // Read the maximum number of concurrent builds. Older config files do not have it, in which case the default is used.
+        tinyxml2::XMLElement* test_elem = elem->NextSiblingElement(kXmlNodeGlobalMaxParallelBuilds);
+        if (test_elem != nullptr)
+        {
+            ret  = RgXMLUtils::ReadNodeTextUnsigned(test_elem, global_settings->max_parallel_builds);
+            elem = test_elem;
+        }
+    }
+    if (ret)
+    {
+        // Read the memory budget of the cached disassembly. Older config files do not have it, in which case the default is used.
+        tinyxml2::XMLElement* test_elem = elem->NextSiblingElement(kXmlNodeGlobalDisassemblyCacheSizeMb);
+        if (test_elem != nullptr)
+        {
+            ret  = RgXMLUtils::ReadNodeTextUnsigned(test_elem, global_settings->disassembly_cache_size_mb);
+            elem = test_elem;
+        }
+    }
+    if (ret)
     {
         // Extract splitter config objects from the "GUI" node.
         elem = elem->NextSiblingElement(kXmlNodeGlobalGui);
@@ -310,6 +310,12 @@ static const char* kXmlNodeGlobalInputFileExtSpvBin = "InputFileExtSpvBin";
 // Default source language.
 static const char* kXmlNodeGlobalDefaultSrcLang = "DefaultSrcLanguage";
 
+// The maximum number of concurrent CLI build processes.
+static const char* kXmlNodeGlobalMaxParallelBuilds = "MaxParallelBuilds";
+
+// The memory budget, in megabytes, of the cached disassembly.
+static const char* kXmlNodeGlobalDisassemblyCacheSizeMb = "DisassemblyCacheSizeMb";
+
 // *****************************
 // *** GLOBAL SETTINGS - END ***
 // *****************************
@@ -398,6 +398,11 @@ void RgConfigManager::ResetToFactoryDefaults(RgGlobalSettings& global_settings)
     global_settings.input_file_ext_spv_txt = kStrGlobalSettingsFileExtSpvasm;
     global_settings.input_file_ext_spv_bin = kStrGlobalSettingsFileExtSpv;
 
+    // Default to one concurrent build per hardware thread.
+    global_settings.max_parallel_builds = 0;
+
+    global_settings.disassembly_cache_size_mb = kDefaultDisassemblyCacheSizeMb;
+
     global_settings.default_lang = RgSrcLanguage::kGLSL;
 }
 
@@ -24,6 +24,7 @@
 
 // Local.
 #include "radeon_gpu_analyzer_gui/rg_config_manager.h"
+#include "radeon_gpu_analyzer_gui/rg_definitions.h"
 #include "radeon_gpu_analyzer_gui/rg_string_constants.h"
 
 // The type of the project.
@@ -362,7 +363,19 @@ struct RgLiveregData
     int                              max_vgprs;
     int                              unmatched_count;
     std::vector<std::pair<int, int>> max_vgpr_line_numbers;
-    int                              current_max_vgpr_line_numbers_index = -1;
+};
+
+// A structure used to hold the instruction lines of a livereg output file.
+struct RgLiveVgprLines
+{
+    // The number of live VGPRs for every instruction line, or kLiveVgprsNotAvailable if the line format was not recognized.
+    std::vector<int> live_vgprs;
+    // The opcode of every instruction line, empty if the line format was not recognized.
+    std::vector<std::string> opcodes;
+    // The index of the first instruction line that starts with a label, or -1 if there is none.
+    int first_label_line = -1;
+    // The text of the first label, without its "label__" prefix.
+    std::string first_label;
 };
 
 // A structure used to hold project path and api type for each RGA project.
@@ -401,6 +414,8 @@ struct RgGlobalSettings
         , input_file_ext_spv_txt(other.input_file_ext_spv_txt)
         , input_file_ext_spv_bin(other.input_file_ext_spv_bin)
         , default_lang(other.default_lang)
+        , max_parallel_builds(other.max_parallel_builds)
+        , disassembly_cache_size_mb(other.disassembly_cache_size_mb)
     {
     }
 
@@ -413,7 +428,8 @@ struct RgGlobalSettings
                       (color_theme == other.color_theme) && (include_files_viewer == other.include_files_viewer) &&
                       (input_file_ext_glsl == other.input_file_ext_glsl) && (input_file_ext_hlsl == other.input_file_ext_hlsl) &&
                       (input_file_ext_spv_txt == other.input_file_ext_spv_txt) && (input_file_ext_spv_bin == other.input_file_ext_spv_bin) &&
-                      (default_lang == other.default_lang);
+                      (default_lang == other.default_lang) && (max_parallel_builds == other.max_parallel_builds) &&
+                      (disassembly_cache_size_mb == other.disassembly_cache_size_mb);
 
         return isSame;
     }
@@ -475,6 +491,14 @@ struct RgGlobalSettings
 
     // Default high-level language.
     RgSrcLanguage default_lang = RgSrcLanguage::kGLSL;
+
+    // The maximum number of CLI processes that build a project for its target GPUs concurrently.
+    // 0 means one process per available hardware thread.
+    unsigned max_parallel_builds = 0;
+
+    // The memory budget, in megabytes, of the disassembly that the disassembly view keeps cached
+    // for switching between entries and GPUs. 0 means no limit.
+    unsigned disassembly_cache_size_mb = kDefaultDisassemblyCacheSizeMb;
 };
 
 // The possible types of build output files.
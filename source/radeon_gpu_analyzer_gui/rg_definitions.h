@@ -28,6 +28,15 @@ static const int kTextTruncateLengthBackVulkan = 2;
 // The constant used when the selected line in the source file doesn't have any correlated disassembly lines.
 static const int kInvalidCorrelationLineIndex = -1;
 
+// Live VGPR count of an instruction that has no live register information.
+static const int kLiveVgprsNotAvailable = -1;
+
+// Live VGPR count of an isa row that was not analyzed: a comment row, or any row until the livereg file is read.
+static const int kLiveVgprsNotAnalyzed = -2;
+
+// The default memory budget, in megabytes, of the disassembly that the disassembly view keeps cached.
+static const unsigned kDefaultDisassemblyCacheSizeMb = 512;
+
 // The duration, in milliseconds, of how long that the status bar text will remain before being cleared.
 const int kStatusBarNotificationTimeoutMs = 3000;
 
@@ -7,6 +7,7 @@
 
 // C++.
 #include <filesystem>
+#include <future>
 #include <string>
 
 // Qt.
@@ -40,22 +41,73 @@ amdisa::DecodeManager* RgIsaDecodeManager::Get()
 
         if (std::filesystem::exists(isa_spec_dir_path) && std::filesystem::is_directory(isa_spec_dir_path))
         {
-            std::string              initialize_error_message;
-            std::vector<std::string> xml_file_paths;
+            // The specs are large, so they are not parsed here: each one is loaded when its architecture is first needed.
+            isa_spec_dir_path_ = isa_spec_dir_path;
+            decode_manager_    = std::make_unique<amdisa::DecodeManager>();
+        }
+    }
+    return decode_manager_.get();
+}
+
+void RgIsaDecodeManager::LoadArchitecture(amdisa::GpuArchitecture architecture)
+{
+    const auto isa_spec = kIsaSpecNameMap.find(architecture);
+    if (Get() != nullptr && isa_spec != kIsaSpecNameMap.end() && architecture_loads_.find(architecture) == architecture_loads_.end())
+    {
+        std::filesystem::path isa_spec_path(isa_spec_dir_path_);
+        isa_spec_path /= isa_spec->second;
+        isa_spec_path.make_preferred();
+
+        const std::string isa_spec_file_path = isa_spec_path.string();
 
-            for (const auto& isa_spec : kIsaSpecNameMap)
+        // Parse the specs on a background thread, into a decode manager that no other thread sees until
+        // WaitForArchitecture() moves it into the shared one. Loads are chained: each one waits for the previous one
+        // and initializes its manager with the specs that loaded so far, plus its own, in a single call.
+        const size_t generation    = ++load_count_;
+        auto         previous_load = last_load_;
+        auto         load_spec     = [generation, previous_load, isa_spec_file_path]() {
+            ArchitectureLoad load;
+            load.generation = generation;
+            if (previous_load.valid())
             {
-                const auto            isa_spec_name = isa_spec.second;
-                std::filesystem::path isa_spec_path(isa_spec_dir_path);
-                isa_spec_path /= isa_spec_name;
-                isa_spec_path.make_preferred();
+                load.isa_spec_file_paths = previous_load.get().isa_spec_file_paths;
+            }
+            load.isa_spec_file_paths.push_back(isa_spec_file_path);
 
-                xml_file_paths.emplace_back(isa_spec_path.string());
+            std::string initialize_error_message;
+            auto        decode_manager = std::make_shared<amdisa::DecodeManager>();
+            if (decode_manager->Initialize(load.isa_spec_file_paths, initialize_error_message))
+            {
+                load.decode_manager = decode_manager;
             }
+            else
+            {
+                // Leave the failed spec out of the later loads.
+                load.isa_spec_file_paths.pop_back();
+            }
+            return load;
+        };
+        last_load_                        = std::async(std::launch::async, load_spec).share();
+        architecture_loads_[architecture] = last_load_;
+    }
+}
 
-            decode_manager_ = std::make_unique<amdisa::DecodeManager>();
-            decode_manager_->Initialize(xml_file_paths, initialize_error_message);
+bool RgIsaDecodeManager::WaitForArchitecture(amdisa::GpuArchitecture architecture)
+{
+    bool       ret  = false;
+    const auto load = architecture_loads_.find(architecture);
+    if (load != architecture_loads_.end())
+    {
+        const ArchitectureLoad& result = load->second.get();
+        ret                            = (result.decode_manager != nullptr);
+
+        // A newer load holds the decoders of every older one, so only move it into the shared manager if it was not
+        // superseded. This happens on the GUI thread, which is the only thread that decodes with the shared manager.
+        if (ret && result.generation > installed_generation_)
+        {
+            *decode_manager_      = std::move(*result.decode_manager);
+            installed_generation_ = result.generation;
         }
     }
-    return decode_manager_.get();
+    return ret;
 }
@@ -8,7 +8,12 @@
 #define RGA_RADEONGPUANALYZERGUI_INCLUDE_RG_ISA_DECODE_MANAGER_H_
 
 // C++.
+#include <filesystem>
+#include <future>
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 // Isa Decoder.
 #include "amdisa/isa_decoder.h"
@@ -23,9 +28,18 @@ public:
         return instance;
     }
 
-    // Get the handle to the isa decode manager.
+    // Get the handle to the isa decode manager, or nullptr if the isa spec folder is missing.
+    // The manager only holds the decoders of the architectures loaded by WaitForArchitecture(), and is only
+    // accessed on the GUI thread.
     amdisa::DecodeManager* Get();
 
+    // Start loading the isa spec of the given architecture on a background thread, unless it was already requested.
+    void LoadArchitecture(amdisa::GpuArchitecture architecture);
+
+    // Wait until the isa spec of the given architecture is loaded, and make it available through the manager.
+    // Returns true if the spec was loaded, false if it failed to load or was never requested.
+    bool WaitForArchitecture(amdisa::GpuArchitecture architecture);
+
 private:
     // Private constructor to prevent instantiation from outside.
     RgIsaDecodeManager()  = default;
@@ -35,8 +49,35 @@ private:
     RgIsaDecodeManager(const RgIsaDecodeManager&)            = delete;
     RgIsaDecodeManager& operator=(const RgIsaDecodeManager&) = delete;
 
-    // The manager of all the architectures.
+    // The result of a background load.
+    struct ArchitectureLoad
+    {
+        // The order of the load: a load includes the specs of all the earlier loads that succeeded.
+        size_t generation = 0;
+
+        // The spec files that the decode manager of the load was initialized with.
+        std::vector<std::string> isa_spec_file_paths;
+
+        // A decode manager of its own for the load, or nullptr if the spec of the architecture failed to load.
+        std::shared_ptr<amdisa::DecodeManager> decode_manager;
+    };
+
+    // The manager of all the loaded architectures. Models keep a pointer to it, so it is never replaced:
+    // the manager of a newer load is moved into it.
     std::unique_ptr<amdisa::DecodeManager> decode_manager_;
+
+    // The folder that contains the isa spec files.
+    std::filesystem::path isa_spec_dir_path_;
+
+    // The loads of the requested architectures.
+    std::unordered_map<amdisa::GpuArchitecture, std::shared_future<ArchitectureLoad>> architecture_loads_;
+
+    // The most recently requested load, which the next load builds upon.
+    std::shared_future<ArchitectureLoad> last_load_;
+
+    // The number of loads requested, and the generation of the load whose manager was moved into decode_manager_.
+    size_t load_count_           = 0;
+    size_t installed_generation_ = 0;
 };
 
 #endif  // RGA_RADEONGPUANALYZERGUI_INCLUDE_RG_ISA_DECODE_MANAGER_H_
@@ -160,29 +160,10 @@ void RgIsaDisassemblyView::HandleSelectedEntrypointChanged(const std::string& ta
             entry_data.operation      = RgIsaItemModel::EntryData::Operation::kLoadData;
             if (rg_isa_widget_ && rg_isa_item_model_)
             {
+                // The view is refreshed by HandleIsaDataLoaded() when the rows of the entry become available.
                 rg_isa_item_model_->UpdateData(&entry_data);
 
-                rg_isa_widget_->UpdateSpannedColumns();
-
-                const int max_line_number = rg_isa_item_model_->GetLineCount() > 0 ? rg_isa_item_model_->GetLineCount() - 1 : 0;
-                rg_isa_widget_->SetGoToLineValidatorLineCount(max_line_number);
-
-                rg_isa_widget_->Search();
-
                 rg_isa_widget_->ClearHistory();
-
-                // Don't bother updating the max vgpr indices until the expand/collapse state is set.
-                rg_isa_tree_view_->blockSignals(true);
-
-                rg_isa_widget_->ExpandCollapseAll();
-
-                rg_isa_tree_view_->blockSignals(false);
-
-                std::vector<QModelIndex> source_indices;
-                rg_isa_item_model_->GetMaxVgprPressureIndices(source_indices);
-                std::set<QModelIndex> source_indices_set(source_indices.begin(), source_indices.end());
-
-                rg_isa_tree_view_->SetHotSpotLineNumbers(source_indices_set);
             }
 
             // Update current key for the isa disassembly view data.
@@ -206,6 +187,32 @@ void RgIsaDisassemblyView::HandleSelectedEntrypointChanged(const std::string& ta
     }
 }
 
+void RgIsaDisassemblyView::HandleIsaDataLoaded()
+{
+    if (rg_isa_widget_ && rg_isa_item_model_)
+    {
+        rg_isa_widget_->UpdateSpannedColumns();
+
+        const int max_line_number = rg_isa_item_model_->GetLineCount() > 0 ? rg_isa_item_model_->GetLineCount() - 1 : 0;
+        rg_isa_widget_->SetGoToLineValidatorLineCount(max_line_number);
+
+        rg_isa_widget_->Search();
+
+        // Don't bother updating the max vgpr indices until the expand/collapse state is set.
+        rg_isa_tree_view_->blockSignals(true);
+
+        rg_isa_widget_->ExpandCollapseAll();
+
+        rg_isa_tree_view_->blockSignals(false);
+
+        std::vector<QModelIndex> source_indices;
+        rg_isa_item_model_->GetMaxVgprPressureIndices(source_indices);
+        std::set<QModelIndex> source_indices_set(source_indices.begin(), source_indices.end());
+
+        rg_isa_tree_view_->SetHotSpotLineNumbers(source_indices_set);
+    }
+}
+
 void RgIsaDisassemblyView::EnableShowMaxVgprContextOption() const
 {
     emit EnableShowMaxVgprOptionSignal(IsMaxVgprColumnVisible());
@@ -297,6 +304,7 @@ void RgIsaDisassemblyView::CreateIsaTreeView(QWidget* disassembly_view_parent)
     rg_isa_proxy_model_ = new RgIsaProxyModel(rg_isa_widget_, column_visiblity);
 
     rg_isa_item_model_ = new RgIsaItemModel(rg_isa_widget_);
+    rg_isa_item_model_->SetCacheByteBudget(static_cast<size_t>(global_settings->disassembly_cache_size_mb) * 1024 * 1024);
 
     rg_isa_tree_view_ = new RgIsaTreeView(rg_isa_widget_, this);
 
@@ -383,6 +391,10 @@ void RgIsaDisassemblyView::ConnectIsaTreeViewSignals()
 
     is_connected = connect(this, &RgIsaDisassemblyView::EnableShowMaxVgprOptionSignal, rg_isa_tree_view_, &RgIsaTreeView::HandleEnableShowMaxVgprOptionSignal);
     assert(is_connected);
+
+    // Connect the handler to refresh the view when the rows of the selected entry are loaded.
+    is_connected = connect(rg_isa_item_model_, &RgIsaItemModel::IsaDataLoaded, this, &RgIsaDisassemblyView::HandleIsaDataLoaded);
+    assert(is_connected);
 }
 
 void RgIsaDisassemblyView::CreateKernelNameLabel()
@@ -6,15 +6,19 @@
 //=============================================================================
 
 // C++.
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <sstream>
 
 // Qt.
 #include <QFile>
+#include <QFileInfo>
 #include <QFont>
 #include <QFontMetrics>
 #include <QLabel>
 #include <QMenu>
+#include <QMetaObject>
 #include <QObject>
 #include <QPainter>
 #include <QScrollBar>
@@ -42,6 +46,20 @@
 
 static const std::string kStrNA = "N/A";
 
+// The livereg data of an entry that is being loaded.
+static const RgLiveregData kEmptyLiveregData{};
+
+// Number of rows after which the blocks read so far are added to the model. The first batch is
+// small so that the first screen of the disassembly is shown as soon as possible.
+static const size_t kIsaLoadFirstBatchRowCount = 256;
+static const size_t kIsaLoadBatchRowCount      = 4096;
+
+// Returns the width of the given text in a fixed width font with the given character width.
+static int GetFixedFontTextWidth(const std::string& text, qreal character_width)
+{
+    return static_cast<int>(std::ceil(text.size() * character_width));
+}
+
 const std::array<std::string, RgIsaItemModel::kColumnCount - IsaItemModel::kColumnCount> RgIsaItemModel::kColumnNames = {
     "VGPR pressure (used:%1, allocated:%2/%3)",
     "Functional group"};  ///< Predefined column headers.
@@ -51,6 +69,11 @@ RgIsaItemModel::RgIsaItemModel(QObject* parent)
 {
 }
 
+RgIsaItemModel::~RgIsaItemModel()
+{
+    CancelLoad();
+}
+
 int RgIsaItemModel::columnCount(const QModelIndex& parent) const
 {
     Q_UNUSED(parent);
@@ -74,16 +97,17 @@ QVariant RgIsaItemModel::headerData(int section, Qt::Orientation orientation, in
 
     if (section == RgIsaItemModel::Columns::kIsaColumnVgprPressure)
     {
+        const RgLiveregData& livereg_data = GetCurrentLiveregData();
         if (role == Qt::DisplayRole)
         {
             header_data = QString(kColumnNames[section - IsaItemModel::kColumnCount].c_str())
-                              .arg(QString::number(current_livereg_data_.used))
-                              .arg(QString::number(current_livereg_data_.allocated))
-                              .arg(QString::number(current_livereg_data_.total_vgprs));
+                              .arg(QString::number(livereg_data.used))
+                              .arg(QString::number(livereg_data.allocated))
+                              .arg(QString::number(livereg_data.total_vgprs));
         }
 
         // Show the hazard icon if we've hit more than the max live VGPRs.
-        if (current_livereg_data_.max_vgprs >= current_livereg_data_.total_vgprs)
+        if (livereg_data.max_vgprs >= livereg_data.total_vgprs)
         {
             if (role == Qt::DecorationRole)
             {
@@ -96,7 +120,7 @@ QVariant RgIsaItemModel::headerData(int section, Qt::Orientation orientation, in
         }
 
         // Show the warning icon and a tooltip if instructions did not match.
-        if (current_livereg_data_.unmatched_count > 0)
+        if (livereg_data.unmatched_count > 0)
         {
             if (role == Qt::DecorationRole)
             {
@@ -104,7 +128,7 @@ QVariant RgIsaItemModel::headerData(int section, Qt::Orientation orientation, in
             }
             else if (role == Qt::ToolTipRole)
             {
-                header_data = QString(kLiveVgprNATooltip).arg(current_livereg_data_.unmatched_count);
+                header_data = QString(kLiveVgprNATooltip).arg(livereg_data.unmatched_count);
             }
         }
     }
@@ -134,17 +158,24 @@ QVariant RgIsaItemModel::data(const QModelIndex& index, int role) const
     {
         if (index.parent().isValid())
         {
-            RgIndexData index_data = current_index_data_.at(index.parent().row()).at(index.row());
+            const RgBlockIndexData& index_data = GetCurrentIndexData().at(index.parent().row());
             switch (role)
             {
             case RgIsaItemModel::UserRoles::kMaxVgprLineRole:
-                data.setValue(index_data.is_max_vgpr_row);
+            {
+                // The highlighted max vgpr row is kept by the model, since the entry data is shared with the cache.
+                const std::vector<std::pair<int, int>>& max_vgpr_line_numbers = GetCurrentLiveregData().max_vgpr_line_numbers;
+                const bool                              is_max_vgpr_row =
+                    current_max_vgpr_index_ >= 0 && current_max_vgpr_index_ < static_cast<int>(max_vgpr_line_numbers.size()) &&
+                    max_vgpr_line_numbers[current_max_vgpr_index_] == std::pair<int, int>(index.parent().row(), index.row());
+                data.setValue(is_max_vgpr_row);
                 break;
+            }
             case RgIsaItemModel::UserRoles::kSrcLineToIsaRowRole:
-                data.setValue(index_data.is_active_correlation);
+                data.setValue(is_line_correlation_set_ && index_data.input_source_line_indices.at(index.row()) == correlated_source_line_index_);
                 break;
             case RgIsaItemModel::UserRoles::kIsaRowToSrcLineRole:
-                data.setValue(index_data.input_source_line_index);
+                data.setValue(index_data.input_source_line_indices.at(index.row()));
                 break;
             default:
                 break;
@@ -172,12 +203,10 @@ QVariant RgIsaItemModel::data(const QModelIndex& index, int role) const
     {
         if (index.parent().isValid())
         {
-            RgIndexData index_data = current_index_data_.at(index.parent().row()).at(index.row());
-
             switch (index.column())
             {
             case Columns::kIsaColumnVgprPressure:
-                data.setValue(QString(index_data.num_live_registers.c_str()));
+                data.setValue(CreateVgprText(GetCurrentIndexData().at(index.parent().row()).live_vgprs.at(index.row())));
                 break;
             case Columns::kIsaColumnFunctionalUnit:
             {
@@ -195,13 +224,23 @@ QVariant RgIsaItemModel::data(const QModelIndex& index, int role) const
     case Qt::ToolTipRole:
         if (index.parent().isValid())
         {
-            RgIndexData index_data = current_index_data_.at(index.parent().row()).at(index.row());
-
             switch (index.column())
             {
             case Columns::kIsaColumnVgprPressure:
-                data.setValue(QString(index_data.vgpr_tooltip.c_str()));
+            {
+                // The tooltip is only built for the row that the view asks for.
+                const int live_vgprs = GetCurrentIndexData().at(index.parent().row()).live_vgprs.at(index.row());
+                if (current_entry_ != nullptr && current_entry_->is_livereg_data_valid && live_vgprs >= 0)
+                {
+                    const RgLiveregData& livereg_data = current_entry_->livereg_data;
+                    data.setValue(CreateVgprTooltip(live_vgprs, livereg_data.vgprs_granularity, livereg_data.total_vgprs));
+                }
+                else
+                {
+                    data.setValue(QString());
+                }
                 break;
+            }
             default:
                 break;
             }
@@ -292,12 +331,13 @@ void RgIsaItemModel::ParseCsvLine(QString isa_line, std::vector<std::string>& li
     }
 }
 
-void RgIsaItemModel::ReadIsaCsvFile(std::string                                        csv_file_full_path,
+void RgIsaItemModel::ReadIsaCsvFile(const std::string&                                 csv_file_full_path,
+                                    qreal                                              character_width,
+                                    const std::atomic<bool>&                           is_canceled,
+                                    const PublishBlocksCallback&                       publish_blocks,
                                     std::vector<std::shared_ptr<IsaItemModel::Block>>& blocks,
-                                    std::vector<std::vector<RgIndexData>>&             index_data)
+                                    std::vector<RgBlockIndexData>&                     index_data)
 {
-    QFontMetrics font_metrics(fixed_font_);
-
     QFile       csv_file(csv_file_full_path.c_str());
     QTextStream file_stream(&csv_file);
 
@@ -309,20 +349,24 @@ void RgIsaItemModel::ReadIsaCsvFile(std::string
         uint64_t line_number         = 0;
         int      code_block_position = 0;
 
+        // The first block that was not published yet, and the number of rows of the blocks that were not published yet.
+        size_t first_unpublished_block = 0;
+        size_t unpublished_row_count   = 0;
+        size_t batch_row_count         = kIsaLoadFirstBatchRowCount;
+
         // Read the first ISA instruction line and just move on, as it's just column labels.
         QString isa_line = file_stream.readLine();
 
         InstructionBlock* current_code_block       = new InstructionBlock(code_block_position++, line_number++, " ");
         current_code_block->token.type             = IsaItemModel::TokenType::kLabelType;
         current_code_block->token.x_position_start = 0;
-        current_code_block->token.x_position_end   = font_metrics.horizontalAdvance(" ");
+        current_code_block->token.x_position_end   = GetFixedFontTextWidth(" ", character_width);
 
         blocks.emplace_back(current_code_block);
 
-        std::vector<RgIndexData> empty_index_data_block;
-        index_data.push_back(empty_index_data_block);
+        index_data.emplace_back();
 
-        do
+        while (!file_stream.atEnd() && !is_canceled)
         {
             isa_line = file_stream.readLine();
 
@@ -339,6 +383,15 @@ void RgIsaItemModel::ReadIsaCsvFile(std::string
                 {
                 case 1:
                 {
+                    // A new block starts, so all blocks read so far are complete. Publish them if there are enough rows.
+                    if (unpublished_row_count >= batch_row_count)
+                    {
+                        publish_blocks(first_unpublished_block, blocks.size() - first_unpublished_block);
+                        first_unpublished_block = blocks.size();
+                        unpublished_row_count   = 0;
+                        batch_row_count         = kIsaLoadBatchRowCount;
+                    }
+
                     std::string code_block_label = line_tokens[0];
                     if (code_block_label.find(":", code_block_label.size() - 1))
                     {
@@ -348,13 +401,15 @@ void RgIsaItemModel::ReadIsaCsvFile(std::string
                     InstructionBlock* code_block       = new InstructionBlock(code_block_position++, line_number++, code_block_label);
                     code_block->token.type             = IsaItemModel::TokenType::kLabelType;
                     code_block->token.x_position_start = 0;
-                    code_block->token.x_position_end   = font_metrics.horizontalAdvance(line_tokens[0].c_str());
+                    code_block->token.x_position_end   = GetFixedFontTextWidth(line_tokens[0], character_width);
 
                     current_code_block = code_block;
 
                     blocks.emplace_back(code_block);
 
-                    index_data.push_back(empty_index_data_block);
+                    index_data.emplace_back();
+
+                    unpublished_row_count++;
                 }
                 break;
                 case num_csv_columns:
@@ -366,14 +421,15 @@ void RgIsaItemModel::ReadIsaCsvFile(std::string
 
                     InstructionRow* instruction_line = new InstructionRow(line_number++, op_code, address, binary_encoding);
 
-                    ParseSelectableTokens(op_code, instruction_line->op_code_token, operands, instruction_line->operand_tokens, fixed_font_character_width_);
+                    ParseSelectableTokens(op_code, instruction_line->op_code_token, operands, instruction_line->operand_tokens, character_width);
 
                     current_code_block->instruction_lines.emplace_back(instruction_line);
 
-                    RgIndexData rg_index_data{};
-                    rg_index_data.input_source_line_index = input_source_line_index;
+                    RgBlockIndexData& block_index_data = index_data.back();
+                    block_index_data.live_vgprs.push_back(kLiveVgprsNotAnalyzed);
+                    block_index_data.input_source_line_indices.push_back(input_source_line_index);
 
-                    index_data.at(index_data.size() - 1).push_back(rg_index_data);
+                    unpublished_row_count++;
                 }
                 break;
                 default:
@@ -382,39 +438,43 @@ void RgIsaItemModel::ReadIsaCsvFile(std::string
                     break;
                 }
             }
-        } while (!file_stream.atEnd());
+        }
+
+        // Publish the remaining blocks.
+        if (!is_canceled && first_unpublished_block < blocks.size())
+        {
+            publish_blocks(first_unpublished_block, blocks.size() - first_unpublished_block);
+        }
     }
 }
 
-int RgIsaItemModel::CalculateMaxVgprs(std::vector<std::vector<RgIndexData>>&             index_data,
-                                      std::vector<std::pair<int, int>>&                  max_line_numbers,
-                                      std::vector<std::shared_ptr<IsaItemModel::Block>>& blocks)
+int RgIsaItemModel::CalculateMaxVgprs(const std::vector<RgBlockIndexData>&                     index_data,
+                                      std::vector<std::pair<int, int>>&                        max_line_numbers,
+                                      const std::vector<std::shared_ptr<IsaItemModel::Block>>& blocks)
 {
-    int max_vgprs_used = 0;
-
-    for (int i = 0; i < blocks.size() && i < index_data.size(); i++)
+    // Rows that were not matched have negative values, so they are never the max.
+    // Find the max VGPR value first, then the rows that have it, so that each pass is a plain scan of an int array.
+    const size_t block_count    = std::min(blocks.size(), index_data.size());
+    int          max_vgprs_used = 0;
+    for (size_t i = 0; i < block_count; i++)
     {
-        for (int j = 0; j < blocks.at(i)->instruction_lines.size() && j < index_data.at(i).size(); j++)
+        const std::vector<int>& live_vgprs = index_data[i].live_vgprs;
+        const size_t            row_count  = std::min(blocks[i]->instruction_lines.size(), live_vgprs.size());
+        for (size_t j = 0; j < row_count; j++)
         {
-            if (index_data.at(i).at(j).opcode.compare(kStrNA) == 0)
-            {
-                continue;
-            }
+            max_vgprs_used = std::max(max_vgprs_used, live_vgprs[j]);
+        }
+    }
 
-            QString vgpr_value = QString::fromStdString(index_data.at(i).at(j).num_live_registers);
-            if (vgpr_value.toInt() >= max_vgprs_used)
+    for (size_t i = 0; i < block_count; i++)
+    {
+        const std::vector<int>& live_vgprs = index_data[i].live_vgprs;
+        const size_t            row_count  = std::min(blocks[i]->instruction_lines.size(), live_vgprs.size());
+        for (size_t j = 0; j < row_count; j++)
+        {
+            if (live_vgprs[j] == max_vgprs_used)
             {
-                if (vgpr_value.toInt() > max_vgprs_used)
-                {
-                    // Clear the values saved so far.
-                    max_line_numbers.clear();
-                }
-
-                // Save the max VGPR value.
-                max_vgprs_used = vgpr_value.toInt();
-
-                // Save the line number here as well.
-                max_line_numbers.push_back(std::pair<int, int>(i, j));
+                max_line_numbers.push_back(std::pair<int, int>(static_cast<int>(i), static_cast<int>(j)));
             }
         }
     }
@@ -426,50 +486,36 @@ bool RgIsaItemModel::SetCurrentMaxVgprLine(EntryData::Operation op)
 {
     bool ret = false;
 
-    // Reset all max vgpr rows to false.
-    for (const auto& itr : current_livereg_data_.max_vgpr_line_numbers)
-    {
-        if (itr.first < current_index_data_.size() && itr.second < current_index_data_.at(itr.first).size())
-        {
-            current_index_data_.at(itr.first).at(itr.second).is_max_vgpr_row = false;
-        }
-    }
-
+    const int max_vgpr_line_count = static_cast<int>(GetCurrentLiveregData().max_vgpr_line_numbers.size());
     switch (op)
     {
     case EntryData::Operation::kGoToNextMaxVgpr:
-        if (current_livereg_data_.max_vgpr_line_numbers.size() > 0)
+        if (max_vgpr_line_count > 0)
         {
-            if (current_livereg_data_.current_max_vgpr_line_numbers_index < current_livereg_data_.max_vgpr_line_numbers.size() - 1)
+            if (current_max_vgpr_index_ < max_vgpr_line_count - 1)
             {
-                current_livereg_data_.current_max_vgpr_line_numbers_index++;
+                current_max_vgpr_index_++;
             }
             else
             {
-                current_livereg_data_.current_max_vgpr_line_numbers_index = 0;
+                current_max_vgpr_index_ = 0;
             }
-
-            const auto& curr_row = current_livereg_data_.max_vgpr_line_numbers[current_livereg_data_.current_max_vgpr_line_numbers_index];
-            current_index_data_.at(curr_row.first).at(curr_row.second).is_max_vgpr_row = true;
-            ret                                                                        = true;
+            ret = true;
         }
         break;
 
     case EntryData::Operation::kGoToPrevMaxVgpr:
-        if (current_livereg_data_.max_vgpr_line_numbers.size() > 0)
+        if (max_vgpr_line_count > 0)
         {
-            if (current_livereg_data_.current_max_vgpr_line_numbers_index > 0)
+            if (current_max_vgpr_index_ > 0)
             {
-                current_livereg_data_.current_max_vgpr_line_numbers_index--;
+                current_max_vgpr_index_--;
             }
             else
             {
-                current_livereg_data_.current_max_vgpr_line_numbers_index = static_cast<int>(current_livereg_data_.max_vgpr_line_numbers.size()) - 1;
+                current_max_vgpr_index_ = max_vgpr_line_count - 1;
             }
-
-            const auto& curr_row = current_livereg_data_.max_vgpr_line_numbers[current_livereg_data_.current_max_vgpr_line_numbers_index];
-            current_index_data_.at(curr_row.first).at(curr_row.second).is_max_vgpr_row = true;
-            ret                                                                        = true;
+            ret = true;
         }
         break;
     default:
@@ -480,18 +526,67 @@ bool RgIsaItemModel::SetCurrentMaxVgprLine(EntryData::Operation op)
 
 void RgIsaItemModel::SetLineCorrelatedIndices(int input_source_line_index)
 {
-    for (int i = 0; i < current_index_data_.size(); i++)
+    // The rows correlated with this line are highlighted by data().
+    const bool was_line_correlation_set  = is_line_correlation_set_;
+    const int  previous_source_line_index = correlated_source_line_index_;
+    correlated_source_line_index_        = input_source_line_index;
+    is_line_correlation_set_             = true;
+
+    if (!was_line_correlation_set || previous_source_line_index != input_source_line_index)
     {
-        for (int j = 0; j < current_index_data_.at(i).size(); j++)
+        if (was_line_correlation_set)
         {
-            auto& index_data = current_index_data_.at(i).at(j);
-            if (index_data.input_source_line_index == input_source_line_index)
+            EmitSourceLineRowsChanged(previous_source_line_index);
+        }
+        EmitSourceLineRowsChanged(input_source_line_index);
+    }
+}
+
+void RgIsaItemModel::EmitSourceLineRowsChanged(int input_source_line_index)
+{
+    const SourceLineRowIndex& source_line_rows = GetCurrentSourceLineRows();
+    auto                      it               = source_line_rows.find(input_source_line_index);
+    if (it != source_line_rows.end())
+    {
+        const QVector<int> roles = {RgIsaItemModel::UserRoles::kSrcLineToIsaRowRole};
+        for (const RowRange& range : it->second)
+        {
+            const QModelIndex parent_index = index(range.block, 0);
+            emit dataChanged(index(range.first_row, 0, parent_index), index(range.last_row, RgIsaItemModel::Columns::kColumnCount - 1, parent_index), roles);
+        }
+    }
+}
+
+void RgIsaItemModel::IndexSourceLines(const std::vector<RgBlockIndexData>& index_data, int first_block, SourceLineRowIndex& source_line_rows)
+{
+    // Consecutive rows usually belong to the same line, so the ranges of the previous row's line are looked up once.
+    std::vector<RowRange>* ranges           = nullptr;
+    int                    ranges_line_index = kInvalidCorrelationLineIndex;
+    for (int i = 0; i < static_cast<int>(index_data.size()); i++)
+    {
+        const int block = first_block + i;
+        const std::vector<int>& input_source_line_indices = index_data[i].input_source_line_indices;
+        for (int j = 0; j < static_cast<int>(input_source_line_indices.size()); j++)
+        {
+            const int input_source_line_index = input_source_line_indices[j];
+            if (input_source_line_index == kInvalidCorrelationLineIndex)
+            {
+                continue;
+            }
+
+            if (ranges == nullptr || ranges_line_index != input_source_line_index)
+            {
+                ranges            = &source_line_rows[input_source_line_index];
+                ranges_line_index = input_source_line_index;
+            }
+
+            if (!ranges->empty() && ranges->back().block == block && ranges->back().last_row == j - 1)
             {
-                index_data.is_active_correlation = true;
+                ranges->back().last_row = j;
             }
             else
             {
-                index_data.is_active_correlation = false;
+                ranges->push_back(RowRange{block, j, j});
             }
         }
     }
@@ -504,25 +599,25 @@ static bool AreOpcodesEqual(const std::string& blocks_op_code, const std::string
            (blocks_op_code.compare(vgpr_op_code + "_dpp") == 0);
 }
 
-bool RgIsaItemModel::ParseLiveVgprsData(const std::string&                                 live_vgpr_file_full_path,
-                                        std::vector<std::shared_ptr<IsaItemModel::Block>>& blocks,
-                                        std::vector<std::vector<RgIndexData>>&             index_data,
-                                        RgLiveregData&                                     livereg_data)
+bool RgIsaItemModel::ParseLiveVgprsData(const std::string&                                       live_vgpr_file_full_path,
+                                        const std::vector<std::shared_ptr<IsaItemModel::Block>>& blocks,
+                                        std::vector<RgBlockIndexData>&                           index_data,
+                                        RgLiveregData&                                           livereg_data,
+                                        std::string&                                             first_block_label)
 {
     bool status = false;
 
-    std::vector<QString> vgpr_file_lines;
-
-    // Read the live VGPR output file.
-    RgOutputFileUtils::ReadLiveVgprsFile(live_vgpr_file_full_path, vgpr_file_lines);
+    // Read the live VGPR output file, and extract the architecture specific information.
+    RgLiveVgprLines vgpr_lines;
+    status = RgOutputFileUtils::ReadLiveVgprsFile(live_vgpr_file_full_path, vgpr_lines, livereg_data);
 
     // The index in the parsed vgpr file lines list, without any of the comment lines in the isa.
-    int  file_lines_index = 0;
-    bool is_first_block   = true;
+    const size_t vgpr_line_count  = vgpr_lines.live_vgprs.size();
+    size_t       file_lines_index = 0;
 
-    for (int i = 0; i < blocks.size() && i < index_data.size(); i++)
+    for (int i = 0; i < blocks.size() && i < index_data.size() && file_lines_index < vgpr_line_count; i++)
     {
-        for (int j = 0; j < blocks.at(i)->instruction_lines.size() && j < index_data.at(i).size(); j++)
+        for (int j = 0; j < blocks.at(i)->instruction_lines.size() && j < index_data.at(i).live_vgprs.size() && file_lines_index < vgpr_line_count; j++)
         {
             auto instruction_line = blocks.at(i)->instruction_lines.at(j);
             if (instruction_line && instruction_line->row_type == RowType::kComment)
@@ -533,89 +628,36 @@ bool RgIsaItemModel::ParseLiveVgprsData(const std::string&
             auto instruction_row = std::static_pointer_cast<IsaItemModel::InstructionRow>(instruction_line);
             if (instruction_row)
             {
-                auto& index_data_entry = index_data.at(i).at(j);
-                if (file_lines_index < vgpr_file_lines.size() && instruction_line->row_type != RowType::kComment)
-                {
-                    QString live_vgpr_line = vgpr_file_lines.at(file_lines_index);
-                    while (!RgOutputFileUtils::IsValidLine(live_vgpr_line))
-                    {
-                        file_lines_index++;
-                        if (file_lines_index >= vgpr_file_lines.size())
-                        {
-                            break;
-                        }
-                        live_vgpr_line = vgpr_file_lines.at(file_lines_index);
-                    }
-                    if (file_lines_index >= vgpr_file_lines.size())
-                    {
-                        break;
-                    }
+                int& row_live_vgprs = index_data.at(i).live_vgprs.at(j);
 
-                    if (RgOutputFileUtils::IsValidLine(live_vgpr_line))
-                    {
-                        bool is_label = RgOutputFileUtils::IsLabelLine(live_vgpr_line);
-
-                        const QRegularExpression label_regex("^\\s*(\\d+)\\s*\\|\\s*(\\d+)\\s*\\|\\s*([:\\^vx\\s*]+)\\s*\\|\\s*[^:]*:\\s*(\\w+)");
-                        const QRegularExpression non_label_regex("^\\s*(\\d+)\\s*\\|\\s*(\\d+)\\s*\\|\\s*([:^vx\\s*]+)\\s*\\|\\s*(\\w+)\\s*");
-                        QRegularExpressionMatch  match;
-
-                        if (is_label)
-                        {
-                            match = non_label_regex.match(live_vgpr_line);
-
-                            // Get the label text of the first block
-                            if (is_first_block && match.hasMatch())
-                            {
-                                auto first_block = std::static_pointer_cast<IsaItemModel::InstructionBlock>(blocks.at(0));
-
-                                QString     label_text   = match.captured(4);
-                                std::string label_string = "label__";
-                                label_text.remove(0, label_string.size());
-
-                                first_block->token.token_text = label_text.toStdString();
-                                is_first_block                = false;
-                            }
-
-                            match = label_regex.match(live_vgpr_line);
-                        }
-                        else
-                        {
-                            match = non_label_regex.match(live_vgpr_line);
-                        }
-
-                        if (match.hasMatch())
-                        {
-                            std::string num_live_registers = match.captured(2).toStdString();
-                            std::string opcode             = match.captured(4).toStdString();
-
-                            if (!AreOpcodesEqual(instruction_row->op_code_token.token_text, opcode))
-                            {
-                                index_data_entry.num_live_registers = "N/A";
-                                index_data_entry.opcode             = "N/A";
-                                continue;
-                            }
-                            else
-                            {
-                                index_data_entry.num_live_registers = match.captured(2).toStdString();
-                                index_data_entry.opcode             = match.captured(4).toStdString();
-                            }
-                        }
-                        else
-                        {
-                            index_data_entry.opcode             = "N/A";
-                            index_data_entry.num_live_registers = "N/A";
-                        }
-                    }
+                // Get the label text of the first block.
+                if (static_cast<int>(file_lines_index) == vgpr_lines.first_label_line)
+                {
+                    first_block_label = vgpr_lines.first_label;
+                }
 
-                    file_lines_index++;
+                const int          live_vgprs = vgpr_lines.live_vgprs[file_lines_index];
+                const std::string& opcode     = vgpr_lines.opcodes[file_lines_index];
+                if (live_vgprs == kLiveVgprsNotAvailable)
+                {
+                    row_live_vgprs = kLiveVgprsNotAvailable;
+                }
+                else if (!AreOpcodesEqual(instruction_row->op_code_token.token_text, opcode))
+                {
+                    // Try to match the same live VGPR line with the next instruction.
+                    row_live_vgprs = kLiveVgprsNotAvailable;
+                    continue;
                 }
+                else
+                {
+                    row_live_vgprs = live_vgprs;
+                }
+
+                file_lines_index++;
             }
         }
     }
 
-    // Now extract the architecture specific information.
-    status = RgOutputFileUtils::GetArchInformation(livereg_data, vgpr_file_lines);
-
     // Calculate the max live VGPR values and extract the live VGPR numbers.
     if (status)
     {
@@ -626,28 +668,21 @@ bool RgIsaItemModel::ParseLiveVgprsData(const std::string&
 
         for (int i = 0; i < blocks.size() && i < index_data.size(); i++)
         {
-            for (int j = 0; j < blocks.at(i)->instruction_lines.size() && j < index_data.at(i).size(); j++)
+            for (int j = 0; j < blocks.at(i)->instruction_lines.size() && j < index_data.at(i).live_vgprs.size(); j++)
             {
                 if (blocks.at(i)->instruction_lines.at(j)->row_type == RowType::kComment)
                 {
                     continue;
                 }
 
-                auto instruction_row = std::static_pointer_cast<IsaItemModel::InstructionRow>(blocks.at(i)->instruction_lines.at(j));
-                if (AreOpcodesEqual(instruction_row->op_code_token.token_text, index_data.at(i).at(j).opcode))
-                {
-                    // Save both the number of live VGPRs and the block granularity.
-                    index_data.at(i).at(j).num_live_registers =
-                        index_data.at(i).at(j).num_live_registers + "," + std::to_string(livereg_data.vgprs_granularity);
-
-                    // Create Vgpr column tooltip.
-                    CreateVgprTooltip(index_data.at(i).at(j).vgpr_tooltip, index_data.at(i).at(j).num_live_registers);
-                }
-                else
+                // Rows with a live VGPR count were matched with a livereg line above.
+                int& row_live_vgprs = index_data.at(i).live_vgprs.at(j);
+                if (row_live_vgprs < 0)
                 {
                     // If the instructions did not match, display "N/A".
-                    index_data.at(i).at(j).num_live_registers = "N/A";
+                    row_live_vgprs = kLiveVgprsNotAvailable;
 
+                    auto instruction_row = std::static_pointer_cast<IsaItemModel::InstructionRow>(blocks.at(i)->instruction_lines.at(j));
                     if (instruction_row->op_code_token.token_text != "s_nop")
                     {
                         livereg_data.unmatched_count++;
@@ -679,73 +714,244 @@ void RgIsaItemModel::UpdateData(void* data)
 
     case EntryData::Operation::kEvictData:
 
-        if (cached_isa_.find(csv_file_full_path) != cached_isa_.end())
+        // Stop reading the entry if it is being evicted while it is loaded.
+        if (csv_file_full_path == loading_isa_file_path_)
         {
-            cached_isa_.erase(csv_file_full_path);
-            cached_index_data_.erase(csv_file_full_path);
-            cached_livereg_data_.erase(csv_file_full_path);
+            CancelLoad();
         }
 
-        if (cached_isa_.empty())
+        EvictCachedEntry(csv_file_full_path);
+
+        if (cached_entries_.empty())
         {
+            CancelLoad();
+
             // Notify the model that it is about to be reset.
             ResetModelObject reset_model_object(this);
 
-            blocks_.clear();
-            current_index_data_.clear();
-            current_livereg_data_ = RgLiveregData{};
+            ClearCurrentEntry();
         }
 
         break;
 
     case EntryData::Operation::kLoadData:
     default:
+    {
+        // Stop reading the previous entry, if it is still being read.
+        CancelLoad();
 
-        // Notify the model that it is about to be reset.
-        ResetModelObject reset_model_object(this);
-
-        blocks_.clear();
-        current_index_data_.clear();
-        current_livereg_data_ = RgLiveregData{};
+        std::shared_ptr<const EntrySnapshot> cached_entry = FindCachedEntry(csv_file_full_path);
 
-        if (!SetArchitecture(entry_data.target_gpu))
         {
-            qDebug() << entry_data.target_gpu << " xml spec missing.";
+            // Notify the model that it is about to be reset.
+            ResetModelObject reset_model_object(this);
+
+            ClearCurrentEntry();
+
+            if (!SetArchitecture(entry_data.target_gpu))
+            {
+                qDebug() << entry_data.target_gpu << " xml spec missing.";
+            }
+
+            // If the the file has been read before, share the cached entry.
+            if (cached_entry != nullptr)
+            {
+                ApplyArchitecture();
+
+                blocks_        = cached_entry->blocks;
+                current_entry_ = std::move(cached_entry);
+
+                MapBlocksToBranchInstructions();
+
+                CacheSizeHints();
+            }
         }
 
-        // If the the file has been read before, use the cached value.
-        if (cached_isa_.find(csv_file_full_path) != cached_isa_.end())
+        if (current_entry_ != nullptr)
         {
-            blocks_               = cached_isa_.at(csv_file_full_path);
-            current_index_data_   = cached_index_data_.at(csv_file_full_path);
-            current_livereg_data_ = cached_livereg_data_.at(csv_file_full_path);
+            emit IsaDataLoaded();
         }
         else
         {
-            std::vector<std::shared_ptr<IsaItemModel::Block>> new_isa;
-            ReadIsaCsvFile(csv_file_full_path, blocks_, current_index_data_);
+            // Read the files on a worker thread. The blocks are added to the model in batches while they are read.
+            StartLoad(entry_data);
+        }
+
+        break;
+    }
+    }
+}
+
+void RgIsaItemModel::StartLoad(const EntryData& entry_data)
+{
+    const uint64_t load_id         = ++load_id_;
+    const qreal    character_width = fixed_font_character_width_;
+
+    loading_isa_file_path_ = entry_data.isa_file_path;
+    is_load_canceled_      = false;
+
+    load_thread_ = std::thread([this, load_id, character_width, entry_data]() {
+        std::shared_ptr<EntrySnapshot>                     entry      = std::make_shared<EntrySnapshot>();
+        std::vector<std::shared_ptr<IsaItemModel::Block>>& blocks     = entry->blocks;
+        std::vector<RgBlockIndexData>&                     index_data = entry->index_data;
+
+        // Post a copy of every batch of complete blocks to the GUI thread. The worker thread does not modify these blocks anymore.
+        auto publish_blocks = [this, load_id, &blocks, &index_data](size_t first_block, size_t block_count) {
+            std::vector<std::shared_ptr<IsaItemModel::Block>> batch_blocks(blocks.begin() + first_block, blocks.begin() + first_block + block_count);
+            std::vector<RgBlockIndexData>                     batch_index_data(index_data.begin() + first_block, index_data.begin() + first_block + block_count);
+
+            QMetaObject::invokeMethod(
+                this, [this, load_id, batch_blocks, batch_index_data]() { AppendBlocks(load_id, batch_blocks, batch_index_data); }, Qt::QueuedConnection);
+        };
+
+        ReadIsaCsvFile(entry_data.isa_file_path, character_width, is_load_canceled_, publish_blocks, blocks, index_data);
+
+        if (!is_load_canceled_)
+        {
+            std::string first_block_label;
+            entry->is_livereg_data_valid = ParseLiveVgprsData(entry_data.vgpr_file_path, blocks, index_data, entry->livereg_data, first_block_label);
+            IndexSourceLines(index_data, 0, entry->source_line_rows);
+            entry->byte_size = EstimateEntryByteSize(*entry, QFileInfo(QString::fromStdString(entry_data.isa_file_path)).size());
+
+            // The entry is not modified anymore, so it is posted without a copy.
+            const std::string                    csv_file_full_path = entry_data.isa_file_path;
+            std::shared_ptr<const EntrySnapshot> loaded_entry       = std::move(entry);
+            QMetaObject::invokeMethod(
+                this,
+                [this, load_id, csv_file_full_path, loaded_entry, first_block_label]() {
+                    FinishLoad(load_id, csv_file_full_path, loaded_entry, first_block_label);
+                },
+                Qt::QueuedConnection);
+        }
+    });
+}
+
+size_t RgIsaItemModel::EstimateEntryByteSize(const EntrySnapshot& entry, qint64 isa_file_size)
+{
+    // The text of the rows is estimated by the size of the isa file, and the rest by the size of the objects that hold it.
+    size_t ret = sizeof(EntrySnapshot) + static_cast<size_t>(std::max<qint64>(isa_file_size, 0));
+    for (const auto& block : entry.blocks)
+    {
+        ret += sizeof(IsaItemModel::InstructionBlock) + sizeof(block);
+        ret += block->instruction_lines.size() * (sizeof(IsaItemModel::InstructionRow) + sizeof(block->instruction_lines.front()));
+    }
+    for (const RgBlockIndexData& block_index_data : entry.index_data)
+    {
+        ret += sizeof(block_index_data) + (block_index_data.live_vgprs.capacity() + block_index_data.input_source_line_indices.capacity()) * sizeof(int);
+    }
+    for (const auto& source_line_rows : entry.source_line_rows)
+    {
+        ret += sizeof(source_line_rows) + source_line_rows.second.capacity() * sizeof(RowRange);
+    }
+    ret += entry.livereg_data.max_vgpr_line_numbers.capacity() * sizeof(std::pair<int, int>);
+    return ret;
+}
+
+void RgIsaItemModel::CancelLoad()
+{
+    // Discard the batches that the worker thread already posted.
+    load_id_++;
+
+    is_load_canceled_ = true;
+    if (load_thread_.joinable())
+    {
+        load_thread_.join();
+    }
+
+    loading_isa_file_path_.clear();
+}
+
+void RgIsaItemModel::AppendBlocks(uint64_t                                                 load_id,
+                                  const std::vector<std::shared_ptr<IsaItemModel::Block>>& blocks,
+                                  const std::vector<RgBlockIndexData>&                     index_data)
+{
+    if (load_id == load_id_ && !blocks.empty())
+    {
+        const bool is_first_batch = blocks_.empty();
+        const int  first_row      = static_cast<int>(blocks_.size());
+
+        if (is_first_batch)
+        {
+            ApplyArchitecture();
+        }
+
+        beginInsertRows(QModelIndex(), first_row, first_row + static_cast<int>(blocks.size()) - 1);
+        blocks_.insert(blocks_.end(), blocks.begin(), blocks.end());
+        loading_index_data_.insert(loading_index_data_.end(), index_data.begin(), index_data.end());
+        IndexSourceLines(index_data, first_row, loading_source_line_rows_);
+        endInsertRows();
+
+        if (is_first_batch)
+        {
+            // Size the columns after the first screen of rows, so that the view can show them right away.
+            CacheSizeHints();
+
+            emit IsaDataLoaded();
+        }
+    }
+}
+
+void RgIsaItemModel::FinishLoad(uint64_t                             load_id,
+                                const std::string&                   csv_file_full_path,
+                                std::shared_ptr<const EntrySnapshot> entry,
+                                const std::string&                   first_block_label)
+{
+    if (load_id == load_id_)
+    {
+        // The worker thread posted this as its last action.
+        if (load_thread_.joinable())
+        {
+            load_thread_.join();
+        }
+        loading_isa_file_path_.clear();
 
-            const std::string live_vgpr_file_full_path = entry_data.vgpr_file_path;
+        // The architecture is applied with the first batch of rows, unless the file had none.
+        if (blocks_.empty())
+        {
+            ApplyArchitecture();
+        }
 
-            ParseLiveVgprsData(live_vgpr_file_full_path, blocks_, current_index_data_, current_livereg_data_);
+        // The entry holds the same blocks as the batches that were added, with the livereg data applied to their index data.
+        current_entry_ = std::move(entry);
+        std::vector<RgBlockIndexData>().swap(loading_index_data_);
+        SourceLineRowIndex().swap(loading_source_line_rows_);
 
-            cached_isa_.insert(std::pair<std::string, std::vector<std::shared_ptr<IsaItemModel::Block>>>(csv_file_full_path, blocks_));
-            cached_index_data_.insert(std::pair<std::string, std::vector<std::vector<RgIndexData>>>(csv_file_full_path, current_index_data_));
-            cached_livereg_data_.insert(std::pair<std::string, RgLiveregData>(csv_file_full_path, current_livereg_data_));
+        if (!first_block_label.empty() && !blocks_.empty())
+        {
+            auto first_block              = std::static_pointer_cast<IsaItemModel::InstructionBlock>(blocks_.at(0));
+            first_block->token.token_text = first_block_label;
         }
 
         MapBlocksToBranchInstructions();
 
         CacheSizeHints();
 
-        break;
+        CacheEntry(csv_file_full_path, current_entry_);
+
+        // The livereg data and the branch targets change the content of the rows that were already added.
+        emit headerDataChanged(Qt::Horizontal, kIsaColumnVgprPressure, kIsaColumnVgprPressure);
+        for (int i = 0; i < static_cast<int>(blocks_.size()); i++)
+        {
+            const int child_count = static_cast<int>(blocks_.at(i)->instruction_lines.size());
+            if (child_count > 0)
+            {
+                const QModelIndex parent_index = index(i, 0);
+                emit dataChanged(index(0, 0, parent_index), index(child_count - 1, kColumnCount - 1, parent_index));
+            }
+        }
+        if (!blocks_.empty())
+        {
+            emit dataChanged(index(0, 0), index(static_cast<int>(blocks_.size()) - 1, kColumnCount - 1));
+        }
+
+        emit IsaDataLoaded();
     }
 }
 
 bool RgIsaItemModel::GetMaxVgprPressureIndices(std::vector<QModelIndex>& source_indices) const
 {
     bool ret = false;
-    for (const auto& max_vgpr_line_number : current_livereg_data_.max_vgpr_line_numbers)
+    for (const auto& max_vgpr_line_number : GetCurrentLiveregData().max_vgpr_line_numbers)
     {
         const auto&       row_pair     = max_vgpr_line_number;
         const auto&       parent_row   = row_pair.first;
@@ -759,29 +965,33 @@ bool RgIsaItemModel::GetMaxVgprPressureIndices(std::vector<QModelIndex>& source_
 
 QModelIndex RgIsaItemModel::GetFirstLineCorrelatedIndex(int input_source_line_index) const
 {
+    QModelIndex ret;
     if (input_source_line_index != kInvalidCorrelationLineIndex)
     {
-        for (int i = 0; i < current_index_data_.size(); i++)
+        // The ranges of a line are in row order.
+        const SourceLineRowIndex& source_line_rows = GetCurrentSourceLineRows();
+        auto                      it               = source_line_rows.find(input_source_line_index);
+        if (it != source_line_rows.end() && !it->second.empty())
         {
-            for (int j = 0; j < current_index_data_.at(i).size(); j++)
-            {
-                const auto& index_data = current_index_data_.at(i).at(j);
-                if (index_data.input_source_line_index == input_source_line_index)
-                {
-                    return index(j, 0, index(i, 0));
-                }
-            }
+            const RowRange& first_range = it->second.front();
+            ret                         = index(first_range.first_row, 0, index(first_range.block, 0));
         }
     }
-    return QModelIndex{};
+    return ret;
+}
+
+int RgIsaItemModel::GetCorrelatedSourceLineIndex() const
+{
+    return is_line_correlation_set_ ? correlated_source_line_index_ : kInvalidCorrelationLineIndex;
 }
 
 QModelIndex RgIsaItemModel::GetMaxVgprIndex() const
 {
-    auto curr = current_livereg_data_.current_max_vgpr_line_numbers_index;
-    if (curr >= 0 && curr < current_livereg_data_.max_vgpr_line_numbers.size())
+    const RgLiveregData& livereg_data = GetCurrentLiveregData();
+    const int            curr         = current_max_vgpr_index_;
+    if (curr >= 0 && curr < livereg_data.max_vgpr_line_numbers.size())
     {
-        const auto& [i, j] = current_livereg_data_.max_vgpr_line_numbers[curr];
+        const auto& [i, j] = livereg_data.max_vgpr_line_numbers[curr];
         return index(j, 0, index(i, 0));
     }
 
@@ -799,10 +1009,14 @@ void RgIsaItemModel::CacheSizeHints()
     const qreal padding_length = static_cast<qreal>(IsaItemModel::kColumnPadding.size());
 
     // Calculate width for VGPR column.
-    const auto max_vgpr_text_length = QString::number(current_livereg_data_.total_vgprs).size() + (2 * padding_length);
-    uint32_t   vgpr_column_width    = static_cast<uint32_t>(std::ceil(max_vgpr_text_length * fixed_font_character_width_));
-    // Calculate the max width of swatch rectangle.
-    vgpr_column_width += (current_livereg_data_.total_vgprs / current_livereg_data_.vgprs_granularity + 1) * current_livereg_data_.vgprs_granularity;
+    const RgLiveregData& livereg_data         = GetCurrentLiveregData();
+    const auto           max_vgpr_text_length = QString::number(livereg_data.total_vgprs).size() + (2 * padding_length);
+    uint32_t             vgpr_column_width    = static_cast<uint32_t>(std::ceil(max_vgpr_text_length * fixed_font_character_width_));
+    // Calculate the max width of swatch rectangle. There is no livereg data while the entry is loaded, or if its livereg file could not be read.
+    if (livereg_data.vgprs_granularity > 0)
+    {
+        vgpr_column_width += (livereg_data.total_vgprs / livereg_data.vgprs_granularity + 1) * livereg_data.vgprs_granularity;
+    }
     column_widths_[kIsaColumnVgprPressure - IsaItemModel::kColumnCount] = vgpr_column_width;
 
     // Calculate functional group column width.
@@ -836,38 +1050,47 @@ QSize RgIsaItemModel::ColumnSizeHint(int column_index, IsaTreeView* tree) const
     return size_hint;
 }
 
-void RgIsaItemModel::CreateVgprTooltip(std::string& tooltip, const std::string& num_live_registers) const
+QString RgIsaItemModel::CreateVgprText(int live_vgprs) const
 {
-    // Extract live VGPRs and granularity values.
-    QStringList values = QString::fromStdString(num_live_registers).split(",");
-
-    // Verify the split.
-    if (values.size() == 2)
+    QString ret;
+    if (live_vgprs >= 0)
     {
-        int used                   = values.at(0).toInt();
-        int block_allocation_value = values.at(1).toInt();
-        int allocated              = 0;
-        int reduction              = 0;
+        // The delegate expects both the number of live VGPRs and the block granularity, once the livereg file was read.
+        ret = QString::number(live_vgprs);
+        if (current_entry_ != nullptr && current_entry_->is_livereg_data_valid)
+        {
+            ret += "," + QString::number(current_entry_->livereg_data.vgprs_granularity);
+        }
+    }
+    else if (live_vgprs == kLiveVgprsNotAvailable)
+    {
+        ret = QString::fromStdString(kStrNA);
+    }
+    return ret;
+}
+
+QString RgIsaItemModel::CreateVgprTooltip(int live_vgprs, int vgprs_granularity, int total_vgprs)
+{
+    QString tooltip;
 
-        assert(block_allocation_value != 0);
-        if (block_allocation_value != 0)
+    assert(vgprs_granularity != 0);
+    if (vgprs_granularity != 0)
+    {
+        // Calculate various values.
+        if (live_vgprs % vgprs_granularity == 0)
         {
-            // Calculate various values.
-            if (used % block_allocation_value == 0)
-            {
-                allocated = used;
-                tooltip   = QString(kLiveVgprTooltip1).arg(used).arg(allocated).arg(current_livereg_data_.total_vgprs).toStdString();
-            }
-            else
-            {
-                allocated = ((used / block_allocation_value) + 1) * block_allocation_value;
-                reduction = used % block_allocation_value;
-                tooltip   = (QString(kLiveVgprTooltip1).arg(used).arg(allocated).arg(current_livereg_data_.total_vgprs) +
-                           QString(kLiveVgprTooltip2).arg(reduction).arg(block_allocation_value).arg(block_allocation_value))
-                              .toStdString();
-            }
+            tooltip = QString(kLiveVgprTooltip1).arg(live_vgprs).arg(live_vgprs).arg(total_vgprs);
+        }
+        else
+        {
+            const int allocated = ((live_vgprs / vgprs_granularity) + 1) * vgprs_granularity;
+            const int reduction = live_vgprs % vgprs_granularity;
+            tooltip             = QString(kLiveVgprTooltip1).arg(live_vgprs).arg(allocated).arg(total_vgprs) +
+                      QString(kLiveVgprTooltip2).arg(reduction).arg(vgprs_granularity).arg(vgprs_granularity);
         }
     }
+
+    return tooltip;
 }
 
 bool RgIsaItemModel::SetArchitecture(const std::string target_gpu)
@@ -914,7 +1137,97 @@ bool RgIsaItemModel::SetArchitecture(const std::string target_gpu)
         success = false;
     }
 
-    IsaItemModel::SetArchitecture(architecture, false);
+    // Only the spec of the requested architecture is loaded, in the background. It is applied by ApplyArchitecture().
+    target_architecture_ = architecture;
+    RgIsaDecodeManager::GetInstance().LoadArchitecture(architecture);
 
     return success;
 }
+
+void RgIsaItemModel::ApplyArchitecture()
+{
+    // The isa spec was loaded while the disassembly was read, so this normally does not wait.
+    if (target_architecture_ != amdisa::GpuArchitecture::kUnknown && !RgIsaDecodeManager::GetInstance().WaitForArchitecture(target_architecture_))
+    {
+        qDebug() << "Failed to load the xml spec for architecture " << static_cast<int>(target_architecture_) << ".";
+    }
+
+    IsaItemModel::SetArchitecture(target_architecture_, false);
+}
+
+void RgIsaItemModel::SetCacheByteBudget(size_t byte_budget)
+{
+    cache_byte_budget_ = byte_budget;
+    TrimCache();
+}
+
+const std::vector<RgIsaItemModel::RgBlockIndexData>& RgIsaItemModel::GetCurrentIndexData() const
+{
+    return current_entry_ != nullptr ? current_entry_->index_data : loading_index_data_;
+}
+
+const RgLiveregData& RgIsaItemModel::GetCurrentLiveregData() const
+{
+    return current_entry_ != nullptr ? current_entry_->livereg_data : kEmptyLiveregData;
+}
+
+const RgIsaItemModel::SourceLineRowIndex& RgIsaItemModel::GetCurrentSourceLineRows() const
+{
+    return current_entry_ != nullptr ? current_entry_->source_line_rows : loading_source_line_rows_;
+}
+
+void RgIsaItemModel::ClearCurrentEntry()
+{
+    blocks_.clear();
+    current_entry_.reset();
+    loading_index_data_.clear();
+    loading_source_line_rows_.clear();
+    current_max_vgpr_index_  = -1;
+    is_line_correlation_set_ = false;
+}
+
+std::shared_ptr<const RgIsaItemModel::EntrySnapshot> RgIsaItemModel::FindCachedEntry(const std::string& csv_file_full_path)
+{
+    std::shared_ptr<const EntrySnapshot> ret;
+    auto                                 it = cached_entry_lookup_.find(csv_file_full_path);
+    if (it != cached_entry_lookup_.end())
+    {
+        // Mark the entry as the most recently used one.
+        cached_entries_.splice(cached_entries_.begin(), cached_entries_, it->second);
+        ret = it->second->second;
+    }
+    return ret;
+}
+
+void RgIsaItemModel::CacheEntry(const std::string& csv_file_full_path, std::shared_ptr<const EntrySnapshot> entry)
+{
+    EvictCachedEntry(csv_file_full_path);
+
+    cached_entries_byte_size_ += entry->byte_size;
+    cached_entries_.emplace_front(csv_file_full_path, std::move(entry));
+    cached_entry_lookup_[csv_file_full_path] = cached_entries_.begin();
+
+    TrimCache();
+}
+
+void RgIsaItemModel::EvictCachedEntry(const std::string& csv_file_full_path)
+{
+    auto it = cached_entry_lookup_.find(csv_file_full_path);
+    if (it != cached_entry_lookup_.end())
+    {
+        // The path may refer to the evicted entry, so the lookup entry is erased first.
+        EntryCacheList::iterator entry_it = it->second;
+        cached_entry_lookup_.erase(it);
+        cached_entries_byte_size_ -= entry_it->second->byte_size;
+        cached_entries_.erase(entry_it);
+    }
+}
+
+void RgIsaItemModel::TrimCache()
+{
+    // The most recently used entry is the one shown by the model, so evicting it would not release its memory.
+    while (cache_byte_budget_ > 0 && cached_entries_byte_size_ > cache_byte_budget_ && cached_entries_.size() > 1)
+    {
+        EvictCachedEntry(cached_entries_.back().first);
+    }
+}
@@ -79,11 +79,19 @@ bool RgIsaTreeView::UpdateLineCorrelation(const QModelIndex source_index, bool u
                 // Line in the input src correlated with the current line in the isa.
                 int correlated_src_line_index = isa_tree_view_index.data(RgIsaItemModel::UserRoles::kIsaRowToSrcLineRole).toInt();
 
+                const int previous_src_line_index = model->GetCorrelatedSourceLineIndex();
+
                 RgIsaItemModel::EntryData entry_data{};
                 entry_data.input_source_line_index = correlated_src_line_index;
                 entry_data.operation               = RgIsaItemModel::EntryData::Operation::kUpdateLineCorrelation;
                 model->UpdateData(&entry_data);
 
+                // The model does not emit row updates for the rows without a source line, so repaint them.
+                if (correlated_src_line_index == kInvalidCorrelationLineIndex || previous_src_line_index == kInvalidCorrelationLineIndex)
+                {
+                    viewport()->update();
+                }
+
                 if (update_source_code_editor)
                 {
                     emit HighlightedIsaRowChanged(correlated_src_line_index);
@@ -5,13 +5,21 @@
 /// @brief Implementation for CLI output files utilities.
 //=============================================================================
 
+// C++.
+#include <algorithm>
+#include <cassert>
+#include <cctype>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+
 // Qt.
 #include <QString>
 #include <QFile>
 #include <QRegularExpression>
 #include <QStandardItem>
 #include <QStandardItemModel>
-#include <QTextStream>
 
 // Local.
 #include "source/radeon_gpu_analyzer_gui/rg_data_types.h"
@@ -38,7 +46,7 @@ int RgOutputFileUtils::CalculateMaxVgprs(const std::vector<std::shared_ptr<RgIsa
     while (evaluate())
     {
         const std::shared_ptr<RgIsaLineInstruction> current_vgpr_line = vgpr_isa_lines[vgpr_line_number];
-        QString                                     value             = QString::fromStdString(current_vgpr_line->num_live_registers);
+        const int                                   live_vgprs        = QString::fromStdString(current_vgpr_line->num_live_registers).toInt();
         std::shared_ptr<RgIsaLineInstruction>       disassembly_line  = std::static_pointer_cast<RgIsaLineInstruction>(disassembled_isa_lines[isa_line_number]);
 
         if (disassembly_line->type == RgIsaLineType::kLabel)
@@ -58,16 +66,16 @@ int RgOutputFileUtils::CalculateMaxVgprs(const std::vector<std::shared_ptr<RgIsa
         else if (disassembly_line->type == RgIsaLineType::kInstruction)
         {
             // Update the max VGPR values.
-            if (value.toInt() >= max_vgprs_used)
+            if (live_vgprs >= max_vgprs_used)
             {
-                if (value.toInt() > max_vgprs_used)
+                if (live_vgprs > max_vgprs_used)
                 {
                     // Clear the values saved so far.
                     max_line_numbers.clear();
                 }
 
                 // Save the max VGPR value.
-                max_vgprs_used = value.toInt();
+                max_vgprs_used = live_vgprs;
 
                 // Save the line number here as well.
                 max_line_numbers.push_back(isa_line_number);
@@ -82,63 +90,222 @@ int RgOutputFileUtils::CalculateMaxVgprs(const std::vector<std::shared_ptr<RgIsa
     return max_vgprs_used;
 }
 
-bool RgOutputFileUtils::IsValidLine(const QString& livereg_line)
+// Skip the blanks at the given position of a line.
+static void SkipBlanks(const char*& pos, const char* end)
 {
-    bool result = false;
+    while (pos < end && (*pos == ' ' || *pos == '\t'))
+    {
+        pos++;
+    }
+}
 
-    // Parse the line.
-    const QRegularExpression reg("^\\s*(\\d+)\\s*\\|\\s*\\d+\\s*\\|\\s*");
-    QRegularExpressionMatch  match = reg.match(livereg_line);
+// Parse the decimal number at the given position of a line, after optional blanks. Numbers that do not fit an int are clamped.
+static bool ParseNumber(const char*& pos, const char* end, int& number)
+{
+    SkipBlanks(pos, end);
+    const char* start = pos;
+    int64_t     value = 0;
+    while (pos < end && *pos >= '0' && *pos <= '9')
+    {
+        value = std::min<int64_t>(value * 10 + (*pos - '0'), std::numeric_limits<int>::max());
+        pos++;
+    }
+    number = static_cast<int>(value);
+    return pos != start;
+}
 
-    if (match.hasMatch())
+// Parse the word (letters, digits and underscores) at the given position of a line.
+static bool ParseWord(const char*& pos, const char* end, std::string& word)
+{
+    const char* start = pos;
+    while (pos < end && (std::isalnum(static_cast<unsigned char>(*pos)) || *pos == '_'))
     {
-        result = true;
+        pos++;
     }
+    word.assign(start, pos);
+    return pos != start;
+}
 
-    return result;
+// Consume the given character at the given position of a line.
+static bool ConsumeChar(const char*& pos, const char* end, char c)
+{
+    const bool ret = (pos < end && *pos == c);
+    if (ret)
+    {
+        pos++;
+    }
+    return ret;
 }
 
-bool RgOutputFileUtils::IsLabelLine(const QString& livereg_line)
+// Consume the given words at the given position of a line. The words may be separated by blanks.
+static bool ConsumeWords(const char*& pos, const char* end, std::initializer_list<const char*> words)
 {
-    bool status = false;
+    bool ret = true;
+    for (auto it = words.begin(); ret && it != words.end(); ++it)
+    {
+        SkipBlanks(pos, end);
+        const size_t length = std::strlen(*it);
+        ret                 = (static_cast<size_t>(end - pos) >= length && std::memcmp(pos, *it, length) == 0);
+        if (ret)
+        {
+            pos += length;
+        }
+    }
+    return ret;
+}
 
-    // Parse the line.
-    const QRegularExpression reg("^\\s*(\\d+)\\s*\\|\\s*(\\d+)\\s*\\|.*\\|\\s*(label_.*):");
-    QRegularExpressionMatch  match = reg.match(livereg_line);
+// Parse the part of an instruction line that follows the line number and live register count columns:
+// the register usage column ("::^vx" characters), then the instruction, which may start with a label.
+static void ParseLiveVgprInstruction(const char* pos, const char* end, int live_vgprs, RgLiveVgprLines& vgpr_lines)
+{
+    static const char* kLabelPrefix      = "label_";
+    static const char* kFirstLabelPrefix = "label__";
 
-    if (match.hasMatch())
+    // Find out if the line starts with a label: a column separator followed by "label_" and a colon.
+    bool is_label = false;
+    for (const char* separator = pos; !is_label && separator < end; separator++)
     {
-        status = true;
+        if (*separator == '|')
+        {
+            const char* label = separator + 1;
+            SkipBlanks(label, end);
+            is_label = ConsumeWords(label, end, {kLabelPrefix}) && std::find(label, end, ':') != end;
+        }
+    }
+
+    // The register usage column.
+    const char* usage_end = pos;
+    while (usage_end < end && std::strchr(" \t:^vx*", *usage_end) != nullptr)
+    {
+        usage_end++;
     }
 
-    return status;
+    std::string opcode;
+    bool        is_matched = (usage_end != pos && ConsumeChar(usage_end, end, '|'));
+    if (is_matched)
+    {
+        pos = usage_end;
+        SkipBlanks(pos, end);
+        const char* instruction = pos;
+
+        std::string first_word;
+        is_matched = ParseWord(pos, end, first_word);
+
+        if (is_label && is_matched && vgpr_lines.first_label_line < 0)
+        {
+            vgpr_lines.first_label_line = static_cast<int>(vgpr_lines.live_vgprs.size());
+            vgpr_lines.first_label      = first_word.substr(std::min(first_word.size(), std::strlen(kFirstLabelPrefix)));
+        }
+
+        if (is_label)
+        {
+            // The opcode follows the label.
+            pos        = std::find(instruction, end, ':');
+            is_matched = ConsumeChar(pos, end, ':');
+            SkipBlanks(pos, end);
+            is_matched = is_matched && ParseWord(pos, end, opcode);
+        }
+        else
+        {
+            opcode = first_word;
+        }
+    }
+
+    vgpr_lines.live_vgprs.push_back(is_matched ? live_vgprs : kLiveVgprsNotAvailable);
+    vgpr_lines.opcodes.push_back(is_matched ? opcode : std::string());
 }
 
-bool RgOutputFileUtils::ReadLiveVgprsFile(const std::string& live_vgpr_file_full_path, std::vector<QString>& vgpr_file_lines)
+bool RgOutputFileUtils::ReadLiveVgprsFile(const std::string& live_vgpr_file_full_path, RgLiveVgprLines& vgpr_lines, RgLiveregData& livereg_data)
 {
-    bool status = false;
-
-    QString text;
-    bool    is_file_opened = RgUtils::ReadTextFile(live_vgpr_file_full_path, text);
-    QTextStream file_stream(&text);
+    // Initialize flags.
+    bool is_vgprs_total              = false;
+    bool is_vgprs_granularity        = false;
+    bool is_vgprs_used_and_allocated = false;
+    bool is_no_vgprs_used            = false;
 
-    // Process the data.
+    QFile file(QString::fromStdString(live_vgpr_file_full_path));
+    bool  is_file_opened = file.open(QFile::ReadOnly);
     assert(is_file_opened);
     if (is_file_opened)
     {
-        // Read the live VGPR file line.
-        QString live_vgpr_line = file_stream.readLine();
-        while (!live_vgpr_line.isNull())
+        // Map the file rather than reading it. Empty files cannot be mapped, and if mapping fails the file is read instead.
+        QByteArray  file_content;
+        const char* data      = nullptr;
+        qint64      data_size = file.size();
+        if (data_size > 0)
+        {
+            data = reinterpret_cast<const char*>(file.map(0, data_size));
+            if (data == nullptr)
+            {
+                file_content = file.readAll();
+                data         = file_content.constData();
+                data_size    = file_content.size();
+            }
+        }
+
+        const char* file_end   = data + (data != nullptr ? data_size : 0);
+        const char* line_start = data;
+        while (line_start < file_end)
         {
-            // Save the line.
-            vgpr_file_lines.push_back(live_vgpr_line);
+            const char* line_end = std::find(line_start, file_end, '\n');
+            const char* next     = (line_end < file_end ? line_end + 1 : file_end);
+            if (line_end > line_start && *(line_end - 1) == '\r')
+            {
+                line_end--;
+            }
+
+            // Instruction lines start with the line number and the live register count: "N | N | ...".
+            const char* pos            = line_start;
+            int         line_number    = 0;
+            int         live_vgprs     = 0;
+            const bool  is_instruction = ParseNumber(pos, line_end, line_number) && ConsumeWords(pos, line_end, {"|"}) &&
+                                        ParseNumber(pos, line_end, live_vgprs) && ConsumeWords(pos, line_end, {"|"});
+
+            if (is_instruction)
+            {
+                ParseLiveVgprInstruction(pos, line_end, live_vgprs, vgpr_lines);
+            }
+            else
+            {
+                // Look for the architecture specific information.
+                pos                    = line_start;
+                const bool is_indented = (pos < line_end && (*pos == ' ' || *pos == '\t'));
+                int        value       = 0;
+                if (is_indented && ConsumeWords(pos, line_end, {"VGPRs", "total:"}) && ParseNumber(pos, line_end, value))
+                {
+                    livereg_data.total_vgprs = value;
+                    is_vgprs_total           = true;
+                }
+
+                pos = line_start;
+                if (is_indented && ConsumeWords(pos, line_end, {"VGPR", "allocation", "granularity:"}) && ParseNumber(pos, line_end, value))
+                {
+                    livereg_data.vgprs_granularity = value;
+                    is_vgprs_granularity           = true;
+                }
 
-            // Read the next live VGPR file line.
-            live_vgpr_line = file_stream.readLine();
+                pos           = line_start;
+                int allocated = 0;
+                if (pos < line_end && *pos == 'M' && ConsumeWords(pos, line_end, {"Maximum", "#", "VGPR", "used"}) && ParseNumber(pos, line_end, value) &&
+                    ConsumeWords(pos, line_end, {",", "VGPRs", "allocated", "by", "HW:"}) && ParseNumber(pos, line_end, allocated))
+                {
+                    livereg_data.used           = value;
+                    livereg_data.allocated      = allocated;
+                    is_vgprs_used_and_allocated = true;
+                }
+
+                pos = line_start;
+                if (ConsumeWords(pos, line_end, {"No", "VGPRs", "used"}))
+                {
+                    is_no_vgprs_used = true;
+                }
+            }
+
+            line_start = next;
         }
-        status = true;
     }
-    return status;
+
+    return (is_vgprs_total && is_vgprs_granularity && is_vgprs_used_and_allocated) || is_no_vgprs_used;
 }
 
 void RgOutputFileUtils::ParseLiveVgprIsaLine(const QString& livereg_line, std::vector<std::shared_ptr<RgIsaLineInstruction>>& vgpr_isa_lines, bool is_label)
@@ -174,49 +341,3 @@ void RgOutputFileUtils::ParseLiveVgprIsaLine(const QString& livereg_line, std::v
     // Save the newly created line.
     vgpr_isa_lines.push_back(new_line);
 }
-
-bool RgOutputFileUtils::GetArchInformation(RgLiveregData& livereg_data,
-                                           std::vector<QString>& vgpr_file_lines)
-{
-    // Initialize flags.
-    bool is_vgprs_total = false;
-    bool is_vgprs_granularity = false;
-    bool is_vgprs_used_and_allocated = false;
-    bool is_no_vgprs_used = false;
-
-    // Create regular expressions.
-    const QRegularExpression vgprs_total_regex("^\\s+VGPRs total:\\s+(\\d+)");
-    const QRegularExpression vgprs_granularity_regex("^\\s+VGPR allocation granularity:\\s+(\\d+)");
-    const QRegularExpression vgprs_used_and_allocated_by_hw_regex("^Maximum\\s*#\\s*VGPR\\s*used\\s*(\\d+),\\s*VGPRs\\s*allocated\\s*by\\s*HW:\\s*(\\d+)");
-    const QRegularExpression no_vgprs_used_regex("^\\s*No VGPRs used\\s*");
-
-    // Look thru the file lines for max VGPRs and block granularity.
-    for (const auto& live_vgpr_line : vgpr_file_lines)
-    {
-        QRegularExpressionMatch match = vgprs_total_regex.match(live_vgpr_line);
-        if (match.hasMatch())
-        {
-            livereg_data.total_vgprs = match.captured(1).toInt();
-            is_vgprs_total           = true;
-        }
-        match = vgprs_granularity_regex.match(live_vgpr_line);
-        if (match.hasMatch())
-        {
-            livereg_data.vgprs_granularity  = match.captured(1).toInt();
-            is_vgprs_granularity            = true;
-        }
-        match = vgprs_used_and_allocated_by_hw_regex.match(live_vgpr_line);
-        if (match.hasMatch())
-        {
-            livereg_data.used                   = match.captured(1).toInt();
-            livereg_data.allocated              = match.captured(2).toInt();
-            is_vgprs_used_and_allocated         = true;
-        }
-        match = no_vgprs_used_regex.match(live_vgpr_line);
-        if (match.hasMatch())
-        {
-            is_no_vgprs_used = true;
-        }
-    }
-    return (is_vgprs_total && is_vgprs_granularity && is_vgprs_used_and_allocated) || is_no_vgprs_used;
-}
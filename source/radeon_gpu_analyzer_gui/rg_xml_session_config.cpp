@@ -8,6 +8,10 @@
 #include <cassert>
 #include <algorithm>
 
+// Qt.
+#include <QFile>
+#include <QFileInfo>
+
 // XML.
 #include "tinyxml2.h"
 
@@ -18,9 +22,169 @@
 #include "radeon_gpu_analyzer_gui/rg_utils.h"
 #include "radeon_gpu_analyzer_gui/rg_xml_session_config.h"
 #include "radeon_gpu_analyzer_gui/rg_xml_utils.h"
+#include "source/common/rga_session_metadata_binary.h"
 #include "source/common/rga_xml_constants.h"
 
+// Map the binary session metadata file of the given session metadata XML file, and get its records.
+// Returns false if there is no binary file, or if it does not match an XML file with the given signature.
+// The records point into the mapped file, which stays mapped while the given file is open.
+static bool MapBinarySessionMetadata(QFile&                                         file,
+                                     const std::string&                             session_metadata_file_path,
+                                     const RgaSessionMetadataBinary::XmlSignature&  xml_signature,
+                                     RgaSessionMetadataBinary::Kind                 kind,
+                                     std::vector<RgaSessionMetadataBinary::Record>& records)
+{
+    bool ret = false;
+    file.setFileName(QString::fromStdString(RgaSessionMetadataBinary::GetFilePath(session_metadata_file_path)));
+    const qint64 file_size = file.size();
+    if (file_size > 0 && xml_signature.size > 0 && file.open(QFile::ReadOnly))
+    {
+        const char* data = reinterpret_cast<const char*>(file.map(0, file_size));
+        ret              = RgaSessionMetadataBinary::IsHeaderValid(data, static_cast<size_t>(file_size), kind, xml_signature) &&
+              RgaSessionMetadataBinary::GetRecords(data, static_cast<size_t>(file_size), records);
+    }
+    return ret;
+}
+
+// Read the output files of a binary session metadata record into output items, in the order in which the XML file lists them.
+// The output files that the XML readers do not read are skipped. If is_gpu_name_set is false, the target GPU is not assigned to the items.
+static bool DecodeOutputFiles(RgaSessionMetadataBinary::Decoder& decoder, bool is_gpu_name_set, std::vector<RgOutputItem>& outputs)
+{
+    std::string target_asic;
+    uint32_t    file_count = 0;
+    bool        ret        = decoder.ReadString(target_asic) && decoder.ReadUint32(file_count);
+    for (uint32_t i = 0; ret && i < file_count; i++)
+    {
+        uint8_t      file_type   = 0;
+        RgOutputItem output_item = {};
+        ret                      = decoder.ReadUint8(file_type) && decoder.ReadString(output_item.file_path);
+        if (ret && (!is_gpu_name_set || !target_asic.empty()))
+        {
+            bool is_read = true;
+            switch (static_cast<RgaSessionMetadataBinary::FileType>(file_type))
+            {
+            case RgaSessionMetadataBinary::FileType::kIsa:
+                output_item.file_type = RgCliOutputFileType::kIsaDisassemblyText;
+                break;
+            case RgaSessionMetadataBinary::FileType::kCsvIsa:
+                output_item.file_type = RgCliOutputFileType::kIsaDisassemblyCsv;
+                break;
+            case RgaSessionMetadataBinary::FileType::kResUsage:
+                output_item.file_type = RgCliOutputFileType::kHwResourceUsageFile;
+                break;
+            case RgaSessionMetadataBinary::FileType::kLivereg:
+                output_item.file_type = RgCliOutputFileType::kLiveRegisterAnalysisReport;
+                break;
+            default:
+                is_read = false;
+                break;
+            }
+
+            if (is_read)
+            {
+                output_item.gpu_name = (is_gpu_name_set ? target_asic : "");
+                outputs.push_back(output_item);
+            }
+        }
+    }
+    return ret;
+}
+
 bool RgXMLSessionConfig::ReadSessionMetadataOpenCL(const std::string& session_metadata_file_path, std::shared_ptr<RgCliBuildOutputOpencl>& cli_output)
+{
+    bool ret = ReadBinarySessionMetadataOpenCL(session_metadata_file_path, cli_output);
+    if (!ret)
+    {
+        ret = ReadXmlSessionMetadataOpenCL(session_metadata_file_path, cli_output);
+    }
+    return ret;
+}
+
+bool RgXMLSessionConfig::ReadBinarySessionMetadataOpenCL(const std::string& session_metadata_file_path, std::shared_ptr<RgCliBuildOutputOpencl>& cli_output)
+{
+    bool ret = false;
+
+    // Create the CLI output variable.
+    cli_output = std::make_shared<RgCliBuildOutputOpencl>();
+
+    // Every record holds the metadata of one build, like a metadata element of the XML file.
+    QFile                                         file;
+    std::vector<RgaSessionMetadataBinary::Record> records;
+    RgaSessionMetadataBinary::XmlSignature        xml_signature;
+    if (RgaSessionMetadataBinary::GetXmlFileSignature(session_metadata_file_path, xml_signature) &&
+        MapBinarySessionMetadata(file, session_metadata_file_path, xml_signature, RgaSessionMetadataBinary::Kind::kOpencl, records) && !records.empty())
+    {
+        ret = true;
+        for (auto record = records.begin(); ret && record != records.end(); ++record)
+        {
+            RgaSessionMetadataBinary::Decoder decoder(record->first, record->second);
+
+            // Read the full file path to the compiled binary output. As with the XML file, a record with an empty binary path has no outputs.
+            uint8_t     has_binary = 0;
+            std::string binary_full_file_path;
+            ret                    = decoder.ReadUint8(has_binary) && (has_binary == 0 || decoder.ReadString(binary_full_file_path));
+            const bool has_outputs = (has_binary == 0 || !binary_full_file_path.empty());
+            if (ret && has_binary != 0 && has_outputs)
+            {
+                cli_output->project_binaries.push_back(binary_full_file_path);
+            }
+
+            uint32_t input_file_count = 0;
+            ret                       = ret && decoder.ReadUint32(input_file_count);
+            for (uint32_t i = 0; ret && i < input_file_count; i++)
+            {
+                std::string input_full_file_path;
+                uint32_t    entry_count = 0;
+                ret                     = decoder.ReadString(input_full_file_path) && decoder.ReadUint32(entry_count);
+
+                // Use the binary file name for the input file key for binary analysis mode when there is no source file.
+                if (input_full_file_path == kStrXmlNodeSourceFile && !binary_full_file_path.empty())
+                {
+                    input_full_file_path = binary_full_file_path;
+                }
+
+                RgFileOutputs* file_outputs = nullptr;
+                if (ret && has_outputs && !input_full_file_path.empty() && entry_count > 0)
+                {
+                    file_outputs                  = &cli_output->per_file_output[input_full_file_path];
+                    file_outputs->input_file_path = input_full_file_path;
+                }
+
+                for (uint32_t j = 0; ret && j < entry_count; j++)
+                {
+                    RgEntryOutput entry;
+                    uint8_t       has_extremely_long_name = 0;
+                    uint32_t      output_count            = 0;
+                    ret = decoder.ReadString(entry.entrypoint_name) && decoder.ReadString(entry.kernel_type) && decoder.ReadUint8(has_extremely_long_name) &&
+                          (has_extremely_long_name == 0 || decoder.ReadString(entry.extremely_long_kernel_name)) && decoder.ReadUint32(output_count);
+
+                    for (uint32_t k = 0; ret && k < output_count; k++)
+                    {
+                        ret = DecodeOutputFiles(decoder, true, entry.outputs);
+                    }
+
+                    // Entries without a type or outputs are skipped, as they are by the XML reader.
+                    if (ret && file_outputs != nullptr && !entry.kernel_type.empty() && output_count > 0)
+                    {
+                        // If there is no entry name, use the kernel type as the entry name.
+                        if (entry.entrypoint_name.empty())
+                        {
+                            entry.entrypoint_name = entry.kernel_type;
+                        }
+                        entry.input_file_path = file_outputs->input_file_path;
+                        file_outputs->outputs.push_back(entry);
+                    }
+                }
+            }
+
+            ret = ret && decoder.IsComplete();
+        }
+    }
+
+    return ret;
+}
+
+bool RgXMLSessionConfig::ReadXmlSessionMetadataOpenCL(const std::string& session_metadata_file_path, std::shared_ptr<RgCliBuildOutputOpencl>& cli_output)
 {
     bool ret = false;
 
@@ -91,6 +255,91 @@ bool RgXMLSessionConfig::ReadSessionMetadataOpenCL(const std::string& session_me
 bool RgXMLSessionConfig::ReadSessionMetadataVulkan(const std::string&                         session_metadata_file_path,
                                                    std::shared_ptr<RgCliBuildOutputPipeline>& cli_output,
                                                    bool                                       is_codeobj_input_file)
+{
+    bool ret = ReadBinarySessionMetadataVulkan(session_metadata_file_path, cli_output, is_codeobj_input_file);
+    if (!ret)
+    {
+        ret = ReadXmlSessionMetadataVulkan(session_metadata_file_path, cli_output, is_codeobj_input_file);
+    }
+    return ret;
+}
+
+bool RgXMLSessionConfig::ReadBinarySessionMetadataVulkan(const std::string&                         session_metadata_file_path,
+                                                         std::shared_ptr<RgCliBuildOutputPipeline>& cli_output,
+                                                         bool                                       is_codeobj_input_file)
+{
+    bool ret = false;
+
+    // Create the CLI output variable.
+    cli_output = std::make_shared<RgCliBuildOutputPipeline>();
+
+    QFile                                         file;
+    std::vector<RgaSessionMetadataBinary::Record> records;
+    RgaSessionMetadataBinary::XmlSignature        xml_signature;
+    if (RgaSessionMetadataBinary::GetXmlFileSignature(session_metadata_file_path, xml_signature) &&
+        MapBinarySessionMetadata(file, session_metadata_file_path, xml_signature, RgaSessionMetadataBinary::Kind::kPipeline, records) && records.size() == 1)
+    {
+        // Like the XML reader, only read the first pipeline.
+        RgaSessionMetadataBinary::Decoder decoder(records.front().first, records.front().second);
+        uint32_t                          pipeline_count = 0;
+        uint8_t                           is_compute     = 0;
+        uint32_t                          stage_count    = 0;
+        ret = decoder.ReadUint32(pipeline_count) && pipeline_count > 0 && decoder.ReadUint8(is_compute) && decoder.ReadUint32(stage_count);
+        if (ret)
+        {
+            cli_output->type = (is_compute != 0 ? RgPipelineType::kCompute : RgPipelineType::kGraphics);
+        }
+
+        for (uint32_t i = 0; ret && i < stage_count; i++)
+        {
+            RgEntryOutput stage_entry   = {};
+            stage_entry.entrypoint_name = kStrDefaultVulkanGlslEntrypointName;
+
+            // As with the XML file, a stage without a type, an input file or outputs ends the read.
+            ret = decoder.ReadString(stage_entry.kernel_type) && decoder.ReadString(stage_entry.input_file_path) &&
+                  DecodeOutputFiles(decoder, false, stage_entry.outputs) && !stage_entry.kernel_type.empty() && !stage_entry.input_file_path.empty() &&
+                  !stage_entry.outputs.empty();
+            if (ret)
+            {
+                AddPipelineStageOutput(stage_entry, cli_output, is_codeobj_input_file);
+            }
+        }
+    }
+
+    return ret;
+}
+
+void RgXMLSessionConfig::AddPipelineStageOutput(const RgEntryOutput& stage_entry, std::shared_ptr<RgCliBuildOutputPipeline>& cli_output, bool is_codeobj_input_file)
+{
+    bool is_stage_entry_added = false;
+    if (is_codeobj_input_file)
+    {
+        RgEntryOutput codeobj_stage_entry   = stage_entry;
+        codeobj_stage_entry.entrypoint_name = codeobj_stage_entry.kernel_type;
+        auto output_itr                     = cli_output->per_file_output.find(codeobj_stage_entry.input_file_path);
+        if (output_itr != cli_output->per_file_output.end())
+        {
+            output_itr->second.outputs.push_back(codeobj_stage_entry);
+            is_stage_entry_added = true;
+        }
+    }
+
+    if (!is_stage_entry_added)
+    {
+        RgFileOutputs file_outputs;
+        file_outputs.input_file_path = stage_entry.input_file_path;
+        file_outputs.outputs.push_back(stage_entry);
+        if (is_codeobj_input_file)
+        {
+            file_outputs.outputs.back().entrypoint_name = stage_entry.kernel_type;
+        }
+        cli_output->per_file_output[stage_entry.input_file_path] = file_outputs;
+    }
+}
+
+bool RgXMLSessionConfig::ReadXmlSessionMetadataVulkan(const std::string&                         session_metadata_file_path,
+                                                      std::shared_ptr<RgCliBuildOutputPipeline>& cli_output,
+                                                      bool                                       is_codeobj_input_file)
 {
     bool ret = false;
 
@@ -191,25 +440,7 @@ bool RgXMLSessionConfig::ReadSessionMetadataVulkan(const std::string&
                             assert(ret);
                             if (ret)
                             {
-                                bool is_stage_entry_added = false;
-                                if (is_codeobj_input_file)
-                                {
-                                    stage_entry.entrypoint_name = stage_entry.kernel_type;
-                                    auto output_itr             = cli_output->per_file_output.find(stage_entry.input_file_path);
-                                    if (output_itr != cli_output->per_file_output.end())
-                                    {
-                                        output_itr->second.outputs.push_back(stage_entry);
-                                        is_stage_entry_added = true;
-                                    }
-                                }
-
-                                if (!is_stage_entry_added)
-                                {
-                                    RgFileOutputs file_outputs;
-                                    file_outputs.input_file_path = stage_entry.input_file_path;
-                                    file_outputs.outputs.push_back(stage_entry);
-                                    cli_output->per_file_output[stage_entry.input_file_path] = file_outputs;
-                                }
+                                AddPipelineStageOutput(stage_entry, cli_output, is_codeobj_input_file);
 
                                 // Search for the next stage node.
                                 stage_node = stage_node->NextSiblingElement(kStrXmlNodeStage);
@@ -230,10 +461,60 @@ bool RgXMLSessionConfig::ReadSessionMetadataVulkan(const std::string&
     return ret;
 }
 
+// Rewrite the binary session metadata file after the records of the given binary were removed from the XML file.
+// Like the XML file, only the records of the other binaries are kept. If the binary file cannot be rewritten, it is deleted,
+// so that the XML file is read instead.
+static void RemoveBinaryFileFromBinaryMetadata(const std::string&                            session_metadata_file_path,
+                                               const RgaSessionMetadataBinary::XmlSignature& previous_xml_signature,
+                                               const std::string&                            target_binary_full_file_path)
+{
+    const QString binary_file_path = QString::fromStdString(RgaSessionMetadataBinary::GetFilePath(session_metadata_file_path));
+    if (QFile::exists(binary_file_path))
+    {
+        QFile                                         file;
+        std::vector<RgaSessionMetadataBinary::Record> records;
+        RgaSessionMetadataBinary::XmlSignature        xml_signature;
+        bool is_rewritten = MapBinarySessionMetadata(file, session_metadata_file_path, previous_xml_signature, RgaSessionMetadataBinary::Kind::kOpencl, records) &&
+                            RgaSessionMetadataBinary::GetXmlFileSignature(session_metadata_file_path, xml_signature);
+        if (is_rewritten)
+        {
+            const RgaSessionMetadataBinary::Header header = RgaSessionMetadataBinary::CreateHeader(RgaSessionMetadataBinary::Kind::kOpencl, xml_signature);
+            QByteArray                             content(reinterpret_cast<const char*>(&header), sizeof(header));
+            for (const RgaSessionMetadataBinary::Record& record : records)
+            {
+                RgaSessionMetadataBinary::Decoder decoder(record.first, record.second);
+                uint8_t                           has_binary = 0;
+                std::string                       binary_full_file_path;
+                if (decoder.ReadUint8(has_binary) && has_binary != 0 && decoder.ReadString(binary_full_file_path) &&
+                    binary_full_file_path != target_binary_full_file_path)
+                {
+                    const uint32_t record_size = static_cast<uint32_t>(record.second);
+                    content.append(reinterpret_cast<const char*>(&record_size), sizeof(record_size));
+                    content.append(record.first, static_cast<int>(record.second));
+                }
+            }
+
+            // Unmap the file before overwriting it.
+            file.close();
+            is_rewritten = file.open(QFile::WriteOnly | QFile::Truncate) && file.write(content) == content.size();
+            file.close();
+        }
+
+        if (!is_rewritten)
+        {
+            QFile::remove(binary_file_path);
+        }
+    }
+}
+
 bool RgXMLSessionConfig::RemoveBinaryFileFromMetadata(const std::string& session_metadata_file_path, const std::string& target_binary_full_file_path)
 {
     bool ret = false;
 
+    // The signature of the XML file that the binary session metadata file matches.
+    RgaSessionMetadataBinary::XmlSignature previous_xml_signature;
+    RgaSessionMetadataBinary::GetXmlFileSignature(session_metadata_file_path, previous_xml_signature);
+
     // Load the XML document.
     tinyxml2::XMLDocument doc(true, tinyxml2::Whitespace::COLLAPSE_WHITESPACE);
 
@@ -295,6 +576,8 @@ bool RgXMLSessionConfig::RemoveBinaryFileFromMetadata(const std::string& session
                     } while (current_node != nullptr);
 
                     std::fclose(xml_file);
+
+                    RemoveBinaryFileFromBinaryMetadata(session_metadata_file_path, previous_xml_signature, target_binary_full_file_path);
                 }
             }
         }
@@ -307,13 +590,12 @@ bool RgXMLSessionConfig::ReadBuildOutputs(tinyxml2::XMLNode* outputs_node, std::
 {
     bool ret = false;
 
-    // Extract the target GPU name.
-    tinyxml2::XMLNode* target_gpu_node = outputs_node->FirstChildElement(kStrXmlNodeTarget);
-
     while (outputs_node != nullptr)
     {
         RgOutputItem output_item = {};
 
+        // Extract the target GPU name of this output.
+        tinyxml2::XMLNode* target_gpu_node = outputs_node->FirstChildElement(kStrXmlNodeTarget);
         if (target_gpu_node != nullptr)
         {
             // Read the target GPU that the output was generated for.
@@ -20,6 +20,8 @@ namespace tinyxml2
 }
 
 // A class responsible for parsing session metadata.
+// The session metadata is read from the binary session metadata file that the CLI writes next to the XML file when it matches the XML file,
+// and from the XML file otherwise.
 class RgXMLSessionConfig
 {
 public:
@@ -35,6 +37,25 @@ public:
     static bool RemoveBinaryFileFromMetadata(const std::string& session_metadata_file_path, const std::string& target_binary_full_file_path);
 
 private:
+    // Read the OpenCL project session metadata from the XML file at the given file path.
+    static bool ReadXmlSessionMetadataOpenCL(const std::string& session_metadata_file_path, std::shared_ptr<RgCliBuildOutputOpencl>& cli_output);
+
+    // Read the OpenCL project session metadata from the binary file next to the XML file at the given file path.
+    static bool ReadBinarySessionMetadataOpenCL(const std::string& session_metadata_file_path, std::shared_ptr<RgCliBuildOutputOpencl>& cli_output);
+
+    // Read the Vulkan Pipeline session metadata from the XML file at the given file path.
+    static bool ReadXmlSessionMetadataVulkan(const std::string&                         session_metadata_file_path,
+                                             std::shared_ptr<RgCliBuildOutputPipeline>& cli_output,
+                                             bool                                       is_codeobj_input_file);
+
+    // Read the Vulkan Pipeline session metadata from the binary file next to the XML file at the given file path.
+    static bool ReadBinarySessionMetadataVulkan(const std::string&                         session_metadata_file_path,
+                                                std::shared_ptr<RgCliBuildOutputPipeline>& cli_output,
+                                                bool                                       is_codeobj_input_file);
+
+    // Add a pipeline stage's outputs to the outputs of its input file.
+    static void AddPipelineStageOutput(const RgEntryOutput& stage_entry, std::shared_ptr<RgCliBuildOutputPipeline>& cli_output, bool is_codeobj_input_file);
+
     // Read the outputs node into an RgOutputItem array.
     static bool ReadBuildOutputs(tinyxml2::XMLNode* outputs_node, std::vector<RgOutputItem>& output);
 